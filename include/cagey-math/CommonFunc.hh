@@ -0,0 +1,760 @@
+//=============================================================================
+//
+// cagey-math - C++-17 Vector Math Library
+// Copyright (c) 2020 Kyle Girard <theycallmecoach@gmail.com>
+//
+// The MIT License (MIT)
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+//=============================================================================
+
+#pragma once
+
+/**
+ * @file
+ * @brief The GLSL common functions for scalars, vectors and arrays of vectors
+ *
+ * abs, sign, floor, ceil, fract, mod, clamp, mix, step and smoothstep follow
+ * the definitions in the GLSL specification.  The min and max for vectors
+ * are the ones in VectorFunc.hh.  The scalar and vector functions are
+ * constexpr, the batch functions work on float with SSE2.
+ */
+
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <type_traits>
+
+#if defined(__SSE2__)
+#include <emmintrin.h>
+#endif
+
+#include "cagey-math/IntVectorFunc.hh"
+#include "cagey-math/VectorFunc.hh"
+
+namespace cagey::math
+{
+  namespace detail::common
+  {
+    template <typename T>
+    using EnableIfArithmetic = std::enable_if_t<std::is_arithmetic<T>::value>;
+
+    /// x rounded toward zero, keeping the sign of zero
+    template <typename T>
+    constexpr auto trunc(T const x) noexcept -> T
+    {
+      if constexpr (std::is_floating_point<T>::value)
+      {
+        // at and above 1 / epsilon every float is a whole number, this also passes inf and NaN through
+        if (!(x < T(1) / std::numeric_limits<T>::epsilon() && -x < T(1) / std::numeric_limits<T>::epsilon()))
+        {
+          return x;
+        }
+        using I = std::conditional_t<sizeof(T) <= sizeof(std::int32_t), std::int32_t, std::int64_t>;
+        T const t = static_cast<T>(static_cast<I>(x));
+        return t == T(0) ? x * T(0) : t;
+      }
+      else
+      {
+        return x;
+      }
+    }
+
+    template <typename T>
+    constexpr auto floor(T const x) noexcept -> T
+    {
+      T const t = trunc(x);
+      return t > x ? t - T(1) : t;
+    }
+
+    template <typename T>
+    constexpr auto ceil(T const x) noexcept -> T
+    {
+      T const t = trunc(x);
+      return t < x ? t + T(1) : t;
+    }
+
+    template <typename T>
+    constexpr auto abs(T const x) noexcept -> T
+    {
+      if constexpr (std::is_unsigned<T>::value)
+      {
+        return x;
+      }
+      else
+      {
+        // adding zero turns -0 into 0
+        return x < T(0) ? -x : x + T(0);
+      }
+    }
+
+    template <typename T>
+    constexpr auto sign(T const x) noexcept -> T
+    {
+      return static_cast<T>((T(0) < x) - (x < T(0)));
+    }
+
+    template <typename T>
+    constexpr auto fract(T const x) noexcept -> T
+    {
+      return x - floor(x);
+    }
+
+    /// x - y floor(x / y), for integers the remainder of the division rounded down
+    template <typename T>
+    constexpr auto mod(T const x, T const y) noexcept -> T
+    {
+      if constexpr (std::is_floating_point<T>::value)
+      {
+        return x - y * floor(x / y);
+      }
+      else
+      {
+        T const r = static_cast<T>(x % y);
+        return r != T(0) && ((r < T(0)) != (y < T(0))) ? static_cast<T>(r + y) : r;
+      }
+    }
+
+    template <typename T>
+    constexpr auto clamp(T const x, T const lower, T const upper) noexcept -> T
+    {
+      T const t = x < lower ? lower : x;
+      return upper < t ? upper : t;
+    }
+
+    template <typename T>
+    constexpr auto mix(T const a, T const b, T const t) noexcept -> T
+    {
+      return a * (T(1) - t) + b * t;
+    }
+
+    template <typename T>
+    constexpr auto step(T const edge, T const x) noexcept -> T
+    {
+      return x < edge ? T(0) : T(1);
+    }
+
+    template <typename T>
+    constexpr auto smoothstep(T const edge0, T const edge1, T const x) noexcept -> T
+    {
+      T const t = clamp((x - edge0) / (edge1 - edge0), T(0), T(1));
+      return t * t * (T(3) - T(2) * t);
+    }
+  } // namespace detail::common
+
+  namespace detail::batch
+  {
+    // The operations of the common functions, like the ones in IntVectorFunc.hh
+#if defined(__SSE2__)
+    inline auto trunc(__m128 const x) noexcept -> __m128
+    {
+      __m128 const signBit = _mm_set1_ps(-0.0f);
+      __m128 const whole = _mm_cmplt_ps(_mm_andnot_ps(signBit, x), _mm_set1_ps(8388608.0f));
+      __m128 const t = _mm_or_ps(_mm_cvtepi32_ps(_mm_cvttps_epi32(x)), _mm_and_ps(x, signBit));
+      return _mm_or_ps(_mm_and_ps(whole, t), _mm_andnot_ps(whole, x));
+    }
+
+    inline auto floor(__m128 const x) noexcept -> __m128
+    {
+      __m128 const t = trunc(x);
+      return _mm_sub_ps(t, _mm_and_ps(_mm_cmpgt_ps(t, x), _mm_set1_ps(1.0f)));
+    }
+
+    inline auto clamp(__m128 const x, __m128 const lower, __m128 const upper) noexcept -> __m128
+    {
+      return _mm_min_ps(upper, _mm_max_ps(lower, x));
+    }
+#endif
+
+    struct Abs
+    {
+      template <typename T>
+      static constexpr auto apply(T const x) noexcept -> T { return detail::common::abs(x); }
+#if defined(__SSE2__)
+      template <typename T>
+      static constexpr bool Simd = std::is_same<T, float>::value;
+      static auto apply(__m128 x, float) noexcept -> __m128 { return _mm_andnot_ps(_mm_set1_ps(-0.0f), x); }
+#endif
+    };
+
+    struct Sign
+    {
+      template <typename T>
+      static constexpr auto apply(T const x) noexcept -> T { return detail::common::sign(x); }
+#if defined(__SSE2__)
+      template <typename T>
+      static constexpr bool Simd = std::is_same<T, float>::value;
+      static auto apply(__m128 x, float) noexcept -> __m128
+      {
+        __m128 const one = _mm_set1_ps(1.0f);
+        __m128 const zero = _mm_setzero_ps();
+        return _mm_sub_ps(_mm_and_ps(_mm_cmpgt_ps(x, zero), one), _mm_and_ps(_mm_cmplt_ps(x, zero), one));
+      }
+#endif
+    };
+
+    struct Floor
+    {
+      template <typename T>
+      static constexpr auto apply(T const x) noexcept -> T { return detail::common::floor(x); }
+#if defined(__SSE2__)
+      template <typename T>
+      static constexpr bool Simd = std::is_same<T, float>::value;
+      static auto apply(__m128 x, float) noexcept -> __m128 { return floor(x); }
+#endif
+    };
+
+    struct Ceil
+    {
+      template <typename T>
+      static constexpr auto apply(T const x) noexcept -> T { return detail::common::ceil(x); }
+#if defined(__SSE2__)
+      template <typename T>
+      static constexpr bool Simd = std::is_same<T, float>::value;
+      // subtracting -1 rather than adding 1 keeps -0 for x in (-1, 0)
+      static auto apply(__m128 x, float) noexcept -> __m128
+      {
+        __m128 const t = trunc(x);
+        return _mm_sub_ps(t, _mm_and_ps(_mm_cmplt_ps(t, x), _mm_set1_ps(-1.0f)));
+      }
+#endif
+    };
+
+    struct Fract
+    {
+      template <typename T>
+      static constexpr auto apply(T const x) noexcept -> T { return detail::common::fract(x); }
+#if defined(__SSE2__)
+      template <typename T>
+      static constexpr bool Simd = std::is_same<T, float>::value;
+      static auto apply(__m128 x, float) noexcept -> __m128 { return _mm_sub_ps(x, floor(x)); }
+#endif
+    };
+
+    struct Mod
+    {
+      template <typename T>
+      static constexpr auto apply(T const x, T const y) noexcept -> T { return detail::common::mod(x, y); }
+#if defined(__SSE2__)
+      template <typename T>
+      static constexpr bool Simd = std::is_same<T, float>::value;
+      static auto apply(__m128 x, __m128 y, float) noexcept -> __m128
+      {
+        return _mm_sub_ps(x, _mm_mul_ps(y, floor(_mm_div_ps(x, y))));
+      }
+#endif
+    };
+
+    struct Step
+    {
+      template <typename T>
+      static constexpr auto apply(T const edge, T const x) noexcept -> T { return detail::common::step(edge, x); }
+#if defined(__SSE2__)
+      template <typename T>
+      static constexpr bool Simd = std::is_same<T, float>::value;
+      static auto apply(__m128 edge, __m128 x, float) noexcept -> __m128
+      {
+        return _mm_andnot_ps(_mm_cmplt_ps(x, edge), _mm_set1_ps(1.0f));
+      }
+#endif
+    };
+
+    struct Clamp
+    {
+      template <typename T>
+      static constexpr auto apply(T const x, T const lower, T const upper) noexcept -> T
+      {
+        return detail::common::clamp(x, lower, upper);
+      }
+#if defined(__SSE2__)
+      template <typename T>
+      static constexpr bool Simd = std::is_same<T, float>::value;
+      static auto apply(__m128 x, __m128 lower, __m128 upper, float) noexcept -> __m128
+      {
+        return clamp(x, lower, upper);
+      }
+#endif
+    };
+
+    struct Mix
+    {
+      template <typename T>
+      static constexpr auto apply(T const a, T const b, T const t) noexcept -> T
+      {
+        return detail::common::mix(a, b, t);
+      }
+#if defined(__SSE2__)
+      template <typename T>
+      static constexpr bool Simd = std::is_same<T, float>::value;
+      static auto apply(__m128 a, __m128 b, __m128 t, float) noexcept -> __m128
+      {
+        return _mm_add_ps(_mm_mul_ps(a, _mm_sub_ps(_mm_set1_ps(1.0f), t)), _mm_mul_ps(b, t));
+      }
+#endif
+    };
+
+    struct Smoothstep
+    {
+      template <typename T>
+      static constexpr auto apply(T const edge0, T const edge1, T const x) noexcept -> T
+      {
+        return detail::common::smoothstep(edge0, edge1, x);
+      }
+#if defined(__SSE2__)
+      template <typename T>
+      static constexpr bool Simd = std::is_same<T, float>::value;
+      static auto apply(__m128 edge0, __m128 edge1, __m128 x, float) noexcept -> __m128
+      {
+        __m128 const t = clamp(_mm_div_ps(_mm_sub_ps(x, edge0), _mm_sub_ps(edge1, edge0)), _mm_setzero_ps(),
+                               _mm_set1_ps(1.0f));
+        return _mm_mul_ps(_mm_mul_ps(t, t), _mm_sub_ps(_mm_set1_ps(3.0f), _mm_add_ps(t, t)));
+      }
+#endif
+    };
+  } // namespace detail::batch
+
+  //==========================================================================
+  /// @name Scalar Functions
+  //==========================================================================
+  ///@{
+
+  /// The absolute value of x
+  template <typename T, typename = detail::common::EnableIfArithmetic<T>>
+  inline constexpr auto abs(T const x) noexcept -> T
+  {
+    return detail::common::abs(x);
+  }
+
+  /// 1 if x is positive, -1 if it is negative and 0 otherwise
+  template <typename T, typename = detail::common::EnableIfArithmetic<T>>
+  inline constexpr auto sign(T const x) noexcept -> T
+  {
+    return detail::common::sign(x);
+  }
+
+  /// The largest whole number not greater than x
+  template <typename T, typename = detail::common::EnableIfArithmetic<T>>
+  inline constexpr auto floor(T const x) noexcept -> T
+  {
+    return detail::common::floor(x);
+  }
+
+  /// The smallest whole number not less than x
+  template <typename T, typename = detail::common::EnableIfArithmetic<T>>
+  inline constexpr auto ceil(T const x) noexcept -> T
+  {
+    return detail::common::ceil(x);
+  }
+
+  /// x - floor(x)
+  template <typename T, typename = detail::common::EnableIfArithmetic<T>>
+  inline constexpr auto fract(T const x) noexcept -> T
+  {
+    return detail::common::fract(x);
+  }
+
+  /// x - y floor(x / y), which has the sign of y
+  template <typename T, typename = detail::common::EnableIfArithmetic<T>>
+  inline constexpr auto mod(T const x, T const y) noexcept -> T
+  {
+    return detail::common::mod(x, y);
+  }
+
+  /// min(max(x, lower), upper)
+  template <typename T, typename = detail::common::EnableIfArithmetic<T>>
+  inline constexpr auto clamp(T const x, T const lower, T const upper) noexcept -> T
+  {
+    return detail::common::clamp(x, lower, upper);
+  }
+
+  /// a (1 - t) + b t, exactly a at t = 0 and exactly b at t = 1
+  template <typename T, typename = detail::common::EnableIfArithmetic<T>>
+  inline constexpr auto mix(T const a, T const b, T const t) noexcept -> T
+  {
+    return detail::common::mix(a, b, t);
+  }
+
+  /// 0 if x < edge and 1 otherwise
+  template <typename T, typename = detail::common::EnableIfArithmetic<T>>
+  inline constexpr auto step(T const edge, T const x) noexcept -> T
+  {
+    return detail::common::step(edge, x);
+  }
+
+  /// Hermite interpolation from 0 at edge0 to 1 at edge1
+  template <typename T, typename = detail::common::EnableIfArithmetic<T>>
+  inline constexpr auto smoothstep(T const edge0, T const edge1, T const x) noexcept -> T
+  {
+    return detail::common::smoothstep(edge0, edge1, x);
+  }
+
+  ///@}
+
+  //==========================================================================
+  /// @name Single Vector Functions
+  //==========================================================================
+  ///@{
+
+  /**
+   * Computes the component wise absolute value of v.
+   *
+   * @tparam T The type of the components
+   * @tparam N The number of components
+   *
+   * @param v A Vector
+   * @return abs(v[i]) for each component
+   */
+  template <typename T, std::size_t N, typename Space>
+  inline constexpr auto abs(Vector<T, N, Space> v) noexcept -> Vector<T, N, Space>
+  {
+    detail::vector::forEachIndex<N>([&](std::size_t i) { v[i] = detail::common::abs(v[i]); });
+    return v;
+  }
+
+  /**
+   * Computes the component wise sign of v.
+   *
+   * @param v A Vector
+   * @return 1, 0 or -1 for each component
+   */
+  template <typename T, std::size_t N, typename Space>
+  inline constexpr auto sign(Vector<T, N, Space> v) noexcept -> Vector<T, N, Space>
+  {
+    detail::vector::forEachIndex<N>([&](std::size_t i) { v[i] = detail::common::sign(v[i]); });
+    return v;
+  }
+
+  /**
+   * Rounds each component of v down.
+   *
+   * @param v A Vector
+   * @return floor(v[i]) for each component
+   */
+  template <typename T, std::size_t N, typename Space>
+  inline constexpr auto floor(Vector<T, N, Space> v) noexcept -> Vector<T, N, Space>
+  {
+    detail::vector::forEachIndex<N>([&](std::size_t i) { v[i] = detail::common::floor(v[i]); });
+    return v;
+  }
+
+  /**
+   * Rounds each component of v up.
+   *
+   * @param v A Vector
+   * @return ceil(v[i]) for each component
+   */
+  template <typename T, std::size_t N, typename Space>
+  inline constexpr auto ceil(Vector<T, N, Space> v) noexcept -> Vector<T, N, Space>
+  {
+    detail::vector::forEachIndex<N>([&](std::size_t i) { v[i] = detail::common::ceil(v[i]); });
+    return v;
+  }
+
+  /**
+   * Computes the fractional part of each component of v.
+   *
+   * @param v A Vector
+   * @return v[i] - floor(v[i]) for each component, in [0, 1]
+   */
+  template <typename T, std::size_t N, typename Space>
+  inline constexpr auto fract(Vector<T, N, Space> v) noexcept -> Vector<T, N, Space>
+  {
+    detail::vector::forEachIndex<N>([&](std::size_t i) { v[i] = detail::common::fract(v[i]); });
+    return v;
+  }
+
+  /**
+   * Computes the component wise modulus of x and y.
+   *
+   * @param x A Vector
+   * @param y A Vector of divisors
+   * @return x[i] - y[i] floor(x[i] / y[i]) for each component
+   */
+  template <typename T, std::size_t N, typename Space>
+  inline constexpr auto mod(Vector<T, N, Space> x, Vector<T, N, Space> const &y) noexcept -> Vector<T, N, Space>
+  {
+    detail::vector::forEachIndex<N>([&](std::size_t i) { x[i] = detail::common::mod(x[i], y[i]); });
+    return x;
+  }
+
+  /// mod with the same divisor for every component
+  template <typename T, std::size_t N, typename Space>
+  inline constexpr auto mod(Vector<T, N, Space> x, T const y) noexcept -> Vector<T, N, Space>
+  {
+    detail::vector::forEachIndex<N>([&](std::size_t i) { x[i] = detail::common::mod(x[i], y); });
+    return x;
+  }
+
+  /// min with the same bound for every component
+  template <typename T, std::size_t N, typename Space>
+  inline constexpr auto min(Vector<T, N, Space> const &lhs, T const rhs) noexcept -> Vector<T, N, Space>
+  {
+    return min(lhs, Vector<T, N, Space>(rhs));
+  }
+
+  /// max with the same bound for every component
+  template <typename T, std::size_t N, typename Space>
+  inline constexpr auto max(Vector<T, N, Space> const &lhs, T const rhs) noexcept -> Vector<T, N, Space>
+  {
+    return max(lhs, Vector<T, N, Space>(rhs));
+  }
+
+  /**
+   * Limits each component of x to the range of the matching components of
+   * lower and upper.
+   *
+   * @param x A Vector
+   * @param lower A Vector of lower bounds
+   * @param upper A Vector of upper bounds
+   * @return min(max(x, lower), upper)
+   */
+  template <typename T, std::size_t N, typename Space>
+  inline constexpr auto clamp(Vector<T, N, Space> const &x, Vector<T, N, Space> const &lower,
+                              Vector<T, N, Space> const &upper) noexcept -> Vector<T, N, Space>
+  {
+    return min(max(x, lower), upper);
+  }
+
+  /// clamp with the same bounds for every component
+  template <typename T, std::size_t N, typename Space>
+  inline constexpr auto clamp(Vector<T, N, Space> const &x, T const lower, T const upper) noexcept
+      -> Vector<T, N, Space>
+  {
+    return min(max(x, lower), upper);
+  }
+
+  /**
+   * Linearly interpolates between a and b component wise.
+   *
+   * @param a A Vector, the result where t is 0
+   * @param b A Vector, the result where t is 1
+   * @param t A Vector of weights
+   * @return a (1 - t) + b t for each component
+   */
+  template <typename T, std::size_t N, typename Space>
+  inline constexpr auto mix(Vector<T, N, Space> a, Vector<T, N, Space> const &b,
+                            Vector<T, N, Space> const &t) noexcept -> Vector<T, N, Space>
+  {
+    detail::vector::forEachIndex<N>([&](std::size_t i) { a[i] = detail::common::mix(a[i], b[i], t[i]); });
+    return a;
+  }
+
+  /// mix with the same weight for every component
+  template <typename T, std::size_t N, typename Space>
+  inline constexpr auto mix(Vector<T, N, Space> a, Vector<T, N, Space> const &b, T const t) noexcept
+      -> Vector<T, N, Space>
+  {
+    detail::vector::forEachIndex<N>([&](std::size_t i) { a[i] = detail::common::mix(a[i], b[i], t); });
+    return a;
+  }
+
+  /**
+   * Compares each component of x with an edge.
+   *
+   * @param edge A Vector of edges
+   * @param x A Vector
+   * @return 0 where x[i] < edge[i] and 1 elsewhere
+   */
+  template <typename T, std::size_t N, typename Space>
+  inline constexpr auto step(Vector<T, N, Space> const &edge, Vector<T, N, Space> x) noexcept
+      -> Vector<T, N, Space>
+  {
+    detail::vector::forEachIndex<N>([&](std::size_t i) { x[i] = detail::common::step(edge[i], x[i]); });
+    return x;
+  }
+
+  /// step with the same edge for every component
+  template <typename T, std::size_t N, typename Space>
+  inline constexpr auto step(T const edge, Vector<T, N, Space> x) noexcept -> Vector<T, N, Space>
+  {
+    detail::vector::forEachIndex<N>([&](std::size_t i) { x[i] = detail::common::step(edge, x[i]); });
+    return x;
+  }
+
+  /**
+   * Hermite interpolation from 0 to 1 between two edges, component wise.
+   *
+   * @param edge0 A Vector of edges where the result is 0
+   * @param edge1 A Vector of edges where the result is 1
+   * @param x A Vector
+   * @return t t (3 - 2 t) with t = clamp((x - edge0) / (edge1 - edge0), 0, 1)
+   */
+  template <typename T, std::size_t N, typename Space>
+  inline constexpr auto smoothstep(Vector<T, N, Space> const &edge0, Vector<T, N, Space> const &edge1,
+                                   Vector<T, N, Space> x) noexcept -> Vector<T, N, Space>
+  {
+    detail::vector::forEachIndex<N>(
+        [&](std::size_t i) { x[i] = detail::common::smoothstep(edge0[i], edge1[i], x[i]); });
+    return x;
+  }
+
+  /// smoothstep with the same edges for every component
+  template <typename T, std::size_t N, typename Space>
+  inline constexpr auto smoothstep(T const edge0, T const edge1, Vector<T, N, Space> x) noexcept
+      -> Vector<T, N, Space>
+  {
+    detail::vector::forEachIndex<N>([&](std::size_t i) { x[i] = detail::common::smoothstep(edge0, edge1, x[i]); });
+    return x;
+  }
+
+  ///@}
+
+  /**
+   * @brief Functions applied to arrays of vectors.
+   *
+   * As in IntVectorFunc.hh each function processes count vectors, and
+   * arrays of float are processed four components at a time with SSE2.  The
+   * scalar arguments apply to every component.
+   */
+  namespace batch
+  {
+    /// out[i] = abs(v[i])
+    template <typename T, std::size_t N, typename Space>
+    inline auto abs(Vector<T, N, Space> const *v, Vector<T, N, Space> *out, std::size_t const count) noexcept -> void
+    {
+      using namespace detail::batch;
+      transform<Abs>(flatten(out), count * N, flatten(v));
+    }
+
+    /// out[i] = sign(v[i])
+    template <typename T, std::size_t N, typename Space>
+    inline auto sign(Vector<T, N, Space> const *v, Vector<T, N, Space> *out, std::size_t const count) noexcept -> void
+    {
+      using namespace detail::batch;
+      transform<Sign>(flatten(out), count * N, flatten(v));
+    }
+
+    /// out[i] = floor(v[i])
+    template <typename T, std::size_t N, typename Space>
+    inline auto floor(Vector<T, N, Space> const *v, Vector<T, N, Space> *out, std::size_t const count) noexcept -> void
+    {
+      using namespace detail::batch;
+      transform<Floor>(flatten(out), count * N, flatten(v));
+    }
+
+    /// out[i] = ceil(v[i])
+    template <typename T, std::size_t N, typename Space>
+    inline auto ceil(Vector<T, N, Space> const *v, Vector<T, N, Space> *out, std::size_t const count) noexcept -> void
+    {
+      using namespace detail::batch;
+      transform<Ceil>(flatten(out), count * N, flatten(v));
+    }
+
+    /// out[i] = fract(v[i])
+    template <typename T, std::size_t N, typename Space>
+    inline auto fract(Vector<T, N, Space> const *v, Vector<T, N, Space> *out, std::size_t const count) noexcept -> void
+    {
+      using namespace detail::batch;
+      transform<Fract>(flatten(out), count * N, flatten(v));
+    }
+
+    /// out[i] = mod(x[i], y[i])
+    template <typename T, std::size_t N, typename Space>
+    inline auto mod(Vector<T, N, Space> const *x, Vector<T, N, Space> const *y, Vector<T, N, Space> *out,
+                    std::size_t const count) noexcept -> void
+    {
+      using namespace detail::batch;
+      transform<Mod>(flatten(out), count * N, flatten(x), flatten(y));
+    }
+
+    /// out[i] = mod(x[i], y)
+    template <typename T, std::size_t N, typename Space>
+    inline auto mod(Vector<T, N, Space> const *x, T const y, Vector<T, N, Space> *out,
+                    std::size_t const count) noexcept -> void
+    {
+      using namespace detail::batch;
+      transform<Mod>(flatten(out), count * N, flatten(x), y);
+    }
+
+    /// out[i] = clamp(x[i], lower[i], upper[i])
+    template <typename T, std::size_t N, typename Space>
+    inline auto clamp(Vector<T, N, Space> const *x, Vector<T, N, Space> const *lower, Vector<T, N, Space> const *upper,
+                      Vector<T, N, Space> *out, std::size_t const count) noexcept -> void
+    {
+      using namespace detail::batch;
+      transform<Clamp>(flatten(out), count * N, flatten(x), flatten(lower), flatten(upper));
+    }
+
+    /// out[i] = clamp(x[i], lower, upper)
+    template <typename T, std::size_t N, typename Space>
+    inline auto clamp(Vector<T, N, Space> const *x, T const lower, T const upper, Vector<T, N, Space> *out,
+                      std::size_t const count) noexcept -> void
+    {
+      using namespace detail::batch;
+      transform<Clamp>(flatten(out), count * N, flatten(x), lower, upper);
+    }
+
+    /// out[i] = mix(a[i], b[i], t[i])
+    template <typename T, std::size_t N, typename Space>
+    inline auto mix(Vector<T, N, Space> const *a, Vector<T, N, Space> const *b, Vector<T, N, Space> const *t,
+                    Vector<T, N, Space> *out, std::size_t const count) noexcept -> void
+    {
+      using namespace detail::batch;
+      transform<Mix>(flatten(out), count * N, flatten(a), flatten(b), flatten(t));
+    }
+
+    /// out[i] = mix(a[i], b[i], t)
+    template <typename T, std::size_t N, typename Space>
+    inline auto mix(Vector<T, N, Space> const *a, Vector<T, N, Space> const *b, T const t, Vector<T, N, Space> *out,
+                    std::size_t const count) noexcept -> void
+    {
+      using namespace detail::batch;
+      transform<Mix>(flatten(out), count * N, flatten(a), flatten(b), t);
+    }
+
+    /// out[i] = step(edge[i], x[i])
+    template <typename T, std::size_t N, typename Space>
+    inline auto step(Vector<T, N, Space> const *edge, Vector<T, N, Space> const *x, Vector<T, N, Space> *out,
+                     std::size_t const count) noexcept -> void
+    {
+      using namespace detail::batch;
+      transform<Step>(flatten(out), count * N, flatten(edge), flatten(x));
+    }
+
+    /// out[i] = step(edge, x[i])
+    template <typename T, std::size_t N, typename Space>
+    inline auto step(T const edge, Vector<T, N, Space> const *x, Vector<T, N, Space> *out,
+                     std::size_t const count) noexcept -> void
+    {
+      using namespace detail::batch;
+      transform<Step>(flatten(out), count * N, edge, flatten(x));
+    }
+
+    /// out[i] = smoothstep(edge0[i], edge1[i], x[i])
+    template <typename T, std::size_t N, typename Space>
+    inline auto smoothstep(Vector<T, N, Space> const *edge0, Vector<T, N, Space> const *edge1,
+                           Vector<T, N, Space> const *x, Vector<T, N, Space> *out,
+                           std::size_t const count) noexcept -> void
+    {
+      using namespace detail::batch;
+      transform<Smoothstep>(flatten(out), count * N, flatten(edge0), flatten(edge1), flatten(x));
+    }
+
+    /// out[i] = smoothstep(edge0, edge1, x[i])
+    template <typename T, std::size_t N, typename Space>
+    inline auto smoothstep(T const edge0, T const edge1, Vector<T, N, Space> const *x, Vector<T, N, Space> *out,
+                           std::size_t const count) noexcept -> void
+    {
+      using namespace detail::batch;
+      transform<Smoothstep>(flatten(out), count * N, edge0, edge1, flatten(x));
+    }
+  } // namespace batch
+
+} // namespace cagey::math
@@ -0,0 +1,582 @@
+//=============================================================================
+//
+// cagey-math - C++-17 Vector Math Library
+// Copyright (c) 2020 Kyle Girard <theycallmecoach@gmail.com>
+//
+// The MIT License (MIT)
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+//=============================================================================
+
+#pragma once
+
+/**
+ * @file
+ * @brief 2D and 3D convex hulls of point sets
+ */
+
+#include <algorithm>
+#include <array>
+#include <cassert>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <mutex>
+#include <unordered_map>
+#include <vector>
+
+#include "cagey-math/Vector2.hh"
+#include "cagey-math/Vector3.hh"
+#include "cagey-math/VectorFunc.hh"
+#include "cagey-math/detail/Parallel.hh"
+
+namespace cagey::math
+{
+
+  /**
+   * @brief A closed triangle mesh bounding a convex point set
+   *
+   * @tparam T the type of elements of the vertices
+   */
+  template <typename T>
+  struct ConvexHull
+  {
+    std::vector<Vector<T, 3>> vertices;             ///< the hull vertices
+    std::vector<std::array<std::uint32_t, 3>> faces; ///< counter clockwise seen from outside
+  };
+
+  namespace detail::hull
+  {
+    /// Points are split into ranges of at least this many points per thread
+    constexpr std::size_t Grain = 1 << 14;
+
+    template <typename T>
+    inline auto lexicographicLess(Vector<T, 2> const &lhs, Vector<T, 2> const &rhs) noexcept -> bool
+    {
+      return lhs[0] < rhs[0] || (lhs[0] == rhs[0] && lhs[1] < rhs[1]);
+    }
+
+    /**
+     * Andrew's monotone chain, points is sorted and deduplicated in place.
+     */
+    template <typename T>
+    inline auto monotoneChain(std::vector<Vector<T, 2>> &points) -> std::vector<Vector<T, 2>>
+    {
+      std::sort(points.begin(), points.end(), lexicographicLess<T>);
+      points.erase(std::unique(points.begin(), points.end()), points.end());
+      if (points.size() < 3)
+      {
+        return points;
+      }
+
+      std::vector<Vector<T, 2>> hull(2 * points.size());
+      std::size_t k = 0;
+      for (std::size_t i = 0; i < points.size(); ++i)
+      {
+        while (k >= 2 && cross(hull[k - 1] - hull[k - 2], points[i] - hull[k - 2]) <= T{0})
+        {
+          --k;
+        }
+        hull[k++] = points[i];
+      }
+      for (std::size_t i = points.size() - 1, lower = k + 1; i > 0; --i)
+      {
+        while (k >= lower && cross(hull[k - 1] - hull[k - 2], points[i - 1] - hull[k - 2]) <= T{0})
+        {
+          --k;
+        }
+        hull[k++] = points[i - 1];
+      }
+      hull.resize(k - 1);
+      return hull;
+    }
+
+    /**
+     * @brief The extreme points along x, y, x + y and x - y
+     *
+     * The order is counter clockwise: min x, min x + y, min y, max x - y,
+     * max x, max x + y, max y, min x - y.
+     */
+    template <typename T>
+    struct Extremes2
+    {
+      std::array<Vector<T, 2>, 8> points;
+    };
+
+    template <typename T>
+    inline auto projections(Vector<T, 2> const &p) noexcept -> std::array<T, 8>
+    {
+      return {-p[0], -(p[0] + p[1]), -p[1], p[0] - p[1], p[0], p[0] + p[1], p[1], p[1] - p[0]};
+    }
+
+    template <typename T>
+    inline auto merge(Extremes2<T> &lhs, Extremes2<T> const &rhs) noexcept -> void
+    {
+      for (std::size_t k = 0; k < 8; ++k)
+      {
+        if (projections(rhs.points[k])[k] > projections(lhs.points[k])[k])
+        {
+          lhs.points[k] = rhs.points[k];
+        }
+      }
+    }
+
+    /**
+     * Find the extreme points of [begin, end), the projections of a block
+     * are kept in registers and compared without branches.
+     */
+    template <typename T>
+    inline auto extremes(Vector<T, 2> const *points, std::size_t begin, std::size_t end) noexcept -> Extremes2<T>
+    {
+      std::array<std::size_t, 8> best;
+      best.fill(begin);
+      auto bestValue = projections(points[begin]);
+      for (std::size_t i = begin + 1; i < end; ++i)
+      {
+        auto const value = projections(points[i]);
+        for (std::size_t k = 0; k < 8; ++k)
+        {
+          auto const better = value[k] > bestValue[k];
+          bestValue[k] = better ? value[k] : bestValue[k];
+          best[k] = better ? i : best[k];
+        }
+      }
+      Extremes2<T> result;
+      for (std::size_t k = 0; k < 8; ++k)
+      {
+        result.points[k] = points[best[k]];
+      }
+      return result;
+    }
+
+    /**
+     * Akl-Toussaint heuristic, append the points of [begin, end) that are
+     * not strictly inside the polygon through the extreme points.
+     */
+    template <typename T>
+    inline auto filter(Vector<T, 2> const *points, std::size_t begin, std::size_t end,
+                       Extremes2<T> const &e, std::vector<Vector<T, 2>> &out) -> void
+    {
+      std::array<Vector<T, 2>, 8> origins;
+      std::array<Vector<T, 2>, 8> edges;
+      std::size_t edgeCount = 0;
+      for (std::size_t k = 0; k < 8; ++k)
+      {
+        auto const edge = e.points[(k + 1) % 8] - e.points[k];
+        if (edge != Vector<T, 2>::zero())
+        {
+          origins[edgeCount] = e.points[k];
+          edges[edgeCount++] = edge;
+        }
+      }
+      for (std::size_t i = begin; i < end; ++i)
+      {
+        bool inside = edgeCount >= 3;
+        for (std::size_t k = 0; k < edgeCount; ++k)
+        {
+          inside &= cross(edges[k], points[i] - origins[k]) > T{0};
+        }
+        if (!inside)
+        {
+          out.push_back(points[i]);
+        }
+      }
+    }
+  } // namespace detail::hull
+
+  /**
+   * Computes the convex hull of a set of 2D points with Andrew's monotone
+   * chain algorithm.
+   *
+   * Points strictly inside the polygon through the extreme points along
+   * the axes and diagonals are discarded before sorting.  With more than
+   * one thread the points are split into ranges, the hull of each range is
+   * computed in parallel and the final hull is computed from the vertices
+   * of those hulls.
+   *
+   * @param points the points
+   * @param count the number of points
+   * @param threads the number of threads to use, 0 uses one per hardware thread
+   * @return the hull vertices in counter clockwise order without collinear
+   * points, fewer than three if all points are collinear
+   */
+  template <typename T>
+  inline auto convexHull(Vector<T, 2> const *points, std::size_t const count, unsigned int const threads = 0)
+      -> std::vector<Vector<T, 2>>
+  {
+    if (count == 0)
+    {
+      return {};
+    }
+
+    std::mutex mutex;
+    auto bounds = detail::hull::extremes(points, 0, 1);
+    detail::parallelFor(count, threads, detail::hull::Grain, [&](std::size_t begin, std::size_t end) {
+      auto const local = detail::hull::extremes(points, begin, end);
+      std::lock_guard<std::mutex> lock{mutex};
+      detail::hull::merge(bounds, local);
+    });
+
+    std::vector<Vector<T, 2>> candidates;
+    detail::parallelFor(count, threads, detail::hull::Grain, [&](std::size_t begin, std::size_t end) {
+      std::vector<Vector<T, 2>> local;
+      detail::hull::filter(points, begin, end, bounds, local);
+      auto const hull = detail::hull::monotoneChain(local);
+      std::lock_guard<std::mutex> lock{mutex};
+      candidates.insert(candidates.end(), hull.begin(), hull.end());
+    });
+    return detail::hull::monotoneChain(candidates);
+  }
+
+  namespace detail::hull
+  {
+    template <typename T>
+    struct Face
+    {
+      std::array<std::uint32_t, 3> vertices;
+      Vector<T, 3> normal;
+      T offset;
+      std::vector<std::uint32_t> outside;
+      bool alive;
+    };
+
+    /**
+     * Quickhull over an indexed point set.  Faces keep the points in front
+     * of them, adjacency is found through a map from directed edges to the
+     * face owning them.
+     */
+    template <typename T>
+    class QuickHull
+    {
+    public:
+      QuickHull(Vector<T, 3> const *points, std::size_t count) : mPoints{points}, mCount{count}
+      {
+        assert(count < std::numeric_limits<std::uint32_t>::max());
+      }
+
+      /**
+       * @return the hull, without faces if the points are coplanar
+       */
+      auto build() -> ConvexHull<T>
+      {
+        if (!initialSimplex())
+        {
+          return {};
+        }
+        for (std::size_t f = 0; f < mFaces.size(); ++f)
+        {
+          if (mFaces[f].alive && !mFaces[f].outside.empty())
+          {
+            addPoint(static_cast<std::uint32_t>(f));
+          }
+        }
+        return result();
+      }
+
+    private:
+      static auto edgeKey(std::uint32_t a, std::uint32_t b) noexcept -> std::uint64_t
+      {
+        return (std::uint64_t{a} << 32) | b;
+      }
+
+      auto distance(Face<T> const &face, std::uint32_t p) const noexcept -> T
+      {
+        return dot(face.normal, mPoints[p]) - face.offset;
+      }
+
+      auto addFace(std::uint32_t a, std::uint32_t b, std::uint32_t c) -> void
+      {
+        auto n = cross(mPoints[b] - mPoints[a], mPoints[c] - mPoints[a]);
+        auto const len = length(n);
+        n = len > T{0} ? n / len : n;
+        auto const index = static_cast<std::uint32_t>(mFaces.size());
+        mFaces.push_back({{a, b, c}, n, dot(n, mPoints[a]), {}, true});
+        mEdges[edgeKey(a, b)] = index;
+        mEdges[edgeKey(b, c)] = index;
+        mEdges[edgeKey(c, a)] = index;
+      }
+
+      /**
+       * Add p to the outside set of the first face in [first, last) it is in
+       * front of, points behind all of them are inside the hull.
+       */
+      auto assign(std::uint32_t p, std::size_t first, std::size_t last) -> void
+      {
+        for (auto f = first; f < last; ++f)
+        {
+          if (mFaces[f].alive && distance(mFaces[f], p) > mEpsilon)
+          {
+            mFaces[f].outside.push_back(p);
+            return;
+          }
+        }
+      }
+
+      auto initialSimplex() -> bool
+      {
+        if (mCount < 4)
+        {
+          return false;
+        }
+
+        // extreme points along the axes, found in one pass
+        std::array<std::uint32_t, 6> extreme{};
+        auto scale = T{0};
+        for (std::uint32_t i = 1; i < mCount; ++i)
+        {
+          for (std::size_t axis = 0; axis < 3; ++axis)
+          {
+            auto const value = mPoints[i][axis];
+            extreme[2 * axis] = value < mPoints[extreme[2 * axis]][axis] ? i : extreme[2 * axis];
+            extreme[2 * axis + 1] = value > mPoints[extreme[2 * axis + 1]][axis] ? i : extreme[2 * axis + 1];
+          }
+        }
+        for (std::size_t axis = 0; axis < 3; ++axis)
+        {
+          using std::abs;
+          scale += std::max(abs(mPoints[extreme[2 * axis]][axis]), abs(mPoints[extreme[2 * axis + 1]][axis]));
+        }
+        mEpsilon = T{3} * std::numeric_limits<T>::epsilon() * scale;
+
+        // the most distant pair of extreme points
+        std::uint32_t a = extreme[0];
+        std::uint32_t b = extreme[1];
+        for (std::size_t i = 0; i < 6; ++i)
+        {
+          for (std::size_t j = i + 1; j < 6; ++j)
+          {
+            if (lengthSquared(mPoints[extreme[j]] - mPoints[extreme[i]]) > lengthSquared(mPoints[b] - mPoints[a]))
+            {
+              a = extreme[i];
+              b = extreme[j];
+            }
+          }
+        }
+
+        // the point furthest from line ab, then from plane abc
+        auto const ab = mPoints[b] - mPoints[a];
+        std::uint32_t c = a;
+        auto best = T{0};
+        for (std::uint32_t i = 0; i < mCount; ++i)
+        {
+          auto const d = lengthSquared(cross(mPoints[i] - mPoints[a], ab));
+          if (d > best)
+          {
+            best = d;
+            c = i;
+          }
+        }
+        if (best <= mEpsilon * mEpsilon * lengthSquared(ab))
+        {
+          return false;
+        }
+
+        auto const n = normalize(cross(ab, mPoints[c] - mPoints[a]));
+        std::uint32_t d = a;
+        best = T{0};
+        for (std::uint32_t i = 0; i < mCount; ++i)
+        {
+          using std::abs;
+          auto const h = abs(dot(mPoints[i] - mPoints[a], n));
+          if (h > best)
+          {
+            best = h;
+            d = i;
+          }
+        }
+        if (best <= mEpsilon)
+        {
+          return false;
+        }
+
+        if (dot(mPoints[d] - mPoints[a], n) > T{0})
+        {
+          std::swap(b, c);
+        }
+        addFace(a, b, c);
+        addFace(a, d, b);
+        addFace(b, d, c);
+        addFace(c, d, a);
+
+        for (std::uint32_t i = 0; i < mCount; ++i)
+        {
+          if (i != a && i != b && i != c && i != d)
+          {
+            assign(i, 0, 4);
+          }
+        }
+        return true;
+      }
+
+      auto addPoint(std::uint32_t const seed) -> void
+      {
+        auto const &outside = mFaces[seed].outside;
+        auto const apex = *std::max_element(outside.begin(), outside.end(), [&](std::uint32_t lhs, std::uint32_t rhs) {
+          return distance(mFaces[seed], lhs) < distance(mFaces[seed], rhs);
+        });
+
+        // flood the faces visible from apex, collecting the horizon
+        ++mVisit;
+        mVisited.resize(mFaces.size(), 0);
+        mVisible.assign(1, seed);
+        mVisited[seed] = mVisit;
+        mHorizon.clear();
+        for (std::size_t i = 0; i < mVisible.size(); ++i)
+        {
+          auto const vertices = mFaces[mVisible[i]].vertices;
+          for (std::size_t e = 0; e < 3; ++e)
+          {
+            auto const from = vertices[e];
+            auto const to = vertices[(e + 1) % 3];
+            auto const neighbour = mEdges.at(edgeKey(to, from));
+            if (mVisited[neighbour] == mVisit)
+            {
+              continue;
+            }
+            if (distance(mFaces[neighbour], apex) > mEpsilon)
+            {
+              mVisited[neighbour] = mVisit;
+              mVisible.push_back(neighbour);
+            }
+            else
+            {
+              mHorizon.push_back({from, to});
+            }
+          }
+        }
+
+        // remove the visible faces and rebuild from the horizon
+        mOrphans.clear();
+        for (auto const f : mVisible)
+        {
+          auto &face = mFaces[f];
+          face.alive = false;
+          mOrphans.insert(mOrphans.end(), face.outside.begin(), face.outside.end());
+          std::vector<std::uint32_t>{}.swap(face.outside);
+          for (std::size_t e = 0; e < 3; ++e)
+          {
+            auto const key = edgeKey(face.vertices[e], face.vertices[(e + 1) % 3]);
+            auto const it = mEdges.find(key);
+            if (it != mEdges.end() && it->second == f)
+            {
+              mEdges.erase(it);
+            }
+          }
+        }
+
+        auto const first = mFaces.size();
+        for (auto const &edge : mHorizon)
+        {
+          addFace(edge[0], edge[1], apex);
+        }
+        for (auto const p : mOrphans)
+        {
+          if (p != apex)
+          {
+            assign(p, first, mFaces.size());
+          }
+        }
+      }
+
+      auto result() const -> ConvexHull<T>
+      {
+        ConvexHull<T> hull;
+        std::unordered_map<std::uint32_t, std::uint32_t> remap;
+        for (auto const &face : mFaces)
+        {
+          if (!face.alive)
+          {
+            continue;
+          }
+          std::array<std::uint32_t, 3> triangle;
+          for (std::size_t i = 0; i < 3; ++i)
+          {
+            auto const inserted = remap.emplace(face.vertices[i], static_cast<std::uint32_t>(hull.vertices.size()));
+            if (inserted.second)
+            {
+              hull.vertices.push_back(mPoints[face.vertices[i]]);
+            }
+            triangle[i] = inserted.first->second;
+          }
+          hull.faces.push_back(triangle);
+        }
+        return hull;
+      }
+
+      Vector<T, 3> const *mPoints;
+      std::size_t mCount;
+      T mEpsilon{};
+      std::vector<Face<T>> mFaces;
+      std::unordered_map<std::uint64_t, std::uint32_t> mEdges;
+      std::vector<std::uint32_t> mVisited;
+      std::uint32_t mVisit = 0;
+      std::vector<std::uint32_t> mVisible;
+      std::vector<std::array<std::uint32_t, 2>> mHorizon;
+      std::vector<std::uint32_t> mOrphans;
+    };
+  } // namespace detail::hull
+
+  /**
+   * Computes the convex hull of a set of 3D points with the quickhull
+   * algorithm.
+   *
+   * With more than one thread the points are split into ranges, the hull
+   * of each range is computed in parallel and the final hull is computed
+   * from the vertices of those hulls.  The hull is the same for any number
+   * of threads but the order of its vertices and faces may differ.
+   *
+   * @param points the points
+   * @param count the number of points, less than 2^32
+   * @param threads the number of threads to use, 0 uses one per hardware thread
+   * @return the hull, empty if the points are coplanar
+   */
+  template <typename T>
+  inline auto convexHull(Vector<T, 3> const *points, std::size_t const count, unsigned int const threads = 0)
+      -> ConvexHull<T>
+  {
+    std::mutex mutex;
+    std::vector<Vector<T, 3>> candidates;
+    bool split = false;
+    detail::parallelFor(count, threads, detail::hull::Grain, [&](std::size_t begin, std::size_t end) {
+      if (begin == 0 && end == count)
+      {
+        return;
+      }
+      auto const hull = detail::hull::QuickHull<T>{points + begin, end - begin}.build();
+      std::lock_guard<std::mutex> lock{mutex};
+      split = true;
+      if (hull.faces.empty())
+      {
+        candidates.insert(candidates.end(), points + begin, points + end);
+      }
+      else
+      {
+        candidates.insert(candidates.end(), hull.vertices.begin(), hull.vertices.end());
+      }
+    });
+    if (!split)
+    {
+      return detail::hull::QuickHull<T>{points, count}.build();
+    }
+    return detail::hull::QuickHull<T>{candidates.data(), candidates.size()}.build();
+  }
+
+} // namespace cagey::math
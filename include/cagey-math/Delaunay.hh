@@ -0,0 +1,494 @@
+//=============================================================================
+//
+// cagey-math - C++-17 Vector Math Library
+// Copyright (c) 2020 Kyle Girard <theycallmecoach@gmail.com>
+//
+// The MIT License (MIT)
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+//=============================================================================
+
+#pragma once
+
+/**
+ * @file
+ * @brief Delaunay triangulation of 2D point sets
+ */
+
+#include <algorithm>
+#include <array>
+#include <cassert>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <mutex>
+#include <utility>
+#include <vector>
+
+#include "cagey-math/Predicates.hh"
+#include "cagey-math/Vector2.hh"
+#include "cagey-math/VectorFunc.hh"
+#include "cagey-math/detail/Parallel.hh"
+
+namespace cagey::math
+{
+
+  /**
+   * @brief A triangle mesh in half-edge form stored in flat arrays
+   *
+   * Triangle t consists of the half-edges 3t, 3t + 1 and 3t + 2, half-edge
+   * e starts at vertex triangles[e] and ends at the start of the next
+   * half-edge of its triangle.  Triangles are counter clockwise.
+   */
+  struct Triangulation
+  {
+    /// The value of halfedges for edges on the convex hull
+    static constexpr std::uint32_t NoEdge = std::numeric_limits<std::uint32_t>::max();
+
+    std::vector<std::uint32_t> triangles; ///< start vertex of each half-edge
+    std::vector<std::uint32_t> halfedges; ///< opposite half-edge of each half-edge or NoEdge
+
+    /**
+     * @return the half-edge after e in its triangle
+     */
+    static constexpr auto next(std::uint32_t const e) noexcept -> std::uint32_t
+    {
+      return e % 3 == 2 ? e - 2 : e + 1;
+    }
+
+    /**
+     * @return the half-edge before e in its triangle
+     */
+    static constexpr auto prev(std::uint32_t const e) noexcept -> std::uint32_t
+    {
+      return e % 3 == 0 ? e + 2 : e - 1;
+    }
+  };
+
+  namespace detail::delaunay
+  {
+    /// The vertex at infinity of the ghost triangles around the hull
+    constexpr std::uint32_t Infinite = std::numeric_limits<std::uint32_t>::max();
+    /// Marks a free triangle slot
+    constexpr std::uint32_t Dead = Infinite - 1;
+    /// Points are split into ranges of at least this many points per thread
+    constexpr std::size_t Grain = 1 << 16;
+
+    /**
+     * Interleave the low 16 bits of v with zeros.
+     */
+    constexpr auto spread(std::uint32_t v) noexcept -> std::uint32_t
+    {
+      v &= 0xffff;
+      v = (v | (v << 8)) & 0x00ff00ff;
+      v = (v | (v << 4)) & 0x0f0f0f0f;
+      v = (v | (v << 2)) & 0x33333333;
+      v = (v | (v << 1)) & 0x55555555;
+      return v;
+    }
+
+    /**
+     * Computes the insertion order of points, sorted along a Morton curve
+     * so that consecutive points are close to each other.
+     */
+    inline auto mortonOrder(Vector<double, 2> const *points, std::size_t const count, unsigned int const threads)
+        -> std::vector<std::uint32_t>
+    {
+      auto lo = points[0];
+      auto hi = points[0];
+      for (std::size_t i = 1; i < count; ++i)
+      {
+        lo = min(lo, points[i]);
+        hi = max(hi, points[i]);
+      }
+      auto const extent = hi - lo;
+      Vector<double, 2> const scale{extent[0] > 0.0 ? 65535.0 / extent[0] : 0.0,
+                                    extent[1] > 0.0 ? 65535.0 / extent[1] : 0.0};
+
+      // keys hold the code in the high and the index in the low half
+      std::vector<std::uint64_t> keys(count);
+      std::vector<std::pair<std::size_t, std::size_t>> ranges;
+      std::mutex mutex;
+      detail::parallelFor(count, threads, Grain, [&](std::size_t begin, std::size_t end) {
+        for (auto i = begin; i < end; ++i)
+        {
+          auto const x = static_cast<std::uint32_t>((points[i][0] - lo[0]) * scale[0]);
+          auto const y = static_cast<std::uint32_t>((points[i][1] - lo[1]) * scale[1]);
+          keys[i] = (std::uint64_t{spread(x) | (spread(y) << 1)} << 32) | i;
+        }
+        std::sort(keys.begin() + begin, keys.begin() + end);
+        std::lock_guard<std::mutex> lock{mutex};
+        ranges.emplace_back(begin, end);
+      });
+
+      std::sort(ranges.begin(), ranges.end());
+      while (ranges.size() > 1)
+      {
+        std::vector<std::pair<std::size_t, std::size_t>> merged;
+        for (std::size_t i = 0; i + 1 < ranges.size(); i += 2)
+        {
+          std::inplace_merge(keys.begin() + ranges[i].first, keys.begin() + ranges[i].second,
+                             keys.begin() + ranges[i + 1].second);
+          merged.emplace_back(ranges[i].first, ranges[i + 1].second);
+        }
+        if (ranges.size() % 2 == 1)
+        {
+          merged.push_back(ranges.back());
+        }
+        ranges = std::move(merged);
+      }
+
+      std::vector<std::uint32_t> order(count);
+      for (std::size_t i = 0; i < count; ++i)
+      {
+        order[i] = static_cast<std::uint32_t>(keys[i]);
+      }
+      return order;
+    }
+
+    /**
+     * Incremental Bowyer-Watson triangulation.  The hull is closed with
+     * ghost triangles sharing a vertex at infinity, so points outside the
+     * current hull are inserted like any other point.
+     */
+    class Builder
+    {
+    public:
+      explicit Builder(Vector<double, 2> const *points) : mPoints{points} {}
+
+      /**
+       * Start from the counter clockwise triangle a, b, c.
+       */
+      auto start(std::uint32_t const a, std::uint32_t const b, std::uint32_t const c) -> void
+      {
+        auto const t = allocate(a, b, c);
+        std::uint32_t const vertices[] = {a, b, c};
+        std::uint32_t ghosts[3];
+        for (std::uint32_t i = 0; i < 3; ++i)
+        {
+          ghosts[i] = allocate(vertices[(i + 1) % 3], vertices[i], Infinite);
+          link(3 * t + i, 3 * ghosts[i]);
+        }
+        // ghost i holds edge vertices[i] -> infinity, ghost i - 1 the reverse
+        for (std::uint32_t i = 0; i < 3; ++i)
+        {
+          link(3 * ghosts[i] + 1, 3 * ghosts[(i + 2) % 3] + 2);
+        }
+        mLast = t;
+      }
+
+      /**
+       * Insert point p, duplicates of inserted points are skipped.
+       */
+      auto insert(std::uint32_t const p) -> void
+      {
+        auto const seed = locate(p);
+        if (seed == Dead)
+        {
+          return;
+        }
+
+        // grow the cavity of triangles whose circumcircle contains p
+        ++mStamp;
+        mCavity.clear();
+        mBoundary.clear();
+        mStack.assign(1, seed);
+        mConflict[seed] = mStamp;
+        while (!mStack.empty())
+        {
+          auto const t = mStack.back();
+          mStack.pop_back();
+          mCavity.push_back(t);
+          for (std::uint32_t e = 3 * t; e < 3 * t + 3; ++e)
+          {
+            auto const o = mTwins[e] / 3;
+            if (mConflict[o] == mStamp)
+            {
+              continue;
+            }
+            if (mRejected[o] != mStamp && conflict(o, p))
+            {
+              mConflict[o] = mStamp;
+              mStack.push_back(o);
+            }
+            else
+            {
+              mRejected[o] = mStamp;
+              mBoundary.push_back({mVertices[e], mVertices[Triangulation::next(e)], mTwins[e]});
+            }
+          }
+        }
+
+        for (auto const t : mCavity)
+        {
+          mVertices[3 * t] = Dead;
+          mFree.push_back(t);
+        }
+
+        // connect p to the cavity boundary
+        mStarts.clear();
+        for (auto const &edge : mBoundary)
+        {
+          auto const t = allocate(edge[0], edge[1], p);
+          link(3 * t, edge[2]);
+          mStarts.emplace_back(edge[0], t);
+          if (edge[0] != Infinite && edge[1] != Infinite)
+          {
+            mLast = t;
+          }
+        }
+        for (auto const &start : mStarts)
+        {
+          auto const t = start.second;
+          auto const b = mVertices[3 * t + 1];
+          auto const next = std::find_if(mStarts.begin(), mStarts.end(), [b](auto const &s) { return s.first == b; });
+          link(3 * t + 1, 3 * next->second + 2);
+        }
+      }
+
+      /**
+       * @return the real triangles, ghosts and free slots removed
+       */
+      auto result() const -> Triangulation
+      {
+        std::vector<std::uint32_t> remap(mVertices.size() / 3, Dead);
+        std::uint32_t count = 0;
+        for (std::uint32_t t = 0; t < remap.size(); ++t)
+        {
+          if (real(t))
+          {
+            remap[t] = count++;
+          }
+        }
+
+        Triangulation result;
+        result.triangles.reserve(3 * count);
+        result.halfedges.reserve(3 * count);
+        for (std::uint32_t t = 0; t < remap.size(); ++t)
+        {
+          if (remap[t] == Dead)
+          {
+            continue;
+          }
+          for (std::uint32_t e = 3 * t; e < 3 * t + 3; ++e)
+          {
+            auto const twin = mTwins[e];
+            result.triangles.push_back(mVertices[e]);
+            result.halfedges.push_back(remap[twin / 3] == Dead ? Triangulation::NoEdge
+                                                               : 3 * remap[twin / 3] + twin % 3);
+          }
+        }
+        return result;
+      }
+
+    private:
+      auto allocate(std::uint32_t const a, std::uint32_t const b, std::uint32_t const c) -> std::uint32_t
+      {
+        std::uint32_t t;
+        if (mFree.empty())
+        {
+          t = static_cast<std::uint32_t>(mVertices.size() / 3);
+          mVertices.resize(mVertices.size() + 3);
+          mTwins.resize(mTwins.size() + 3);
+          mConflict.push_back(0);
+          mRejected.push_back(0);
+        }
+        else
+        {
+          t = mFree.back();
+          mFree.pop_back();
+        }
+        mVertices[3 * t] = a;
+        mVertices[3 * t + 1] = b;
+        mVertices[3 * t + 2] = c;
+        return t;
+      }
+
+      auto link(std::uint32_t const a, std::uint32_t const b) noexcept -> void
+      {
+        mTwins[a] = b;
+        mTwins[b] = a;
+      }
+
+      auto real(std::uint32_t const t) const noexcept -> bool
+      {
+        return mVertices[3 * t] != Dead && mVertices[3 * t] != Infinite && mVertices[3 * t + 1] != Infinite &&
+               mVertices[3 * t + 2] != Infinite;
+      }
+
+      /**
+       * @return the half-edge of ghost triangle t between finite vertices
+       */
+      auto ghostEdge(std::uint32_t const t) const noexcept -> std::uint32_t
+      {
+        auto e = 3 * t;
+        while (mVertices[e] == Infinite || mVertices[Triangulation::next(e)] == Infinite)
+        {
+          ++e;
+        }
+        return e;
+      }
+
+      auto point(std::uint32_t const v) const noexcept -> Vector<double, 2> const & { return mPoints[v]; }
+
+      /**
+       * @return true if p lies in the circumcircle of t.  The circumcircle
+       * of a ghost triangle is the open half plane outside its edge plus the
+       * open edge itself.
+       */
+      auto conflict(std::uint32_t const t, std::uint32_t const p) const -> bool
+      {
+        if (real(t))
+        {
+          return inCircle(point(mVertices[3 * t]), point(mVertices[3 * t + 1]), point(mVertices[3 * t + 2]),
+                          point(p)) > 0.0;
+        }
+        auto const e = ghostEdge(t);
+        auto const &a = point(mVertices[e]);
+        auto const &b = point(mVertices[Triangulation::next(e)]);
+        auto const &c = point(p);
+        auto const o = orient2d(a, b, c);
+        if (o != 0.0)
+        {
+          return o > 0.0;
+        }
+        auto const axis = a[0] != b[0] ? 0 : 1;
+        return std::min(a[axis], b[axis]) < c[axis] && c[axis] < std::max(a[axis], b[axis]);
+      }
+
+      /**
+       * Walk from the last created triangle towards p.
+       *
+       * @return a triangle in conflict with p, or Dead if p duplicates a vertex
+       */
+      auto locate(std::uint32_t const p) const -> std::uint32_t
+      {
+        auto t = mLast;
+        auto const &q = point(p);
+        for (std::uint32_t step = 0;; ++step)
+        {
+          auto moved = false;
+          for (std::uint32_t k = 0; k < 3 && !moved; ++k)
+          {
+            auto const e = 3 * t + (k + step) % 3;
+            if (orient2d(point(mVertices[e]), point(mVertices[Triangulation::next(e)]), q) < 0.0)
+            {
+              t = mTwins[e] / 3;
+              moved = true;
+            }
+          }
+          if (!moved)
+          {
+            break;
+          }
+          if (!real(t))
+          {
+            return t;
+          }
+        }
+        for (std::uint32_t e = 3 * t; e < 3 * t + 3; ++e)
+        {
+          if (point(mVertices[e]) == q)
+          {
+            return Dead;
+          }
+        }
+        return t;
+      }
+
+      Vector<double, 2> const *mPoints;
+      std::vector<std::uint32_t> mVertices;
+      std::vector<std::uint32_t> mTwins;
+      std::vector<std::uint32_t> mFree;
+      std::vector<std::uint32_t> mConflict;
+      std::vector<std::uint32_t> mRejected;
+      std::uint32_t mStamp = 0;
+      std::uint32_t mLast = 0;
+      std::vector<std::uint32_t> mStack;
+      std::vector<std::uint32_t> mCavity;
+      std::vector<std::array<std::uint32_t, 3>> mBoundary;
+      std::vector<std::pair<std::uint32_t, std::uint32_t>> mStarts;
+    };
+  } // namespace detail::delaunay
+
+  /**
+   * Computes the Delaunay triangulation of a set of points.
+   *
+   * Points are inserted one at a time in Morton order with the
+   * Bowyer-Watson algorithm, each point located by walking from the
+   * previously created triangle.  All decisions use the robust orient2d and
+   * inCircle predicates.  With more than one thread the Morton codes are
+   * computed and sorted in parallel ranges that are then merged, insertion
+   * itself is sequential.
+   *
+   * @param points the points
+   * @param count the number of points, less than 2^32 - 2
+   * @param threads the number of threads to use, 0 uses one per hardware thread
+   * @return the triangulation indexing into points, empty if all points are
+   * collinear.  Duplicate points are left out.
+   */
+  inline auto delaunay(Vector<double, 2> const *points, std::size_t const count, unsigned int const threads = 0)
+      -> Triangulation
+  {
+    if (count < 3)
+    {
+      return {};
+    }
+    assert(count < detail::delaunay::Dead);
+    auto order = detail::delaunay::mortonOrder(points, count, threads);
+
+    // the first triangle is made of the first two distinct points and the
+    // first point not collinear with them
+    auto const first = order[0];
+    auto const second = std::find_if(order.begin(), order.end(), [&](std::uint32_t i) { return points[i] != points[first]; });
+    if (second == order.end())
+    {
+      return {};
+    }
+    auto const third = std::find_if(second + 1, order.end(), [&](std::uint32_t i) {
+      return orient2d(points[first], points[*second], points[i]) != 0.0;
+    });
+    if (third == order.end())
+    {
+      return {};
+    }
+
+    detail::delaunay::Builder builder{points};
+    if (orient2d(points[first], points[*second], points[*third]) > 0.0)
+    {
+      builder.start(first, *second, *third);
+    }
+    else
+    {
+      builder.start(first, *third, *second);
+    }
+    auto const secondIndex = *second;
+    auto const thirdIndex = *third;
+    for (auto const i : order)
+    {
+      if (i != first && i != secondIndex && i != thirdIndex)
+      {
+        builder.insert(i);
+      }
+    }
+    return builder.result();
+  }
+
+} // namespace cagey::math
@@ -0,0 +1,457 @@
+//=============================================================================
+//
+// cagey-math - C++-17 Vector Math Library
+// Copyright (c) 2020 Kyle Girard <theycallmecoach@gmail.com>
+//
+// The MIT License (MIT)
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+//=============================================================================
+
+#pragma once
+
+/**
+ * @file
+ * @brief Double-double element type, about 106 bits of precision
+ *
+ * A DoubleDouble holds a value as the unevaluated sum of two doubles, the
+ * low part being at most half a unit in the last place of the high part.
+ * Arithmetic is built from error free transformations, sums and products of
+ * doubles returned together with their exact rounding error, using fused
+ * multiply add when the target has it.  The relative error of each
+ * operation is a small multiple of 2^-106, except near overflow and
+ * underflow where the low part is lost.  DoubleDouble composes through the
+ * Vector and Matrix operators, dot and cross.  The batch functions process
+ * two values at a time with SSE2.
+ */
+
+#include <cmath>
+#include <cstddef>
+#include <type_traits>
+
+#if defined(__SSE2__)
+#include <emmintrin.h>
+#endif
+#if defined(__FMA__)
+#include <immintrin.h>
+#endif
+
+#include "cagey-math/detail/vec_type.hh"
+
+namespace cagey::math
+{
+  namespace detail::doubledouble
+  {
+    /// A value and its rounding error, or the high and low part of a DoubleDouble
+    template <typename V>
+    struct Parts
+    {
+      V hi; ///< rounded value
+      V lo; ///< what rounding left out
+    };
+
+#if defined(__SSE2__)
+    struct Double2
+    {
+      __m128d v;
+
+      Double2(__m128d const value) noexcept : v{value} {}
+
+      Double2(double const value) noexcept : v{_mm_set1_pd(value)} {}
+    };
+
+    inline auto operator+(Double2 const lhs, Double2 const rhs) noexcept -> Double2 { return _mm_add_pd(lhs.v, rhs.v); }
+
+    inline auto operator-(Double2 const lhs, Double2 const rhs) noexcept -> Double2 { return _mm_sub_pd(lhs.v, rhs.v); }
+
+    inline auto operator*(Double2 const lhs, Double2 const rhs) noexcept -> Double2 { return _mm_mul_pd(lhs.v, rhs.v); }
+
+    inline auto operator/(Double2 const lhs, Double2 const rhs) noexcept -> Double2 { return _mm_div_pd(lhs.v, rhs.v); }
+
+    inline auto operator-(Double2 const value) noexcept -> Double2 { return _mm_xor_pd(value.v, _mm_set1_pd(-0.0)); }
+#endif
+
+    /// a + b exactly, provided |a| >= |b| or a is zero
+    template <typename V>
+    constexpr auto fastTwoSum(V const a, V const b) noexcept -> Parts<V>
+    {
+      V const s = a + b;
+      return {s, b - (s - a)};
+    }
+
+    /// a + b exactly
+    template <typename V>
+    constexpr auto twoSum(V const a, V const b) noexcept -> Parts<V>
+    {
+      V const s = a + b;
+      V const bb = s - a;
+      return {s, (a - (s - bb)) + (b - bb)};
+    }
+
+    /// a * b - p exactly, where p is a * b rounded
+    inline auto productError(double const a, double const b, double const p) noexcept -> double
+    {
+#if defined(__FMA__)
+      return std::fma(a, b, -p);
+#else
+      // Dekker's product, each factor split into two halves of 26 bits whose products are exact
+      double const ta = 134217729.0 * a;
+      double const ah = ta - (ta - a);
+      double const tb = 134217729.0 * b;
+      double const bh = tb - (tb - b);
+      return ((ah * bh - p) + ah * (b - bh) + (a - ah) * bh) + (a - ah) * (b - bh);
+#endif
+    }
+
+#if defined(__SSE2__)
+    inline auto productError(Double2 const a, Double2 const b, Double2 const p) noexcept -> Double2
+    {
+#if defined(__FMA__)
+      return _mm_fmsub_pd(a.v, b.v, p.v);
+#else
+      Double2 const split{134217729.0};
+      Double2 const ta = split * a;
+      Double2 const ah = ta - (ta - a);
+      Double2 const tb = split * b;
+      Double2 const bh = tb - (tb - b);
+      return ((ah * bh - p) + ah * (b - bh) + (a - ah) * bh) + (a - ah) * (b - bh);
+#endif
+    }
+#endif
+
+    /// a * b exactly
+    template <typename V>
+    inline auto twoProduct(V const a, V const b) noexcept -> Parts<V>
+    {
+      V const p = a * b;
+      return {p, productError(a, b, p)};
+    }
+
+    // The kernels below work on double or, with SSE2, on two values at once
+
+    template <typename V>
+    inline auto sum(Parts<V> const &a, Parts<V> const &b) noexcept -> Parts<V>
+    {
+      Parts<V> const s = twoSum(a.hi, b.hi);
+      Parts<V> const t = twoSum(a.lo, b.lo);
+      Parts<V> const u = fastTwoSum(s.hi, s.lo + t.hi);
+      return fastTwoSum(u.hi, u.lo + t.lo);
+    }
+
+    template <typename V>
+    inline auto difference(Parts<V> const &a, Parts<V> const &b) noexcept -> Parts<V>
+    {
+      return sum(a, Parts<V>{-b.hi, -b.lo});
+    }
+
+    template <typename V>
+    inline auto product(Parts<V> const &a, Parts<V> const &b) noexcept -> Parts<V>
+    {
+      Parts<V> const p = twoProduct(a.hi, b.hi);
+      return fastTwoSum(p.hi, p.lo + (a.hi * b.lo + a.lo * b.hi));
+    }
+
+    template <typename V>
+    inline auto product(Parts<V> const &a, V const b) noexcept -> Parts<V>
+    {
+      Parts<V> const p = twoProduct(a.hi, b);
+      return fastTwoSum(p.hi, p.lo + a.lo * b);
+    }
+
+    /// a / b as q = a.hi / b.hi corrected by the remainder a - q b
+    template <typename V>
+    inline auto quotient(Parts<V> const &a, Parts<V> const &b) noexcept -> Parts<V>
+    {
+      V const q = a.hi / b.hi;
+      Parts<V> const r = difference(a, product(b, q));
+      return fastTwoSum(q, r.hi / b.hi);
+    }
+  } // namespace detail::doubledouble
+
+  /**
+   * A floating point number of about 32 significant decimal digits with the
+   * range of double.
+   */
+  class DoubleDouble
+  {
+  public:
+    /**
+     * Default construct a DoubleDouble, the value is uninitialized unless
+     * value initialized.
+     */
+    DoubleDouble() = default;
+
+    /**
+     * Construct a DoubleDouble holding exactly value.  Implicit so that
+     * numbers mix with DoubleDouble in expressions.
+     *
+     * @param value the value
+     */
+    constexpr DoubleDouble(double const value) noexcept : hi{value}, lo{0.0} {}
+
+    /**
+     * Construct a DoubleDouble from its parts, as returned by high() and
+     * low().  Use exactSum() for two arbitrary doubles.
+     *
+     * @param high the value rounded to double
+     * @param low the rest, at most half a unit in the last place of high
+     */
+    constexpr DoubleDouble(double const high, double const low) noexcept : hi{high}, lo{low} {}
+
+    /// The value rounded to double
+    constexpr auto high() const noexcept -> double { return hi; }
+
+    /// The difference between the value and high()
+    constexpr auto low() const noexcept -> double { return lo; }
+
+    /// The value rounded to double
+    explicit constexpr operator double() const noexcept { return hi; }
+
+    auto operator+=(DoubleDouble const &other) noexcept -> DoubleDouble & { return *this = *this + other; }
+
+    auto operator-=(DoubleDouble const &other) noexcept -> DoubleDouble & { return *this = *this - other; }
+
+    auto operator*=(DoubleDouble const &other) noexcept -> DoubleDouble & { return *this = *this * other; }
+
+    auto operator/=(DoubleDouble const &other) noexcept -> DoubleDouble & { return *this = *this / other; }
+
+    friend auto operator+(DoubleDouble const &lhs, DoubleDouble const &rhs) noexcept -> DoubleDouble
+    {
+      return make(detail::doubledouble::sum(lhs.parts(), rhs.parts()));
+    }
+
+    friend auto operator-(DoubleDouble const &lhs, DoubleDouble const &rhs) noexcept -> DoubleDouble
+    {
+      return make(detail::doubledouble::difference(lhs.parts(), rhs.parts()));
+    }
+
+    friend constexpr auto operator-(DoubleDouble const &val) noexcept -> DoubleDouble { return {-val.hi, -val.lo}; }
+
+    friend auto operator*(DoubleDouble const &lhs, DoubleDouble const &rhs) noexcept -> DoubleDouble
+    {
+      return make(detail::doubledouble::product(lhs.parts(), rhs.parts()));
+    }
+
+    /// Scaling by a double skips the products with its zero low part
+    friend auto operator*(DoubleDouble const &lhs, double const rhs) noexcept -> DoubleDouble
+    {
+      return make(detail::doubledouble::product(lhs.parts(), rhs));
+    }
+
+    friend auto operator*(double const lhs, DoubleDouble const &rhs) noexcept -> DoubleDouble { return rhs * lhs; }
+
+    friend auto operator/(DoubleDouble const &lhs, DoubleDouble const &rhs) noexcept -> DoubleDouble
+    {
+      return make(detail::doubledouble::quotient(lhs.parts(), rhs.parts()));
+    }
+
+    friend constexpr auto operator==(DoubleDouble const &lhs, DoubleDouble const &rhs) noexcept -> bool
+    {
+      return lhs.hi == rhs.hi && lhs.lo == rhs.lo;
+    }
+
+    friend constexpr auto operator!=(DoubleDouble const &lhs, DoubleDouble const &rhs) noexcept -> bool
+    {
+      return !(lhs == rhs);
+    }
+
+    friend constexpr auto operator<(DoubleDouble const &lhs, DoubleDouble const &rhs) noexcept -> bool
+    {
+      return lhs.hi < rhs.hi || (lhs.hi == rhs.hi && lhs.lo < rhs.lo);
+    }
+
+    friend constexpr auto operator>(DoubleDouble const &lhs, DoubleDouble const &rhs) noexcept -> bool
+    {
+      return rhs < lhs;
+    }
+
+    friend constexpr auto operator<=(DoubleDouble const &lhs, DoubleDouble const &rhs) noexcept -> bool
+    {
+      return !(rhs < lhs);
+    }
+
+    friend constexpr auto operator>=(DoubleDouble const &lhs, DoubleDouble const &rhs) noexcept -> bool
+    {
+      return !(lhs < rhs);
+    }
+
+  private:
+    constexpr auto parts() const noexcept -> detail::doubledouble::Parts<double> { return {hi, lo}; }
+
+    static constexpr auto make(detail::doubledouble::Parts<double> const &p) noexcept -> DoubleDouble
+    {
+      return {p.hi, p.lo};
+    }
+
+    double hi;
+    double lo;
+  };
+
+  /**
+   * The exact sum of two doubles.
+   *
+   * @param a A double
+   * @param b A double
+   * @return a + b without rounding
+   */
+  inline constexpr auto exactSum(double const a, double const b) noexcept -> DoubleDouble
+  {
+    auto const s = detail::doubledouble::twoSum(a, b);
+    return {s.hi, s.lo};
+  }
+
+  /**
+   * The exact product of two doubles, barring overflow and underflow.
+   *
+   * @param a A double
+   * @param b A double
+   * @return a * b without rounding
+   */
+  inline auto exactProduct(double const a, double const b) noexcept -> DoubleDouble
+  {
+    auto const p = detail::doubledouble::twoProduct(a, b);
+    return {p.hi, p.lo};
+  }
+
+  /// The absolute value of x
+  inline constexpr auto abs(DoubleDouble const &x) noexcept -> DoubleDouble { return x.high() < 0.0 ? -x : x; }
+
+  /**
+   * The square root of x, one Newton step from the double square root of
+   * the high part.
+   *
+   * @param x A DoubleDouble
+   * @return sqrt(x), NaN for negative x
+   */
+  inline auto sqrt(DoubleDouble const &x) noexcept -> DoubleDouble
+  {
+    double const q = std::sqrt(x.high());
+    if (!(x.high() > 0.0) || q == q + q)
+    {
+      // zero, negative, infinite or NaN
+      return q;
+    }
+    auto const p = detail::doubledouble::twoProduct(q, q);
+    double const r = ((x.high() - p.hi) - p.lo + x.low()) / (q + q);
+    auto const s = detail::doubledouble::fastTwoSum(q, r);
+    return {s.hi, s.lo};
+  }
+
+  /// DoubleDouble is a valid vector element
+  template <>
+  struct is_vec_type<DoubleDouble> : public std::integral_constant<bool, true>
+  {
+  };
+
+  namespace detail::doubledouble
+  {
+    /**
+     * out[i] = kernel(lhs[i], rhs[i]) on the parts of DoubleDouble arrays,
+     * two at a time with SSE2.
+     */
+    template <typename Kernel>
+    inline auto transform(DoubleDouble const *lhs, DoubleDouble const *rhs, DoubleDouble *out,
+                          std::size_t const count, Kernel const &kernel) noexcept -> void
+    {
+      std::size_t i = 0;
+#if defined(__SSE2__)
+      static_assert(sizeof(DoubleDouble) == 2 * sizeof(double), "DoubleDouble is two doubles");
+      auto load = [](DoubleDouble const *p) noexcept -> Parts<Double2> {
+        auto const *d = reinterpret_cast<double const *>(p);
+        __m128d const first = _mm_loadu_pd(d);
+        __m128d const second = _mm_loadu_pd(d + 2);
+        return {_mm_unpacklo_pd(first, second), _mm_unpackhi_pd(first, second)};
+      };
+      for (std::size_t const end = count - count % 2; i < end; i += 2)
+      {
+        Parts<Double2> const r = kernel(load(lhs + i), load(rhs + i));
+        auto *d = reinterpret_cast<double *>(out + i);
+        _mm_storeu_pd(d, _mm_unpacklo_pd(r.hi.v, r.lo.v));
+        _mm_storeu_pd(d + 2, _mm_unpackhi_pd(r.hi.v, r.lo.v));
+      }
+#endif
+      for (; i < count; ++i)
+      {
+        Parts<double> const r = kernel(Parts<double>{lhs[i].high(), lhs[i].low()},
+                                       Parts<double>{rhs[i].high(), rhs[i].low()});
+        out[i] = {r.hi, r.lo};
+      }
+    }
+  } // namespace detail::doubledouble
+
+  /**
+   * @brief Arithmetic on arrays of DoubleDouble.
+   *
+   * Each function processes count values, two at a time with SSE2, using
+   * the same kernels as the scalar operators.  The results are identical
+   * unless the compiler contracts the scalar code into fused multiply adds.
+   * Input and output arrays may be the same array but must not otherwise
+   * overlap.  Arrays of Vector<DoubleDouble, N> are arrays of N count
+   * DoubleDouble.
+   */
+  namespace batch
+  {
+    /// out[i] = lhs[i] + rhs[i]
+    inline auto add(DoubleDouble const *lhs, DoubleDouble const *rhs, DoubleDouble *out,
+                    std::size_t const count) noexcept -> void
+    {
+      detail::doubledouble::transform(lhs, rhs, out, count,
+                                      [](auto const &a, auto const &b) { return detail::doubledouble::sum(a, b); });
+    }
+
+    /// out[i] = lhs[i] - rhs[i]
+    inline auto subtract(DoubleDouble const *lhs, DoubleDouble const *rhs, DoubleDouble *out,
+                         std::size_t const count) noexcept -> void
+    {
+      detail::doubledouble::transform(
+          lhs, rhs, out, count, [](auto const &a, auto const &b) { return detail::doubledouble::difference(a, b); });
+    }
+
+    /// out[i] = lhs[i] * rhs[i]
+    inline auto multiply(DoubleDouble const *lhs, DoubleDouble const *rhs, DoubleDouble *out,
+                         std::size_t const count) noexcept -> void
+    {
+      detail::doubledouble::transform(
+          lhs, rhs, out, count, [](auto const &a, auto const &b) { return detail::doubledouble::product(a, b); });
+    }
+
+    /// out[i] = lhs[i] / rhs[i]
+    inline auto divide(DoubleDouble const *lhs, DoubleDouble const *rhs, DoubleDouble *out,
+                       std::size_t const count) noexcept -> void
+    {
+      detail::doubledouble::transform(
+          lhs, rhs, out, count, [](auto const &a, auto const &b) { return detail::doubledouble::quotient(a, b); });
+    }
+
+    /**
+     * out[i] = x[i] + y[i] * s, the update of a position by a velocity over a
+     * time step.
+     */
+    inline auto multiplyAdd(DoubleDouble const *x, DoubleDouble const *y, double const s, DoubleDouble *out,
+                            std::size_t const count) noexcept -> void
+    {
+      detail::doubledouble::transform(x, y, out, count, [s](auto const &a, auto const &b) {
+        using V = std::decay_t<decltype(b.hi)>;
+        return detail::doubledouble::sum(a, detail::doubledouble::product(b, V(s)));
+      });
+    }
+  } // namespace batch
+
+} // namespace cagey::math
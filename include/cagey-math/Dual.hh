@@ -0,0 +1,336 @@
+//=============================================================================
+//
+// cagey-math - C++-17 Vector Math Library
+// Copyright (c) 2020 Kyle Girard <theycallmecoach@gmail.com>
+//
+// The MIT License (MIT)
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+//=============================================================================
+
+#pragma once
+
+/**
+ * @file
+ * @brief Forward mode automatic differentiation element type
+ *
+ * A Dual carries a value together with its derivatives with respect to K
+ * variables.  Every operation applies the chain rule to all K derivatives,
+ * which are stored contiguously and updated with unrolled per lane loops so
+ * they vectorize.  Duals are valid Vector and Matrix elements, so code written
+ * against Vector3 and Matrix33 yields a whole Jacobian from one evaluation
+ * instead of one finite difference evaluation per variable.
+ */
+
+#include <array>
+#include <cmath>
+#include <cstddef>
+#include <type_traits>
+
+#include "cagey-math/MatrixFunc.hh"
+#include "cagey-math/detail/vec_type.hh"
+
+namespace cagey::math
+{
+
+  /**
+   * A value and its derivatives with respect to K variables.
+   *
+   * @tparam T the type of the value and the derivatives
+   * @tparam K the number of variables
+   */
+  template <typename T, std::size_t K>
+  class Dual
+  {
+  public:
+    /** @cond doxygen has some issues with static assert */
+    static_assert(std::is_floating_point<T>::value, "Dual values must be floating point");
+    /** @endcond */
+
+    using Type = T;                          ///< Underlying type
+    static constexpr std::size_t Lanes = K;  ///< The number of derivatives
+
+    /**
+     * Default construct a dual number, the value and derivatives are
+     * uninitialized unless value initialized.
+     */
+    constexpr Dual() = default;
+
+    /**
+     * Construct a constant, all derivatives are zero.  Implicit so that
+     * numbers mix with dual numbers in expressions.
+     *
+     * @param value the value
+     */
+    constexpr Dual(T const value) noexcept : real{value}, grad{} {}
+
+    /**
+     * Construct a value with the given derivatives.
+     *
+     * @param value the value
+     * @param derivatives the derivative with respect to each variable
+     */
+    constexpr Dual(T const value, std::array<T, K> const &derivatives) noexcept : real{value}, grad{derivatives} {}
+
+    /**
+     * Construct the variable with the given index, its derivative with
+     * respect to itself is one and all others are zero.
+     *
+     * @param value the value of the variable
+     * @param index the index of the variable, less than K
+     * @return a seeded dual number
+     */
+    static constexpr auto variable(T const value, std::size_t const index) noexcept -> Dual
+    {
+      Dual result{value};
+      result.grad[index] = T(1);
+      return result;
+    }
+
+    /// The value
+    constexpr auto value() const noexcept -> T { return real; }
+
+    /// The derivative with respect to variable k
+    constexpr auto derivative(std::size_t const k) const noexcept -> T { return grad[k]; }
+
+    /// The derivatives with respect to all variables
+    constexpr auto derivatives() const noexcept -> std::array<T, K> const & { return grad; }
+
+    constexpr auto operator+=(Dual const &other) noexcept -> Dual &
+    {
+      real += other.real;
+      detail::vector::forEachIndex<K>([&](std::size_t k) { grad[k] += other.grad[k]; });
+      return *this;
+    }
+
+    constexpr auto operator-=(Dual const &other) noexcept -> Dual &
+    {
+      real -= other.real;
+      detail::vector::forEachIndex<K>([&](std::size_t k) { grad[k] -= other.grad[k]; });
+      return *this;
+    }
+
+    constexpr auto operator*=(Dual const &other) noexcept -> Dual &
+    {
+      detail::vector::forEachIndex<K>([&](std::size_t k) { grad[k] = grad[k] * other.real + real * other.grad[k]; });
+      real *= other.real;
+      return *this;
+    }
+
+    constexpr auto operator/=(Dual const &other) noexcept -> Dual &
+    {
+      T const inv = T(1) / other.real;
+      real *= inv;
+      detail::vector::forEachIndex<K>([&](std::size_t k) { grad[k] = (grad[k] - real * other.grad[k]) * inv; });
+      return *this;
+    }
+
+    constexpr auto operator*=(T const val) noexcept -> Dual &
+    {
+      real *= val;
+      detail::vector::forEachIndex<K>([&](std::size_t k) { grad[k] *= val; });
+      return *this;
+    }
+
+    constexpr auto operator/=(T const val) noexcept -> Dual & { return *this *= T(1) / val; }
+
+    friend constexpr auto operator+(Dual lhs, Dual const &rhs) noexcept -> Dual { return lhs += rhs; }
+
+    friend constexpr auto operator-(Dual lhs, Dual const &rhs) noexcept -> Dual { return lhs -= rhs; }
+
+    friend constexpr auto operator*(Dual lhs, Dual const &rhs) noexcept -> Dual { return lhs *= rhs; }
+
+    friend constexpr auto operator/(Dual lhs, Dual const &rhs) noexcept -> Dual { return lhs /= rhs; }
+
+    friend constexpr auto operator*(Dual lhs, T const rhs) noexcept -> Dual { return lhs *= rhs; }
+
+    friend constexpr auto operator*(T const lhs, Dual rhs) noexcept -> Dual { return rhs *= lhs; }
+
+    friend constexpr auto operator/(Dual lhs, T const rhs) noexcept -> Dual { return lhs /= rhs; }
+
+    friend constexpr auto operator-(Dual val) noexcept -> Dual { return val *= T(-1); }
+
+    /// Dual numbers compare by value so that min, max and clamp pick branches
+    friend constexpr auto operator==(Dual const &lhs, Dual const &rhs) noexcept -> bool
+    {
+      return lhs.real == rhs.real;
+    }
+
+    friend constexpr auto operator!=(Dual const &lhs, Dual const &rhs) noexcept -> bool { return !(lhs == rhs); }
+
+    friend constexpr auto operator<(Dual const &lhs, Dual const &rhs) noexcept -> bool { return lhs.real < rhs.real; }
+
+    friend constexpr auto operator>(Dual const &lhs, Dual const &rhs) noexcept -> bool { return rhs < lhs; }
+
+    friend constexpr auto operator<=(Dual const &lhs, Dual const &rhs) noexcept -> bool { return !(rhs < lhs); }
+
+    friend constexpr auto operator>=(Dual const &lhs, Dual const &rhs) noexcept -> bool { return !(lhs < rhs); }
+
+  private:
+    T real;
+    std::array<T, K> grad;
+  };
+
+  namespace detail::dual
+  {
+    /// f(x) given f and its derivative f' at the value of x
+    template <typename T, std::size_t K>
+    inline constexpr auto chain(Dual<T, K> const &x, T const f, T const df) noexcept -> Dual<T, K>
+    {
+      std::array<T, K> grad{};
+      detail::vector::forEachIndex<K>([&](std::size_t k) { grad[k] = df * x.derivative(k); });
+      return {f, grad};
+    }
+
+  } // namespace detail::dual
+
+  /// @name Elementary functions
+  ///@{
+  template <typename T, std::size_t K>
+  inline auto sqrt(Dual<T, K> const &x) noexcept -> Dual<T, K>
+  {
+    T const root = std::sqrt(x.value());
+    return detail::dual::chain(x, root, T(0.5) / root);
+  }
+
+  template <typename T, std::size_t K>
+  inline auto abs(Dual<T, K> const &x) noexcept -> Dual<T, K>
+  {
+    return x.value() < T(0) ? -x : x;
+  }
+
+  template <typename T, std::size_t K>
+  inline auto sin(Dual<T, K> const &x) noexcept -> Dual<T, K>
+  {
+    return detail::dual::chain(x, std::sin(x.value()), std::cos(x.value()));
+  }
+
+  template <typename T, std::size_t K>
+  inline auto cos(Dual<T, K> const &x) noexcept -> Dual<T, K>
+  {
+    return detail::dual::chain(x, std::cos(x.value()), -std::sin(x.value()));
+  }
+
+  template <typename T, std::size_t K>
+  inline auto acos(Dual<T, K> const &x) noexcept -> Dual<T, K>
+  {
+    T const v = x.value();
+    return detail::dual::chain(x, std::acos(v), T(-1) / std::sqrt(T(1) - v * v));
+  }
+
+  template <typename T, std::size_t K>
+  inline auto exp(Dual<T, K> const &x) noexcept -> Dual<T, K>
+  {
+    T const e = std::exp(x.value());
+    return detail::dual::chain(x, e, e);
+  }
+
+  template <typename T, std::size_t K>
+  inline auto log(Dual<T, K> const &x) noexcept -> Dual<T, K>
+  {
+    return detail::dual::chain(x, std::log(x.value()), T(1) / x.value());
+  }
+
+  template <typename T, std::size_t K>
+  inline auto pow(Dual<T, K> const &x, T const exponent) noexcept -> Dual<T, K>
+  {
+    if (exponent == T(0))
+    {
+      return detail::dual::chain(x, T(1), T(0));
+    }
+    return detail::dual::chain(x, std::pow(x.value(), exponent), exponent * std::pow(x.value(), exponent - T(1)));
+  }
+
+  template <typename T, std::size_t K>
+  inline auto atan2(Dual<T, K> const &y, Dual<T, K> const &x) noexcept -> Dual<T, K>
+  {
+    T const inv = T(1) / (x.value() * x.value() + y.value() * y.value());
+    std::array<T, K> grad{};
+    detail::vector::forEachIndex<K>([&](std::size_t k) {
+      grad[k] = (x.value() * y.derivative(k) - y.value() * x.derivative(k)) * inv;
+    });
+    return {std::atan2(y.value(), x.value()), grad};
+  }
+  ///@}
+
+  /// Dual numbers are valid vector elements when their value type is
+  template <typename T, std::size_t K>
+  struct is_vec_type<Dual<T, K>> : public is_vec_type<T>
+  {
+  };
+
+  /**
+   * Seed each component of x as its own variable, ready to be passed to a
+   * function whose Jacobian is wanted.
+   *
+   * @param x the point to differentiate at
+   * @return x with component i seeded as variable i
+   */
+  template <typename T, std::size_t N, typename Space>
+  inline constexpr auto variables(Vector<T, N, Space> const &x) noexcept -> Vector<Dual<T, N>, N, Space>
+  {
+    Vector<Dual<T, N>, N, Space> result{};
+    for (std::size_t i = 0; i < N; ++i)
+    {
+      result[i] = Dual<T, N>::variable(x[i], i);
+    }
+    return result;
+  }
+
+  /**
+   * Strip the derivatives from each component of v.
+   *
+   * @param v a vector of dual numbers
+   * @return the values of v
+   */
+  template <typename T, std::size_t K, std::size_t N, typename Space>
+  inline constexpr auto values(Vector<Dual<T, K>, N, Space> const &v) noexcept -> Vector<T, N, Space>
+  {
+    Vector<T, N, Space> result{};
+    for (std::size_t i = 0; i < N; ++i)
+    {
+      result[i] = v[i].value();
+    }
+    return result;
+  }
+
+  /**
+   * The Jacobian of a function of N variables with N results, from the
+   * result of evaluating it at variables(x).
+   *
+   * @param f the result of the function at variables(x)
+   * @return the matrix whose column k holds the derivatives of f with
+   * respect to variable k
+   */
+  template <typename T, std::size_t N, typename Space>
+  inline constexpr auto jacobian(Vector<Dual<T, N>, N, Space> const &f) noexcept -> Matrix<T, N, N>
+  {
+    Matrix<T, N, N> result{};
+    for (std::size_t col = 0; col < N; ++col)
+    {
+      for (std::size_t row = 0; row < N; ++row)
+      {
+        result[col][row] = f[row].derivative(col);
+      }
+    }
+    return result;
+  }
+
+} // namespace cagey::math
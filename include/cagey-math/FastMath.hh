@@ -0,0 +1,552 @@
+//=============================================================================
+//
+// cagey-math - C++-17 Vector Math Library
+// Copyright (c) 2020 Kyle Girard <theycallmecoach@gmail.com>
+//
+// The MIT License (MIT)
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+//=============================================================================
+
+#pragma once
+
+/**
+ * @file
+ * @brief Polynomial exp, exp2, log and pow for vectors and arrays of floats
+ *
+ * Each function comes in three accuracy tiers.  The kernels are written once
+ * over a lane type, so the same polynomials run four floats at a time with
+ * SSE2 and one at a time elsewhere, giving identical results either way.
+ * Vectors of other element types fall back to the standard library.
+ */
+
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <limits>
+#include <type_traits>
+
+#if defined(__SSE2__)
+#include <emmintrin.h>
+#endif
+
+#include "cagey-math/VectorFunc.hh"
+
+namespace cagey::math
+{
+
+  /**
+   * How close the fast functions get to the exact result.  The bounds are
+   * relative errors for exp and exp2 and absolute errors for log.  The
+   * relative error of pow is that of log times |y|, plus that of exp2, plus
+   * the rounding of y log2(x) in float, so it grows with |y log2(x)|.
+   */
+  enum class Accuracy
+  {
+    Full,   ///< within about 1 ulp, Cephes polynomials with Cody-Waite range reduction
+    Medium, ///< within 1e-4
+    Low     ///< within 1e-2
+  };
+
+  namespace detail::fastmath
+  {
+    constexpr float Log2e = 1.44269504088896341f;
+    constexpr float Ln2 = 0.693147180559945309f;
+    constexpr float Ln2Hi = 0.693359375f;
+    constexpr float Ln2Lo = -2.12194440e-4f;
+    constexpr float SqrtHalf = 0.707106781186547524f;
+    constexpr float RoundMagic = 12582912.0f; // 1.5 * 2^23, adding it rounds to an integer
+
+    //==========================================================================
+    // Scalar lanes
+    //==========================================================================
+
+    inline auto minimum(float const lhs, float const rhs) noexcept -> float { return lhs < rhs ? lhs : rhs; }
+
+    inline auto maximum(float const lhs, float const rhs) noexcept -> float { return lhs > rhs ? lhs : rhs; }
+
+    inline auto less(float const lhs, float const rhs) noexcept -> bool { return lhs < rhs; }
+
+    inline auto equal(float const lhs, float const rhs) noexcept -> bool { return lhs == rhs; }
+
+    inline auto notGreaterEqual(float const lhs, float const rhs) noexcept -> bool { return !(lhs >= rhs); }
+
+    inline auto isNan(float const x) noexcept -> bool { return x != x; }
+
+    inline auto select(bool const mask, float const lhs, float const rhs) noexcept -> float { return mask ? lhs : rhs; }
+
+    inline auto roundToNearest(float const x) noexcept -> float { return (x + RoundMagic) - RoundMagic; }
+
+    inline auto toInt(float const x) noexcept -> std::int32_t { return static_cast<std::int32_t>(x); }
+
+    inline auto bits(float const x) noexcept -> std::uint32_t
+    {
+      std::uint32_t result;
+      std::memcpy(&result, &x, sizeof(result));
+      return result;
+    }
+
+    inline auto fromBits(std::uint32_t const b) noexcept -> float
+    {
+      float result;
+      std::memcpy(&result, &b, sizeof(result));
+      return result;
+    }
+
+    /// 2^n for n in the normal exponent range
+    inline auto pow2(std::int32_t const n) noexcept -> float { return fromBits(std::uint32_t(n + 127) << 23); }
+
+    /// The exponent e of x = m 2^e with m in [0.5, 1), for positive normal x
+    inline auto exponent(float const x) noexcept -> float { return float(std::int32_t((bits(x) >> 23) & 0xff) - 126); }
+
+    /// The m of x = m 2^e with m in [0.5, 1), for positive normal x
+    inline auto mantissa(float const x) noexcept -> float { return fromBits((bits(x) & 0x807fffffu) | 0x3f000000u); }
+
+#if defined(__SSE2__)
+    //==========================================================================
+    // SSE2 lanes
+    //==========================================================================
+
+    struct Float4
+    {
+      __m128 v;
+
+      Float4(__m128 const value) noexcept : v{value} {}
+
+      Float4(float const value) noexcept : v{_mm_set1_ps(value)} {}
+    };
+
+    struct Int4
+    {
+      __m128i v;
+    };
+
+    inline auto operator+(Float4 const lhs, Float4 const rhs) noexcept -> Float4 { return _mm_add_ps(lhs.v, rhs.v); }
+
+    inline auto operator-(Float4 const lhs, Float4 const rhs) noexcept -> Float4 { return _mm_sub_ps(lhs.v, rhs.v); }
+
+    inline auto operator*(Float4 const lhs, Float4 const rhs) noexcept -> Float4 { return _mm_mul_ps(lhs.v, rhs.v); }
+
+    inline auto operator-(Int4 const lhs, Int4 const rhs) noexcept -> Int4 { return {_mm_sub_epi32(lhs.v, rhs.v)}; }
+
+    inline auto operator>>(Int4 const lhs, int const shift) noexcept -> Int4 { return {_mm_srai_epi32(lhs.v, shift)}; }
+
+    inline auto minimum(Float4 const lhs, Float4 const rhs) noexcept -> Float4 { return _mm_min_ps(lhs.v, rhs.v); }
+
+    inline auto maximum(Float4 const lhs, Float4 const rhs) noexcept -> Float4 { return _mm_max_ps(lhs.v, rhs.v); }
+
+    inline auto less(Float4 const lhs, Float4 const rhs) noexcept -> Float4 { return _mm_cmplt_ps(lhs.v, rhs.v); }
+
+    inline auto equal(Float4 const lhs, Float4 const rhs) noexcept -> Float4 { return _mm_cmpeq_ps(lhs.v, rhs.v); }
+
+    inline auto notGreaterEqual(Float4 const lhs, Float4 const rhs) noexcept -> Float4
+    {
+      return _mm_cmpnge_ps(lhs.v, rhs.v);
+    }
+
+    inline auto isNan(Float4 const x) noexcept -> Float4 { return _mm_cmpunord_ps(x.v, x.v); }
+
+    inline auto select(Float4 const mask, Float4 const lhs, Float4 const rhs) noexcept -> Float4
+    {
+      return _mm_or_ps(_mm_and_ps(mask.v, lhs.v), _mm_andnot_ps(mask.v, rhs.v));
+    }
+
+    inline auto roundToNearest(Float4 const x) noexcept -> Float4 { return (x + RoundMagic) - RoundMagic; }
+
+    inline auto toInt(Float4 const x) noexcept -> Int4 { return {_mm_cvttps_epi32(x.v)}; }
+
+    inline auto pow2(Int4 const n) noexcept -> Float4
+    {
+      return _mm_castsi128_ps(_mm_slli_epi32(_mm_add_epi32(n.v, _mm_set1_epi32(127)), 23));
+    }
+
+    inline auto exponent(Float4 const x) noexcept -> Float4
+    {
+      __m128i const e = _mm_and_si128(_mm_srli_epi32(_mm_castps_si128(x.v), 23), _mm_set1_epi32(0xff));
+      return _mm_cvtepi32_ps(_mm_sub_epi32(e, _mm_set1_epi32(126)));
+    }
+
+    inline auto mantissa(Float4 const x) noexcept -> Float4
+    {
+      __m128i const m = _mm_and_si128(_mm_castps_si128(x.v), _mm_set1_epi32(std::int32_t(0x807fffffu)));
+      return _mm_castsi128_ps(_mm_or_si128(m, _mm_set1_epi32(0x3f000000)));
+    }
+#endif
+
+    //==========================================================================
+    // Kernels, V is float or Float4
+    //==========================================================================
+
+    /// c0 + x (c1 + x (c2 + ...))
+    template <typename V, typename... C>
+    inline auto horner(V const &x, float const c0, C const... rest) noexcept -> V
+    {
+      if constexpr (sizeof...(rest) == 0)
+      {
+        return V(c0);
+      }
+      else
+      {
+        return V(c0) + x * horner(x, rest...);
+      }
+    }
+
+    /// p 2^n in two steps, so results near overflow and in the denormal range are right
+    template <typename V, typename I>
+    inline auto scale(V const &p, I const &n) noexcept -> V
+    {
+      I const half = n >> 1;
+      return p * pow2(half) * pow2(n - half);
+    }
+
+    template <Accuracy A, typename V>
+    inline auto exp2(V const &x) noexcept -> V
+    {
+      // NaN clamps to a finite value here and is put back at the end
+      V const t = minimum(maximum(x, V(-151.0f)), V(129.0f));
+      V const n = roundToNearest(t);
+      V const f = t - n;
+      V p{0.0f};
+      if constexpr (A == Accuracy::Full)
+      {
+        p = V(1.0f) + f * horner(f, 6.931472028550421e-1f, 2.402264791363012e-1f, 5.550332471162809e-2f,
+                                 9.618437357674640e-3f, 1.339887440266574e-3f, 1.535336188319500e-4f);
+      }
+      else if constexpr (A == Accuracy::Medium)
+      {
+        p = V(1.0f) + f * horner(f, 6.931367338836215e-1f, 2.402253009741220e-1f, 5.583828294621972e-2f,
+                                 9.656710288546807e-3f);
+      }
+      else
+      {
+        p = V(1.0f) + f * horner(f, 7.001060576430099e-1f, 2.414311824820513e-1f);
+      }
+      return select(isNan(x), x, scale(p, toInt(n)));
+    }
+
+    template <Accuracy A, typename V>
+    inline auto exp(V const &x) noexcept -> V
+    {
+      if constexpr (A == Accuracy::Full)
+      {
+        // n = round(x / ln 2), exp(x) = 2^n exp(x - n ln 2) with ln 2 split so the reduction is exact
+        V const t = minimum(maximum(x, V(-104.0f)), V(89.0f));
+        V const n = roundToNearest(t * V(Log2e));
+        V const r = t - n * V(Ln2Hi) - n * V(Ln2Lo);
+        V const p = V(1.0f) + r +
+                    r * r *
+                        horner(r, 5.0000001201e-1f, 1.6666665459e-1f, 4.1665795894e-2f, 8.3334519073e-3f,
+                               1.3981999507e-3f, 1.9875691500e-4f);
+        return select(isNan(x), x, scale(p, toInt(n)));
+      }
+      else
+      {
+        return exp2<A>(x * V(Log2e));
+      }
+    }
+
+    template <Accuracy A, typename V>
+    inline auto log(V const &x) noexcept -> V
+    {
+      // scale denormals up so their exponent and mantissa can be read from the bits
+      V const denormal = less(x, V(std::numeric_limits<float>::min()));
+      V const y = select(denormal, x * V(8388608.0f), x);
+      V const m = mantissa(y);
+      V const low = less(m, V(SqrtHalf));
+      V const e = exponent(y) - select(denormal, V(23.0f), V(0.0f)) - select(low, V(1.0f), V(0.0f));
+      V const u = select(low, m + m, m) - V(1.0f); // in [sqrt(1/2) - 1, sqrt(2) - 1)
+
+      V r{0.0f};
+      if constexpr (A == Accuracy::Full)
+      {
+        V const z = u * u;
+        V const p = u * z *
+                    horner(u, 3.3333331174e-1f, -2.4999993993e-1f, 2.0000714765e-1f, -1.6668057665e-1f,
+                           1.4249322787e-1f, -1.2420140846e-1f, 1.1676998740e-1f, -1.1514610310e-1f,
+                           7.0376836292e-2f);
+        r = u + (p + e * V(Ln2Lo) - V(0.5f) * z) + e * V(Ln2Hi);
+      }
+      else if constexpr (A == Accuracy::Medium)
+      {
+        r = e * V(Ln2) + u * horner(u, 9.99962170379601e-1f, -4.995021092024254e-1f, 3.366878159803819e-1f,
+                                    -2.701022827053323e-1f, 1.734863154493921e-1f);
+      }
+      else
+      {
+        r = e * V(Ln2) + u * horner(u, 1.018573619150333f, -4.755923722300008e-1f);
+      }
+
+      r = select(notGreaterEqual(x, V(0.0f)), V(std::numeric_limits<float>::quiet_NaN()), r);
+      r = select(equal(x, V(0.0f)), V(-std::numeric_limits<float>::infinity()), r);
+      return select(equal(x, V(std::numeric_limits<float>::infinity())), x, r);
+    }
+
+    template <Accuracy A, typename V>
+    inline auto pow(V const &x, V const &y) noexcept -> V
+    {
+      // y multiplies the error of log, so the low tier takes the medium log to stay within 1e-2 for |y| up to
+      // about 3.  x^0 is 1 even when log x is infinite.
+      constexpr Accuracy LogAccuracy = A == Accuracy::Low ? Accuracy::Medium : A;
+      return select(equal(y, V(0.0f)), V(1.0f), exp2<A>(y * (log<LogAccuracy>(x) * V(Log2e))));
+    }
+
+    /**
+     * out[i] = kernel(in[i]), four at a time with SSE2.  A partial group at
+     * the end is padded with ones so that short vectors still take one SIMD
+     * pass.
+     */
+    template <typename Kernel>
+    inline auto apply(float const *in, float *out, std::size_t const count, Kernel const &kernel) noexcept -> void
+    {
+      std::size_t i = 0;
+#if defined(__SSE2__)
+      for (; i + 4 <= count; i += 4)
+      {
+        _mm_storeu_ps(out + i, kernel(Float4{_mm_loadu_ps(in + i)}).v);
+      }
+      if (i < count)
+      {
+        float buffer[4] = {1.0f, 1.0f, 1.0f, 1.0f};
+        std::memcpy(buffer, in + i, (count - i) * sizeof(float));
+        _mm_storeu_ps(buffer, kernel(Float4{_mm_loadu_ps(buffer)}).v);
+        std::memcpy(out + i, buffer, (count - i) * sizeof(float));
+        return;
+      }
+#endif
+      for (; i < count; ++i)
+      {
+        out[i] = kernel(in[i]);
+      }
+    }
+
+    /// out[i] = kernel(x[i], y[i]), like apply
+    template <typename Kernel>
+    inline auto apply(float const *x, float const *y, float *out, std::size_t const count,
+                      Kernel const &kernel) noexcept -> void
+    {
+      std::size_t i = 0;
+#if defined(__SSE2__)
+      for (; i + 4 <= count; i += 4)
+      {
+        _mm_storeu_ps(out + i, kernel(Float4{_mm_loadu_ps(x + i)}, Float4{_mm_loadu_ps(y + i)}).v);
+      }
+      if (i < count)
+      {
+        float bx[4] = {1.0f, 1.0f, 1.0f, 1.0f};
+        float by[4] = {1.0f, 1.0f, 1.0f, 1.0f};
+        std::memcpy(bx, x + i, (count - i) * sizeof(float));
+        std::memcpy(by, y + i, (count - i) * sizeof(float));
+        _mm_storeu_ps(bx, kernel(Float4{_mm_loadu_ps(bx)}, Float4{_mm_loadu_ps(by)}).v);
+        std::memcpy(out + i, bx, (count - i) * sizeof(float));
+        return;
+      }
+#endif
+      for (; i < count; ++i)
+      {
+        out[i] = kernel(x[i], y[i]);
+      }
+    }
+
+  } // namespace detail::fastmath
+
+  /**
+   * Computes e raised to each component of v.
+   *
+   * @tparam A the accuracy tier
+   * @param v A Vector
+   * @return e^v component wise
+   */
+  template <Accuracy A = Accuracy::Full, std::size_t N, typename S>
+  inline auto exp(Vector<float, N, S> v) noexcept -> Vector<float, N, S>
+  {
+    detail::fastmath::apply(v.elements.data(), v.elements.data(), N,
+                            [](auto const &x) { return detail::fastmath::exp<A>(x); });
+    return v;
+  }
+
+  /**
+   * Computes 2 raised to each component of v.
+   *
+   * @tparam A the accuracy tier
+   * @param v A Vector
+   * @return 2^v component wise
+   */
+  template <Accuracy A = Accuracy::Full, std::size_t N, typename S>
+  inline auto exp2(Vector<float, N, S> v) noexcept -> Vector<float, N, S>
+  {
+    detail::fastmath::apply(v.elements.data(), v.elements.data(), N,
+                            [](auto const &x) { return detail::fastmath::exp2<A>(x); });
+    return v;
+  }
+
+  /**
+   * Computes the natural logarithm of each component of v.  Negative
+   * components give NaN and zeros give -inf.
+   *
+   * @tparam A the accuracy tier
+   * @param v A Vector
+   * @return log(v) component wise
+   */
+  template <Accuracy A = Accuracy::Full, std::size_t N, typename S>
+  inline auto log(Vector<float, N, S> v) noexcept -> Vector<float, N, S>
+  {
+    detail::fastmath::apply(v.elements.data(), v.elements.data(), N,
+                            [](auto const &x) { return detail::fastmath::log<A>(x); });
+    return v;
+  }
+
+  /**
+   * Raises each component of v to the power y, e.g. for gamma.  Negative
+   * components give NaN.
+   *
+   * @tparam A the accuracy tier
+   * @param v A Vector of bases
+   * @param y the exponent
+   * @return v^y component wise
+   */
+  template <Accuracy A = Accuracy::Full, std::size_t N, typename S>
+  inline auto pow(Vector<float, N, S> v, float const y) noexcept -> Vector<float, N, S>
+  {
+    detail::fastmath::apply(v.elements.data(), v.elements.data(), N, [y](auto const &x) {
+      using V = std::decay_t<decltype(x)>;
+      return detail::fastmath::pow<A>(x, V(y));
+    });
+    return v;
+  }
+
+  /**
+   * Raises each component of v to the power of the matching component of y.
+   *
+   * @tparam A the accuracy tier
+   * @param v A Vector of bases
+   * @param y A Vector of exponents
+   * @return v^y component wise
+   */
+  template <Accuracy A = Accuracy::Full, std::size_t N, typename S>
+  inline auto pow(Vector<float, N, S> v, Vector<float, N, S> const &y) noexcept -> Vector<float, N, S>
+  {
+    detail::fastmath::apply(v.elements.data(), y.elements.data(), v.elements.data(), N,
+                            [](auto const &x, auto const &e) { return detail::fastmath::pow<A>(x, e); });
+    return v;
+  }
+
+  /// @name Other element types use the standard library at every tier
+  ///@{
+  template <Accuracy A = Accuracy::Full, typename T, std::size_t N, typename S>
+  inline auto exp(Vector<T, N, S> v) noexcept -> Vector<T, N, S>
+  {
+    detail::vector::forEachIndex<N>([&](std::size_t i) { v[i] = std::exp(v[i]); });
+    return v;
+  }
+
+  template <Accuracy A = Accuracy::Full, typename T, std::size_t N, typename S>
+  inline auto exp2(Vector<T, N, S> v) noexcept -> Vector<T, N, S>
+  {
+    detail::vector::forEachIndex<N>([&](std::size_t i) { v[i] = std::exp2(v[i]); });
+    return v;
+  }
+
+  template <Accuracy A = Accuracy::Full, typename T, std::size_t N, typename S>
+  inline auto log(Vector<T, N, S> v) noexcept -> Vector<T, N, S>
+  {
+    detail::vector::forEachIndex<N>([&](std::size_t i) { v[i] = std::log(v[i]); });
+    return v;
+  }
+
+  template <Accuracy A = Accuracy::Full, typename T, std::size_t N, typename S>
+  inline auto pow(Vector<T, N, S> v, T const y) noexcept -> Vector<T, N, S>
+  {
+    detail::vector::forEachIndex<N>([&](std::size_t i) { v[i] = std::pow(v[i], y); });
+    return v;
+  }
+
+  template <Accuracy A = Accuracy::Full, typename T, std::size_t N, typename S>
+  inline auto pow(Vector<T, N, S> v, Vector<T, N, S> const &y) noexcept -> Vector<T, N, S>
+  {
+    detail::vector::forEachIndex<N>([&](std::size_t i) { v[i] = std::pow(v[i], y[i]); });
+    return v;
+  }
+  ///@}
+
+  namespace batch
+  {
+    /**
+     * Computes out[i] = e^in[i], in and out may be the same array.
+     *
+     * @tparam A the accuracy tier
+     */
+    template <Accuracy A = Accuracy::Full>
+    inline auto exp(float const *in, float *out, std::size_t const count) noexcept -> void
+    {
+      detail::fastmath::apply(in, out, count, [](auto const &x) { return detail::fastmath::exp<A>(x); });
+    }
+
+    /**
+     * Computes out[i] = 2^in[i], in and out may be the same array.
+     *
+     * @tparam A the accuracy tier
+     */
+    template <Accuracy A = Accuracy::Full>
+    inline auto exp2(float const *in, float *out, std::size_t const count) noexcept -> void
+    {
+      detail::fastmath::apply(in, out, count, [](auto const &x) { return detail::fastmath::exp2<A>(x); });
+    }
+
+    /**
+     * Computes out[i] = log(in[i]), in and out may be the same array.
+     *
+     * @tparam A the accuracy tier
+     */
+    template <Accuracy A = Accuracy::Full>
+    inline auto log(float const *in, float *out, std::size_t const count) noexcept -> void
+    {
+      detail::fastmath::apply(in, out, count, [](auto const &x) { return detail::fastmath::log<A>(x); });
+    }
+
+    /**
+     * Computes out[i] = x[i]^y, x and out may be the same array.
+     *
+     * @tparam A the accuracy tier
+     */
+    template <Accuracy A = Accuracy::Full>
+    inline auto pow(float const *x, float const y, float *out, std::size_t const count) noexcept -> void
+    {
+      detail::fastmath::apply(x, out, count, [y](auto const &b) {
+        using V = std::decay_t<decltype(b)>;
+        return detail::fastmath::pow<A>(b, V(y));
+      });
+    }
+
+    /**
+     * Computes out[i] = x[i]^y[i], x and out may be the same array.
+     *
+     * @tparam A the accuracy tier
+     */
+    template <Accuracy A = Accuracy::Full>
+    inline auto pow(float const *x, float const *y, float *out, std::size_t const count) noexcept -> void
+    {
+      detail::fastmath::apply(x, y, out, count,
+                              [](auto const &b, auto const &e) { return detail::fastmath::pow<A>(b, e); });
+    }
+
+  } // namespace batch
+
+} // namespace cagey::math
@@ -0,0 +1,462 @@
+//=============================================================================
+//
+// cagey-math - C++-17 Vector Math Library
+// Copyright (c) 2020 Kyle Girard <theycallmecoach@gmail.com>
+//
+// The MIT License (MIT)
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+//=============================================================================
+
+#pragma once
+
+/**
+ * @file
+ * @brief Plane, Sphere, Line, Segment, Box and Capsule primitives and point queries
+ */
+
+#include <cmath>
+#include <cstddef>
+
+#include "cagey-math/VectorFunc.hh"
+
+namespace cagey::math
+{
+
+  /**
+   * @brief A plane, the set of points p where dot(normal, p) == offset
+   *
+   * @tparam T the type of elements of this plane
+   */
+  template <typename T>
+  struct Plane
+  {
+    Vector<T, 3> normal; ///< unit length normal
+    T offset;            ///< signed distance from the origin along normal
+
+    /**
+     * @brief Create a plane through a point
+     *
+     * @param normal unit length normal
+     * @param point a point on the plane
+     */
+    static constexpr auto fromPointNormal(Vector<T, 3> const &normal, Vector<T, 3> const &point) noexcept -> Plane
+    {
+      return {normal, dot(normal, point)};
+    }
+
+    /**
+     * @brief Create a plane through three points, counter clockwise points face the normal
+     */
+    static auto fromPoints(Vector<T, 3> const &a, Vector<T, 3> const &b, Vector<T, 3> const &c) noexcept -> Plane
+    {
+      return fromPointNormal(normalize(cross(b - a, c - a)), a);
+    }
+  };
+
+  /**
+   * @brief A sphere
+   *
+   * @tparam T the type of elements of this sphere
+   */
+  template <typename T>
+  struct Sphere
+  {
+    Vector<T, 3> center; ///< center of the sphere
+    T radius;            ///< radius of the sphere
+  };
+
+  /**
+   * @brief An infinite line, the points origin + t * direction
+   *
+   * @tparam T the type of elements of this line
+   */
+  template <typename T>
+  struct Line
+  {
+    Vector<T, 3> origin;    ///< a point on the line
+    Vector<T, 3> direction; ///< direction of the line, must not be zero
+  };
+
+  /**
+   * @brief A line segment, the points start + t * (end - start) for t in [0, 1]
+   *
+   * @tparam T the type of elements of this segment
+   */
+  template <typename T>
+  struct Segment
+  {
+    Vector<T, 3> start; ///< first end point
+    Vector<T, 3> end;   ///< second end point
+  };
+
+  /**
+   * @brief An axis aligned box
+   *
+   * @tparam T the type of elements of this box
+   */
+  template <typename T>
+  struct Box
+  {
+    Vector<T, 3> center;      ///< center of the box
+    Vector<T, 3> halfExtents; ///< half the size of the box along each axis
+  };
+
+  /**
+   * @brief A capsule, the points within radius of a segment
+   *
+   * @tparam T the type of elements of this capsule
+   */
+  template <typename T>
+  struct Capsule
+  {
+    Segment<T> axis; ///< the center line of the capsule
+    T radius;        ///< radius of the capsule
+  };
+
+  //==========================================================================
+  /// @name Plane Queries
+  //==========================================================================
+  ///@{
+
+  /**
+   * Computes the signed distance from the plane to p, positive on the side
+   * the normal points to.
+   */
+  template <typename T>
+  inline constexpr auto signedDistance(Plane<T> const &plane, Vector<T, 3> const &p) noexcept -> T
+  {
+    return dot(plane.normal, p) - plane.offset;
+  }
+
+  /**
+   * Computes the point on the plane closest to p, the projection of p onto the plane.
+   */
+  template <typename T>
+  inline constexpr auto closestPoint(Plane<T> const &plane, Vector<T, 3> const &p) noexcept -> Vector<T, 3>
+  {
+    return p - plane.normal * signedDistance(plane, p);
+  }
+
+  ///@}
+  //==========================================================================
+  /// @name Sphere Queries
+  //==========================================================================
+  ///@{
+
+  /**
+   * Computes the signed distance from the surface of the sphere to p,
+   * negative inside the sphere.
+   */
+  template <typename T>
+  inline auto signedDistance(Sphere<T> const &sphere, Vector<T, 3> const &p) noexcept -> T
+  {
+    return length(p - sphere.center) - sphere.radius;
+  }
+
+  /**
+   * Computes the point on the surface of the sphere closest to p.  When p is
+   * the center the point along the x axis is returned.
+   */
+  template <typename T>
+  inline auto closestPoint(Sphere<T> const &sphere, Vector<T, 3> const &p) noexcept -> Vector<T, 3>
+  {
+    auto const d = p - sphere.center;
+    auto const len = length(d);
+    if (len > T{0})
+    {
+      return sphere.center + d * (sphere.radius / len);
+    }
+    return sphere.center + Vector<T, 3>::xAxis() * sphere.radius;
+  }
+
+  ///@}
+  //==========================================================================
+  /// @name Line Queries
+  //==========================================================================
+  ///@{
+
+  /**
+   * Computes t such that line.origin + t * line.direction is the point on
+   * the line closest to p.
+   */
+  template <typename T>
+  inline constexpr auto project(Line<T> const &line, Vector<T, 3> const &p) noexcept -> T
+  {
+    return dot(p - line.origin, line.direction) / lengthSquared(line.direction);
+  }
+
+  /**
+   * Computes the point on the line closest to p.
+   */
+  template <typename T>
+  inline constexpr auto closestPoint(Line<T> const &line, Vector<T, 3> const &p) noexcept -> Vector<T, 3>
+  {
+    return line.origin + line.direction * project(line, p);
+  }
+
+  /**
+   * Computes the distance from the line to p.
+   */
+  template <typename T>
+  inline auto distance(Line<T> const &line, Vector<T, 3> const &p) noexcept -> T
+  {
+    return length(p - closestPoint(line, p));
+  }
+
+  ///@}
+  //==========================================================================
+  /// @name Segment Queries
+  //==========================================================================
+  ///@{
+
+  /**
+   * Computes t in [0, 1] such that segment.start + t * (segment.end - segment.start)
+   * is the point on the segment closest to p.
+   */
+  template <typename T>
+  inline constexpr auto project(Segment<T> const &segment, Vector<T, 3> const &p) noexcept -> T
+  {
+    auto const d = segment.end - segment.start;
+    auto const len2 = lengthSquared(d);
+    auto const t = len2 > T{0} ? dot(p - segment.start, d) / len2 : T{0};
+    return t < T{0} ? T{0} : (t > T{1} ? T{1} : t);
+  }
+
+  /**
+   * Computes the point on the segment closest to p.
+   */
+  template <typename T>
+  inline constexpr auto closestPoint(Segment<T> const &segment, Vector<T, 3> const &p) noexcept -> Vector<T, 3>
+  {
+    return segment.start + (segment.end - segment.start) * project(segment, p);
+  }
+
+  /**
+   * Computes the distance from the segment to p.
+   */
+  template <typename T>
+  inline auto distance(Segment<T> const &segment, Vector<T, 3> const &p) noexcept -> T
+  {
+    return length(p - closestPoint(segment, p));
+  }
+
+  ///@}
+
+  namespace batch
+  {
+    /**
+     * @brief Views of the coordinates of count points stored as separate arrays
+     */
+    template <typename T>
+    struct PointsSoA
+    {
+      T const *x; ///< x coordinates
+      T const *y; ///< y coordinates
+      T const *z; ///< z coordinates
+    };
+
+    /**
+     * @brief Destination arrays for count points
+     */
+    template <typename T>
+    struct PointsSoAOut
+    {
+      T *x; ///< x coordinates
+      T *y; ///< y coordinates
+      T *z; ///< z coordinates
+    };
+
+    // The loops below are branch free so they vectorize.  Loops calling
+    // std::sqrt also need -fno-math-errno (implied by -ffast-math) to do so.
+
+    /**
+     * out[i] = signedDistance(plane, p[i])
+     */
+    template <typename T>
+    inline auto signedDistance(Plane<T> const &plane, PointsSoA<T> const p, T *out, std::size_t const count) noexcept -> void
+    {
+      auto const nx = plane.normal[0], ny = plane.normal[1], nz = plane.normal[2], d = plane.offset;
+      for (std::size_t i = 0; i < count; ++i)
+      {
+        out[i] = nx * p.x[i] + ny * p.y[i] + nz * p.z[i] - d;
+      }
+    }
+
+    /**
+     * out[i] = closestPoint(plane, p[i])
+     */
+    template <typename T>
+    inline auto closestPoint(Plane<T> const &plane, PointsSoA<T> const p, PointsSoAOut<T> const out, std::size_t const count) noexcept -> void
+    {
+      auto const nx = plane.normal[0], ny = plane.normal[1], nz = plane.normal[2], d = plane.offset;
+      for (std::size_t i = 0; i < count; ++i)
+      {
+        auto const s = nx * p.x[i] + ny * p.y[i] + nz * p.z[i] - d;
+        out.x[i] = p.x[i] - nx * s;
+        out.y[i] = p.y[i] - ny * s;
+        out.z[i] = p.z[i] - nz * s;
+      }
+    }
+
+    /**
+     * out[i] = signedDistance(sphere, p[i])
+     */
+    template <typename T>
+    inline auto signedDistance(Sphere<T> const &sphere, PointsSoA<T> const p, T *out, std::size_t const count) noexcept -> void
+    {
+      auto const cx = sphere.center[0], cy = sphere.center[1], cz = sphere.center[2], r = sphere.radius;
+      for (std::size_t i = 0; i < count; ++i)
+      {
+        auto const dx = p.x[i] - cx, dy = p.y[i] - cy, dz = p.z[i] - cz;
+        out[i] = std::sqrt(dx * dx + dy * dy + dz * dz) - r;
+      }
+    }
+
+    /**
+     * out[i] = closestPoint(sphere, p[i])
+     */
+    template <typename T>
+    inline auto closestPoint(Sphere<T> const &sphere, PointsSoA<T> const p, PointsSoAOut<T> const out, std::size_t const count) noexcept -> void
+    {
+      auto const cx = sphere.center[0], cy = sphere.center[1], cz = sphere.center[2], r = sphere.radius;
+      for (std::size_t i = 0; i < count; ++i)
+      {
+        auto const dx = p.x[i] - cx, dy = p.y[i] - cy, dz = p.z[i] - cz;
+        auto const len = std::sqrt(dx * dx + dy * dy + dz * dz);
+        auto const atCenter = !(len > T{0});
+        auto const s = atCenter ? T{0} : r / len;
+        out.x[i] = cx + (atCenter ? r : dx * s);
+        out.y[i] = cy + dy * s;
+        out.z[i] = cz + dz * s;
+      }
+    }
+
+    /**
+     * out[i] = project(line, p[i])
+     */
+    template <typename T>
+    inline auto project(Line<T> const &line, PointsSoA<T> const p, T *out, std::size_t const count) noexcept -> void
+    {
+      auto const ox = line.origin[0], oy = line.origin[1], oz = line.origin[2];
+      auto const inv = T{1} / lengthSquared(line.direction);
+      auto const dx = line.direction[0] * inv, dy = line.direction[1] * inv, dz = line.direction[2] * inv;
+      for (std::size_t i = 0; i < count; ++i)
+      {
+        out[i] = (p.x[i] - ox) * dx + (p.y[i] - oy) * dy + (p.z[i] - oz) * dz;
+      }
+    }
+
+    /**
+     * out[i] = closestPoint(line, p[i])
+     */
+    template <typename T>
+    inline auto closestPoint(Line<T> const &line, PointsSoA<T> const p, PointsSoAOut<T> const out, std::size_t const count) noexcept -> void
+    {
+      auto const ox = line.origin[0], oy = line.origin[1], oz = line.origin[2];
+      auto const dx = line.direction[0], dy = line.direction[1], dz = line.direction[2];
+      auto const inv = T{1} / lengthSquared(line.direction);
+      for (std::size_t i = 0; i < count; ++i)
+      {
+        auto const t = ((p.x[i] - ox) * dx + (p.y[i] - oy) * dy + (p.z[i] - oz) * dz) * inv;
+        out.x[i] = ox + dx * t;
+        out.y[i] = oy + dy * t;
+        out.z[i] = oz + dz * t;
+      }
+    }
+
+    /**
+     * out[i] = distance(line, p[i])
+     */
+    template <typename T>
+    inline auto distance(Line<T> const &line, PointsSoA<T> const p, T *out, std::size_t const count) noexcept -> void
+    {
+      auto const ox = line.origin[0], oy = line.origin[1], oz = line.origin[2];
+      auto const dx = line.direction[0], dy = line.direction[1], dz = line.direction[2];
+      auto const inv = T{1} / lengthSquared(line.direction);
+      for (std::size_t i = 0; i < count; ++i)
+      {
+        auto const vx = p.x[i] - ox, vy = p.y[i] - oy, vz = p.z[i] - oz;
+        auto const t = (vx * dx + vy * dy + vz * dz) * inv;
+        auto const ex = vx - dx * t, ey = vy - dy * t, ez = vz - dz * t;
+        out[i] = std::sqrt(ex * ex + ey * ey + ez * ez);
+      }
+    }
+
+    /**
+     * out[i] = project(segment, p[i])
+     */
+    template <typename T>
+    inline auto project(Segment<T> const &segment, PointsSoA<T> const p, T *out, std::size_t const count) noexcept -> void
+    {
+      auto const sx = segment.start[0], sy = segment.start[1], sz = segment.start[2];
+      auto const d = segment.end - segment.start;
+      auto const len2 = lengthSquared(d);
+      auto const inv = len2 > T{0} ? T{1} / len2 : T{0};
+      auto const dx = d[0] * inv, dy = d[1] * inv, dz = d[2] * inv;
+      for (std::size_t i = 0; i < count; ++i)
+      {
+        auto const t = (p.x[i] - sx) * dx + (p.y[i] - sy) * dy + (p.z[i] - sz) * dz;
+        out[i] = t < T{0} ? T{0} : (t > T{1} ? T{1} : t);
+      }
+    }
+
+    /**
+     * out[i] = closestPoint(segment, p[i])
+     */
+    template <typename T>
+    inline auto closestPoint(Segment<T> const &segment, PointsSoA<T> const p, PointsSoAOut<T> const out, std::size_t const count) noexcept -> void
+    {
+      auto const sx = segment.start[0], sy = segment.start[1], sz = segment.start[2];
+      auto const d = segment.end - segment.start;
+      auto const len2 = lengthSquared(d);
+      auto const inv = len2 > T{0} ? T{1} / len2 : T{0};
+      for (std::size_t i = 0; i < count; ++i)
+      {
+        auto t = ((p.x[i] - sx) * d[0] + (p.y[i] - sy) * d[1] + (p.z[i] - sz) * d[2]) * inv;
+        t = t < T{0} ? T{0} : (t > T{1} ? T{1} : t);
+        out.x[i] = sx + d[0] * t;
+        out.y[i] = sy + d[1] * t;
+        out.z[i] = sz + d[2] * t;
+      }
+    }
+
+    /**
+     * out[i] = distance(segment, p[i])
+     */
+    template <typename T>
+    inline auto distance(Segment<T> const &segment, PointsSoA<T> const p, T *out, std::size_t const count) noexcept -> void
+    {
+      auto const sx = segment.start[0], sy = segment.start[1], sz = segment.start[2];
+      auto const d = segment.end - segment.start;
+      auto const len2 = lengthSquared(d);
+      auto const inv = len2 > T{0} ? T{1} / len2 : T{0};
+      for (std::size_t i = 0; i < count; ++i)
+      {
+        auto const vx = p.x[i] - sx, vy = p.y[i] - sy, vz = p.z[i] - sz;
+        auto t = (vx * d[0] + vy * d[1] + vz * d[2]) * inv;
+        t = t < T{0} ? T{0} : (t > T{1} ? T{1} : t);
+        auto const ex = vx - d[0] * t, ey = vy - d[1] * t, ez = vz - d[2] * t;
+        out[i] = std::sqrt(ex * ex + ey * ey + ez * ez);
+      }
+    }
+  } // namespace batch
+
+} // namespace cagey::math
@@ -0,0 +1,755 @@
+//=============================================================================
+//
+// cagey-math - C++-17 Vector Math Library
+// Copyright (c) 2020 Kyle Girard <theycallmecoach@gmail.com>
+//
+// The MIT License (MIT)
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+//=============================================================================
+
+#pragma once
+
+/**
+ * @file
+ * @brief GJK distance and EPA penetration queries between convex shapes
+ */
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <cstddef>
+#include <initializer_list>
+#include <limits>
+#include <utility>
+
+#include "cagey-math/Geometry.hh"
+
+namespace cagey::math
+{
+
+  //==========================================================================
+  /// @name Support Functions
+  //==========================================================================
+  ///@{
+
+  /**
+   * @brief A convex hull given by its points
+   *
+   * @tparam T the type of elements of the points
+   */
+  template <typename T>
+  struct ConvexPoints
+  {
+    Vector<T, 3> const *points; ///< the points, not owned
+    std::size_t count;          ///< the number of points, at least one
+  };
+
+  /**
+   * Computes the point of sphere furthest along d.
+   */
+  template <typename T>
+  inline auto support(Sphere<T> const &sphere, Vector<T, 3> const &d) noexcept -> Vector<T, 3>
+  {
+    auto const len = length(d);
+    if (len > T{0})
+    {
+      return sphere.center + d * (sphere.radius / len);
+    }
+    return sphere.center + Vector<T, 3>::xAxis() * sphere.radius;
+  }
+
+  /**
+   * Computes the point of segment furthest along d.
+   */
+  template <typename T>
+  inline constexpr auto support(Segment<T> const &segment, Vector<T, 3> const &d) noexcept -> Vector<T, 3>
+  {
+    return dot(segment.end - segment.start, d) > T{0} ? segment.end : segment.start;
+  }
+
+  /**
+   * Computes the point of capsule furthest along d.
+   */
+  template <typename T>
+  inline auto support(Capsule<T> const &capsule, Vector<T, 3> const &d) noexcept -> Vector<T, 3>
+  {
+    return support(Sphere<T>{support(capsule.axis, d), capsule.radius}, d);
+  }
+
+  /**
+   * Computes the corner of box furthest along d.
+   */
+  template <typename T>
+  inline constexpr auto support(Box<T> const &box, Vector<T, 3> const &d) noexcept -> Vector<T, 3>
+  {
+    return {box.center[0] + (d[0] < T{0} ? -box.halfExtents[0] : box.halfExtents[0]),
+            box.center[1] + (d[1] < T{0} ? -box.halfExtents[1] : box.halfExtents[1]),
+            box.center[2] + (d[2] < T{0} ? -box.halfExtents[2] : box.halfExtents[2])};
+  }
+
+  /**
+   * Computes the point of hull furthest along d.
+   */
+  template <typename T>
+  inline constexpr auto support(ConvexPoints<T> const &hull, Vector<T, 3> const &d) noexcept -> Vector<T, 3>
+  {
+    std::size_t best = 0;
+    T bestDot = dot(hull.points[0], d);
+    for (std::size_t i = 1; i < hull.count; ++i)
+    {
+      auto const p = dot(hull.points[i], d);
+      if (p > bestDot)
+      {
+        best = i;
+        bestDot = p;
+      }
+    }
+    return hull.points[best];
+  }
+
+  /**
+   * Wrap a shape with a support() overload into a support function callback.
+   * The shape is referenced, not copied.
+   */
+  template <typename Shape>
+  inline constexpr auto supportFunction(Shape const &shape) noexcept
+  {
+    return [&shape](auto const &d) { return support(shape, d); };
+  }
+
+  ///@}
+
+  /**
+   * @brief A vertex of the Minkowski difference A - B
+   */
+  template <typename T>
+  struct SupportPoint
+  {
+    Vector<T, 3> w;         ///< a - b
+    Vector<T, 3> a;         ///< support point of A along direction
+    Vector<T, 3> b;         ///< support point of B along -direction
+    Vector<T, 3> direction; ///< the search direction that produced this point
+  };
+
+  /**
+   * @brief Up to four vertices of the Minkowski difference
+   */
+  template <typename T>
+  struct Simplex
+  {
+    std::array<SupportPoint<T>, 4> vertices; ///< the vertices
+    std::size_t count = 0;                   ///< the number of used vertices
+  };
+
+  /**
+   * @brief State kept between gjk() calls on the same pair of shapes
+   *
+   * Holds the search directions of the final simplex.  When the shapes have
+   * only moved a little the next query starts from the simplex these
+   * directions produce and usually converges in one or two iterations.
+   * Value initialize a cache to start cold.
+   */
+  template <typename T>
+  struct GjkCache
+  {
+    std::array<Vector<T, 3>, 4> directions; ///< search directions of the last simplex
+    std::size_t count = 0;                  ///< the number of cached directions
+  };
+
+  /**
+   * @brief The result of a gjk() query
+   */
+  template <typename T>
+  struct GjkResult
+  {
+    bool intersecting;      ///< true if the shapes overlap
+    T distance;             ///< distance between the shapes, 0 if intersecting
+    Vector<T, 3> pointA;    ///< closest point on A, only meaningful if not intersecting
+    Vector<T, 3> pointB;    ///< closest point on B, only meaningful if not intersecting
+    std::size_t iterations; ///< the number of support queries made
+    Simplex<T> simplex;     ///< the final simplex, the starting point for epa()
+  };
+
+  /**
+   * @brief The result of an epa() query
+   */
+  template <typename T>
+  struct PenetrationResult
+  {
+    bool valid;          ///< false if no penetration could be computed, e.g. touching shapes
+    Vector<T, 3> normal; ///< unit direction from A to B, moving B by normal * depth separates the shapes
+    T depth;             ///< the penetration depth
+    Vector<T, 3> pointA; ///< deepest point of A inside B
+    Vector<T, 3> pointB; ///< deepest point of B inside A
+  };
+
+  namespace detail::gjk
+  {
+    constexpr std::size_t MaxIterations = 64;
+
+    template <typename T>
+    constexpr auto tolerance() noexcept -> T
+    {
+      return std::numeric_limits<T>::epsilon() * T{1000};
+    }
+
+    template <typename T, typename SupportA, typename SupportB>
+    inline auto makeSupportPoint(SupportA const &supportA, SupportB const &supportB,
+                                 Vector<T, 3> const &d) -> SupportPoint<T>
+    {
+      Vector<T, 3> const a = supportA(d);
+      Vector<T, 3> const b = supportB(-d);
+      return {a - b, a, b, d};
+    }
+
+    /**
+     * Replace s with the listed (index, weight) vertices of s.
+     */
+    template <typename T>
+    inline auto keep(Simplex<T> &s, std::array<T, 4> &weights,
+                     std::initializer_list<std::pair<std::size_t, T>> vertices) noexcept -> void
+    {
+      Simplex<T> result;
+      for (auto const &v : vertices)
+      {
+        result.vertices[result.count] = s.vertices[v.first];
+        weights[result.count] = v.second;
+        ++result.count;
+      }
+      s = result;
+    }
+
+    template <typename T>
+    inline auto solveSegment(Simplex<T> &s, std::array<T, 4> &weights) noexcept -> void
+    {
+      auto const &a = s.vertices[0].w;
+      auto const ab = s.vertices[1].w - a;
+      auto const t = -dot(a, ab);
+      if (t <= T{0})
+      {
+        keep(s, weights, {{0, T{1}}});
+        return;
+      }
+      auto const denom = lengthSquared(ab);
+      if (t >= denom)
+      {
+        keep(s, weights, {{1, T{1}}});
+        return;
+      }
+      keep(s, weights, {{0, T{1} - t / denom}, {1, t / denom}});
+    }
+
+    template <typename T>
+    inline auto closest(Simplex<T> const &s, std::array<T, 4> const &weights) noexcept -> Vector<T, 3>
+    {
+      auto v = s.vertices[0].w * weights[0];
+      for (std::size_t i = 1; i < s.count; ++i)
+      {
+        v += s.vertices[i].w * weights[i];
+      }
+      return v;
+    }
+
+    /**
+     * Closest point of triangle 0, 1, 2 to the origin, Ericson's Real-Time
+     * Collision Detection 5.1.5 with the query point at the origin.
+     */
+    template <typename T>
+    inline auto solveTriangle(Simplex<T> &s, std::array<T, 4> &weights) noexcept -> void
+    {
+      auto const &a = s.vertices[0].w;
+      auto const &b = s.vertices[1].w;
+      auto const &c = s.vertices[2].w;
+      auto const ab = b - a;
+      auto const ac = c - a;
+
+      auto const d1 = -dot(ab, a);
+      auto const d2 = -dot(ac, a);
+      if (d1 <= T{0} && d2 <= T{0})
+      {
+        keep(s, weights, {{0, T{1}}});
+        return;
+      }
+
+      auto const d3 = -dot(ab, b);
+      auto const d4 = -dot(ac, b);
+      if (d3 >= T{0} && d4 <= d3)
+      {
+        keep(s, weights, {{1, T{1}}});
+        return;
+      }
+
+      auto const vc = d1 * d4 - d3 * d2;
+      if (vc <= T{0} && d1 >= T{0} && d3 <= T{0})
+      {
+        auto const v = d1 / (d1 - d3);
+        keep(s, weights, {{0, T{1} - v}, {1, v}});
+        return;
+      }
+
+      auto const d5 = -dot(ab, c);
+      auto const d6 = -dot(ac, c);
+      if (d6 >= T{0} && d5 <= d6)
+      {
+        keep(s, weights, {{2, T{1}}});
+        return;
+      }
+
+      auto const vb = d5 * d2 - d1 * d6;
+      if (vb <= T{0} && d2 >= T{0} && d6 <= T{0})
+      {
+        auto const w = d2 / (d2 - d6);
+        keep(s, weights, {{0, T{1} - w}, {2, w}});
+        return;
+      }
+
+      auto const va = d3 * d6 - d5 * d4;
+      if (va <= T{0} && (d4 - d3) >= T{0} && (d5 - d6) >= T{0})
+      {
+        auto const w = (d4 - d3) / ((d4 - d3) + (d5 - d6));
+        keep(s, weights, {{1, T{1} - w}, {2, w}});
+        return;
+      }
+
+      auto const sum = va + vb + vc;
+      if (!(sum > T{0}))
+      {
+        // degenerate triangle, fall back to its longest edge
+        auto const lab = lengthSquared(ab);
+        auto const lac = lengthSquared(ac);
+        auto const lbc = lengthSquared(c - b);
+        auto const e = lab >= lac && lab >= lbc ? std::pair<std::size_t, std::size_t>{0, 1}
+                                                : (lac >= lbc ? std::pair<std::size_t, std::size_t>{0, 2}
+                                                              : std::pair<std::size_t, std::size_t>{1, 2});
+        keep(s, weights, {{e.first, T{0}}, {e.second, T{0}}});
+        solveSegment(s, weights);
+        return;
+      }
+      auto const v = vb / sum;
+      auto const w = vc / sum;
+      keep(s, weights, {{0, T{1} - v - w}, {1, v}, {2, w}});
+    }
+
+    /**
+     * Closest point of tetrahedron 0, 1, 2, 3 to the origin.
+     *
+     * @return true if the tetrahedron contains the origin
+     */
+    template <typename T>
+    inline auto solveTetrahedron(Simplex<T> &s, std::array<T, 4> &weights) noexcept -> bool
+    {
+      constexpr std::size_t Faces[4][4] = {{0, 1, 2, 3}, {0, 2, 3, 1}, {0, 3, 1, 2}, {1, 3, 2, 0}};
+      Simplex<T> best;
+      std::array<T, 4> bestWeights{};
+      auto bestDistance = std::numeric_limits<T>::infinity();
+      bool outside = false;
+      for (auto const &f : Faces)
+      {
+        auto const &a = s.vertices[f[0]].w;
+        auto const n = cross(s.vertices[f[1]].w - a, s.vertices[f[2]].w - a);
+        auto const origin = -dot(a, n);
+        auto const opposite = dot(s.vertices[f[3]].w - a, n);
+        if (opposite != T{0} && origin * opposite >= T{0})
+        {
+          continue;
+        }
+        outside = true;
+        Simplex<T> face;
+        face.count = 3;
+        face.vertices = {s.vertices[f[0]], s.vertices[f[1]], s.vertices[f[2]], s.vertices[f[3]]};
+        std::array<T, 4> faceWeights{};
+        solveTriangle(face, faceWeights);
+        auto const d = lengthSquared(closest(face, faceWeights));
+        if (d < bestDistance)
+        {
+          bestDistance = d;
+          best = face;
+          bestWeights = faceWeights;
+        }
+      }
+      if (!outside)
+      {
+        weights = {T{0.25}, T{0.25}, T{0.25}, T{0.25}};
+        return true;
+      }
+      s = best;
+      weights = bestWeights;
+      return false;
+    }
+
+    /**
+     * Reduce s to the smallest sub simplex containing its point closest to
+     * the origin.
+     *
+     * @return true if s contains the origin
+     */
+    template <typename T>
+    inline auto solve(Simplex<T> &s, std::array<T, 4> &weights) noexcept -> bool
+    {
+      switch (s.count)
+      {
+      case 1:
+        weights[0] = T{1};
+        return false;
+      case 2:
+        solveSegment(s, weights);
+        return false;
+      case 3:
+        solveTriangle(s, weights);
+        return false;
+      default:
+        return solveTetrahedron(s, weights);
+      }
+    }
+  } // namespace detail::gjk
+
+  /**
+   * Computes the distance between two convex shapes, or whether they
+   * intersect, using the Gilbert-Johnson-Keerthi algorithm.
+   *
+   * The shapes are given by support functions, callables that return the
+   * point of the shape furthest along a direction (see supportFunction()).
+   * No memory is allocated.
+   *
+   * @param supportA support function of shape A
+   * @param supportB support function of shape B
+   * @param cache warm start state for this pair of shapes, updated on return
+   * @return the distance, closest points and final simplex
+   */
+  template <typename T, typename SupportA, typename SupportB>
+  inline auto gjk(SupportA const &supportA, SupportB const &supportB, GjkCache<T> &cache) -> GjkResult<T>
+  {
+    using namespace detail::gjk;
+    GjkResult<T> result{};
+    auto &s = result.simplex;
+    std::array<T, 4> weights{};
+
+    if (cache.count > 0)
+    {
+      for (std::size_t i = 0; i < cache.count; ++i)
+      {
+        s.vertices[s.count++] = makeSupportPoint<T>(supportA, supportB, cache.directions[i]);
+      }
+      result.iterations = cache.count;
+    }
+    else
+    {
+      s.vertices[s.count++] = makeSupportPoint<T>(supportA, supportB, Vector<T, 3>::xAxis());
+      result.iterations = 1;
+    }
+
+    Vector<T, 3> v;
+    while (true)
+    {
+      auto const enclosed = solve(s, weights);
+      v = closest(s, weights);
+      auto const vv = lengthSquared(v);
+
+      auto scale = T{0};
+      for (std::size_t i = 0; i < s.count; ++i)
+      {
+        scale = std::max(scale, lengthSquared(s.vertices[i].w));
+      }
+      if (enclosed || vv <= tolerance<T>() * tolerance<T>() * scale)
+      {
+        result.intersecting = true;
+        break;
+      }
+      if (result.iterations >= MaxIterations)
+      {
+        break;
+      }
+
+      auto const w = makeSupportPoint<T>(supportA, supportB, -v);
+      ++result.iterations;
+      if (vv - dot(v, w.w) <= tolerance<T>() * vv)
+      {
+        break;
+      }
+
+      bool duplicate = false;
+      for (std::size_t i = 0; i < s.count; ++i)
+      {
+        duplicate = duplicate || s.vertices[i].w == w.w;
+      }
+      if (duplicate)
+      {
+        break;
+      }
+      s.vertices[s.count++] = w;
+    }
+
+    cache.count = s.count;
+    for (std::size_t i = 0; i < s.count; ++i)
+    {
+      cache.directions[i] = s.vertices[i].direction;
+    }
+
+    if (result.intersecting)
+    {
+      result.distance = T{0};
+      return result;
+    }
+
+    using std::sqrt;
+    result.distance = sqrt(lengthSquared(v));
+    result.pointA = s.vertices[0].a * weights[0];
+    result.pointB = s.vertices[0].b * weights[0];
+    for (std::size_t i = 1; i < s.count; ++i)
+    {
+      result.pointA += s.vertices[i].a * weights[i];
+      result.pointB += s.vertices[i].b * weights[i];
+    }
+    return result;
+  }
+
+  namespace detail::epa
+  {
+    constexpr std::size_t MaxVertices = 64;
+    constexpr std::size_t MaxFaces = 128;
+    constexpr std::size_t MaxEdges = 3 * MaxFaces;
+    constexpr std::size_t MaxIterations = MaxVertices - 4;
+
+    template <typename T>
+    struct Face
+    {
+      std::array<std::size_t, 3> v;
+      Vector<T, 3> normal;
+      T distance;
+    };
+
+    /**
+     * Grow a simplex that ended on a point, segment or triangle into a
+     * tetrahedron.
+     *
+     * @return false if the Minkowski difference is flat, the shapes only touch
+     */
+    template <typename T, typename SupportA, typename SupportB>
+    inline auto expand(Simplex<T> &s, SupportA const &supportA, SupportB const &supportB) -> bool
+    {
+      auto const eps = gjk::tolerance<T>();
+      auto const add = [&](Vector<T, 3> const &d, auto const &accept) {
+        auto const p = gjk::makeSupportPoint<T>(supportA, supportB, d);
+        if (accept(p.w))
+        {
+          s.vertices[s.count++] = p;
+          return true;
+        }
+        return false;
+      };
+
+      if (s.count == 1)
+      {
+        Vector<T, 3> const axes[] = {Vector<T, 3>::xAxis(), Vector<T, 3>::yAxis(), Vector<T, 3>::zAxis()};
+        auto const apart = [&](Vector<T, 3> const &w) { return lengthSquared(w - s.vertices[0].w) > eps * eps; };
+        bool added = false;
+        for (std::size_t i = 0; i < 3 && !added; ++i)
+        {
+          added = add(axes[i], apart) || add(-axes[i], apart);
+        }
+        if (!added)
+        {
+          return false;
+        }
+      }
+
+      if (s.count == 2)
+      {
+        auto const ab = s.vertices[1].w - s.vertices[0].w;
+        auto const ax = std::abs(ab[0]), ay = std::abs(ab[1]), az = std::abs(ab[2]);
+        auto const e = ax <= ay && ax <= az ? Vector<T, 3>::xAxis() : (ay <= az ? Vector<T, 3>::yAxis() : Vector<T, 3>::zAxis());
+        auto const d1 = cross(ab, e);
+        auto const d2 = cross(ab, d1);
+        auto const offLine = [&](Vector<T, 3> const &w) {
+          return lengthSquared(cross(w - s.vertices[0].w, ab)) > eps * eps * lengthSquared(ab) * lengthSquared(ab);
+        };
+        if (!(add(d1, offLine) || add(-d1, offLine) || add(d2, offLine) || add(-d2, offLine)))
+        {
+          return false;
+        }
+      }
+
+      if (s.count == 3)
+      {
+        auto const n = cross(s.vertices[1].w - s.vertices[0].w, s.vertices[2].w - s.vertices[0].w);
+        auto const offPlane = [&](Vector<T, 3> const &w) {
+          auto const h = dot(w - s.vertices[0].w, n);
+          return h * h > eps * eps * lengthSquared(n) * lengthSquared(s.vertices[1].w - s.vertices[0].w);
+        };
+        if (!(add(n, offPlane) || add(-n, offPlane)))
+        {
+          return false;
+        }
+      }
+      return true;
+    }
+
+    template <typename T>
+    inline auto makeFace(std::array<SupportPoint<T>, MaxVertices> const &vertices,
+                         std::size_t a, std::size_t b, std::size_t c) noexcept -> Face<T>
+    {
+      auto n = cross(vertices[b].w - vertices[a].w, vertices[c].w - vertices[a].w);
+      auto const len = length(n);
+      n = len > T{0} ? n / len : n;
+      return {{a, b, c}, n, dot(n, vertices[a].w)};
+    }
+
+    /**
+     * Fill result from the projection of the origin onto face.
+     */
+    template <typename T>
+    inline auto contact(std::array<SupportPoint<T>, MaxVertices> const &vertices, Face<T> const &face,
+                        PenetrationResult<T> &result) noexcept -> void
+    {
+      auto const &a = vertices[face.v[0]];
+      auto const &b = vertices[face.v[1]];
+      auto const &c = vertices[face.v[2]];
+      auto const p = face.normal * face.distance;
+      auto const v0 = b.w - a.w, v1 = c.w - a.w, v2 = p - a.w;
+      auto const d00 = dot(v0, v0), d01 = dot(v0, v1), d11 = dot(v1, v1);
+      auto const d20 = dot(v2, v0), d21 = dot(v2, v1);
+      auto const denom = d00 * d11 - d01 * d01;
+      auto const v = denom != T{0} ? (d11 * d20 - d01 * d21) / denom : T{0};
+      auto const w = denom != T{0} ? (d00 * d21 - d01 * d20) / denom : T{0};
+      auto const u = T{1} - v - w;
+
+      result.valid = true;
+      result.normal = face.normal;
+      result.depth = face.distance;
+      result.pointA = a.a * u + b.a * v + c.a * w;
+      result.pointB = a.b * u + b.b * v + c.b * w;
+    }
+  } // namespace detail::epa
+
+  /**
+   * Computes the penetration depth and contact normal of two intersecting
+   * convex shapes with the Expanding Polytope Algorithm.
+   *
+   * Starts from the simplex of an intersecting gjk() result.  The polytope
+   * lives in fixed size arrays so no memory is allocated, if they fill up
+   * the best estimate so far is returned.
+   *
+   * @param supportA support function of shape A
+   * @param supportB support function of shape B
+   * @param start the result of gjk() on the same shapes
+   * @return the penetration, valid is false if start is not intersecting
+   */
+  template <typename T, typename SupportA, typename SupportB>
+  inline auto epa(SupportA const &supportA, SupportB const &supportB, GjkResult<T> const &start) -> PenetrationResult<T>
+  {
+    using namespace detail::epa;
+    PenetrationResult<T> result{};
+    if (!start.intersecting)
+    {
+      return result;
+    }
+
+    auto simplex = start.simplex;
+    if (!expand(simplex, supportA, supportB))
+    {
+      return result;
+    }
+
+    std::array<SupportPoint<T>, MaxVertices> vertices;
+    std::array<Face<T>, MaxFaces> faces;
+    std::array<std::pair<std::size_t, std::size_t>, MaxEdges> edges;
+    std::size_t vertexCount = 4;
+    std::size_t faceCount = 0;
+    for (std::size_t i = 0; i < 4; ++i)
+    {
+      vertices[i] = simplex.vertices[i];
+    }
+
+    // orient the faces of the tetrahedron outwards
+    if (dot(cross(vertices[1].w - vertices[0].w, vertices[2].w - vertices[0].w), vertices[3].w - vertices[0].w) > T{0})
+    {
+      std::swap(vertices[1], vertices[2]);
+    }
+    faces[faceCount++] = makeFace(vertices, 0, 1, 2);
+    faces[faceCount++] = makeFace(vertices, 0, 3, 1);
+    faces[faceCount++] = makeFace(vertices, 0, 2, 3);
+    faces[faceCount++] = makeFace(vertices, 1, 3, 2);
+
+    auto const eps = detail::gjk::tolerance<T>();
+    for (std::size_t iteration = 0; iteration < MaxIterations; ++iteration)
+    {
+      std::size_t closestFace = 0;
+      for (std::size_t i = 1; i < faceCount; ++i)
+      {
+        if (faces[i].distance < faces[closestFace].distance)
+        {
+          closestFace = i;
+        }
+      }
+      auto const face = faces[closestFace];
+      contact(vertices, face, result);
+
+      auto const w = detail::gjk::makeSupportPoint<T>(supportA, supportB, face.normal);
+      if (dot(w.w, face.normal) - face.distance <= eps * std::max(T{1}, face.distance) || vertexCount == MaxVertices)
+      {
+        return result;
+      }
+      auto const newVertex = vertexCount;
+      vertices[vertexCount++] = w;
+
+      // remove every face w can see, keeping the edges of the hole
+      std::size_t edgeCount = 0;
+      for (std::size_t i = 0; i < faceCount;)
+      {
+        if (dot(faces[i].normal, w.w - vertices[faces[i].v[0]].w) <= T{0})
+        {
+          ++i;
+          continue;
+        }
+        for (std::size_t e = 0; e < 3; ++e)
+        {
+          std::pair<std::size_t, std::size_t> const edge{faces[i].v[e], faces[i].v[(e + 1) % 3]};
+          bool shared = false;
+          for (std::size_t j = 0; j < edgeCount; ++j)
+          {
+            if (edges[j].first == edge.second && edges[j].second == edge.first)
+            {
+              edges[j] = edges[--edgeCount];
+              shared = true;
+              break;
+            }
+          }
+          if (!shared)
+          {
+            edges[edgeCount++] = edge;
+          }
+        }
+        faces[i] = faces[--faceCount];
+      }
+
+      if (faceCount + edgeCount > MaxFaces)
+      {
+        return result;
+      }
+      for (std::size_t j = 0; j < edgeCount; ++j)
+      {
+        faces[faceCount++] = makeFace(vertices, edges[j].first, edges[j].second, newVertex);
+      }
+    }
+    return result;
+  }
+
+} // namespace cagey::math
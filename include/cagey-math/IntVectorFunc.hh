@@ -0,0 +1,584 @@
+//=============================================================================
+//
+// cagey-math - C++-17 Vector Math Library
+// Copyright (c) 2020 Kyle Girard <theycallmecoach@gmail.com>
+//
+// The MIT License (MIT)
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+//=============================================================================
+
+#pragma once
+
+/**
+ * @file
+ * @brief Integer specific functions for single vectors and arrays of vectors
+ */
+
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <type_traits>
+
+#if defined(__SSE2__)
+#include <emmintrin.h>
+#endif
+
+#include "cagey-math/VectorFunc.hh"
+#include "cagey-math/Vector4.hh"
+
+namespace cagey::math
+{
+  namespace detail
+  {
+    template <typename T>
+    constexpr auto saturatingAdd(T const a, T const b) noexcept -> T
+    {
+      static_assert(std::is_integral<T>::value, "saturating arithmetic needs an integer type");
+      using Limits = std::numeric_limits<T>;
+      if constexpr (sizeof(T) < sizeof(std::int64_t))
+      {
+        auto const r = std::int64_t{a} + std::int64_t{b};
+        return static_cast<T>(r < Limits::min() ? Limits::min() : (r > Limits::max() ? Limits::max() : r));
+      }
+      else if constexpr (std::is_unsigned<T>::value)
+      {
+        T const r = a + b;
+        return r < a ? Limits::max() : r;
+      }
+      else
+      {
+        if (b > 0 && a > Limits::max() - b)
+        {
+          return Limits::max();
+        }
+        if (b < 0 && a < Limits::min() - b)
+        {
+          return Limits::min();
+        }
+        return a + b;
+      }
+    }
+
+    template <typename T>
+    constexpr auto saturatingSub(T const a, T const b) noexcept -> T
+    {
+      static_assert(std::is_integral<T>::value, "saturating arithmetic needs an integer type");
+      using Limits = std::numeric_limits<T>;
+      if constexpr (sizeof(T) < sizeof(std::int64_t))
+      {
+        auto const r = std::int64_t{a} - std::int64_t{b};
+        return static_cast<T>(r < Limits::min() ? Limits::min() : (r > Limits::max() ? Limits::max() : r));
+      }
+      else if constexpr (std::is_unsigned<T>::value)
+      {
+        return a < b ? T{0} : a - b;
+      }
+      else
+      {
+        if (b < 0 && a > Limits::max() + b)
+        {
+          return Limits::max();
+        }
+        if (b > 0 && a < Limits::min() + b)
+        {
+          return Limits::min();
+        }
+        return a - b;
+      }
+    }
+
+    // integer promotion makes small unsigned types signed, do the math in at least unsigned int
+    template <typename T>
+    using WrapType = std::common_type_t<std::make_unsigned_t<T>, unsigned int>;
+
+    template <typename T>
+    constexpr auto mulLo(T const a, T const b) noexcept -> T
+    {
+      return static_cast<T>(static_cast<WrapType<T>>(a) * static_cast<WrapType<T>>(b));
+    }
+
+    template <typename T>
+    constexpr auto shiftLeft(T const a, unsigned int const s) noexcept -> T
+    {
+      return static_cast<T>(static_cast<WrapType<T>>(a) << s);
+    }
+
+    template <typename T>
+    constexpr auto shiftRight(T const a, unsigned int const s) noexcept -> T
+    {
+      return static_cast<T>(a >> s);
+    }
+
+    template <typename Space>
+    constexpr auto pack(Vector<std::uint8_t, 4, Space> const &v) noexcept -> std::uint32_t
+    {
+      return std::uint32_t{v[0]} | std::uint32_t{v[1]} << 8 | std::uint32_t{v[2]} << 16 | std::uint32_t{v[3]} << 24;
+    }
+
+    template <typename Space>
+    constexpr auto unpack(std::uint32_t const v) noexcept -> Vector<std::uint8_t, 4, Space>
+    {
+      return {static_cast<std::uint8_t>(v), static_cast<std::uint8_t>(v >> 8),
+              static_cast<std::uint8_t>(v >> 16), static_cast<std::uint8_t>(v >> 24)};
+    }
+
+    namespace batch
+    {
+      // Each operation provides a scalar apply().  With SSE2 it also provides
+      // an apply() on 128 bit registers, __m128 for float and __m128i for
+      // integers, and flags the element types that apply() supports in
+      // Simd<T>.
+      struct AddSaturated
+      {
+        template <typename T>
+        static constexpr auto apply(T const a, T const b) noexcept -> T { return saturatingAdd(a, b); }
+#if defined(__SSE2__)
+        template <typename T>
+        static constexpr bool Simd = sizeof(T) <= 2;
+        static auto apply(__m128i a, __m128i b, std::uint8_t) noexcept -> __m128i { return _mm_adds_epu8(a, b); }
+        static auto apply(__m128i a, __m128i b, std::int8_t) noexcept -> __m128i { return _mm_adds_epi8(a, b); }
+        static auto apply(__m128i a, __m128i b, std::uint16_t) noexcept -> __m128i { return _mm_adds_epu16(a, b); }
+        static auto apply(__m128i a, __m128i b, std::int16_t) noexcept -> __m128i { return _mm_adds_epi16(a, b); }
+#endif
+      };
+
+      struct SubSaturated
+      {
+        template <typename T>
+        static constexpr auto apply(T const a, T const b) noexcept -> T { return saturatingSub(a, b); }
+#if defined(__SSE2__)
+        template <typename T>
+        static constexpr bool Simd = sizeof(T) <= 2;
+        static auto apply(__m128i a, __m128i b, std::uint8_t) noexcept -> __m128i { return _mm_subs_epu8(a, b); }
+        static auto apply(__m128i a, __m128i b, std::int8_t) noexcept -> __m128i { return _mm_subs_epi8(a, b); }
+        static auto apply(__m128i a, __m128i b, std::uint16_t) noexcept -> __m128i { return _mm_subs_epu16(a, b); }
+        static auto apply(__m128i a, __m128i b, std::int16_t) noexcept -> __m128i { return _mm_subs_epi16(a, b); }
+#endif
+      };
+
+      struct Min
+      {
+        template <typename T>
+        static constexpr auto apply(T const a, T const b) noexcept -> T { return b < a ? b : a; }
+#if defined(__SSE2__)
+        template <typename T>
+        static constexpr bool Simd = std::is_same<T, std::uint8_t>::value || std::is_same<T, std::int16_t>::value ||
+                                     std::is_same<T, float>::value;
+        static auto apply(__m128i a, __m128i b, std::uint8_t) noexcept -> __m128i { return _mm_min_epu8(a, b); }
+        static auto apply(__m128i a, __m128i b, std::int16_t) noexcept -> __m128i { return _mm_min_epi16(a, b); }
+        // minps returns its second operand when either is NaN, swapped to match the scalar apply()
+        static auto apply(__m128 a, __m128 b, float) noexcept -> __m128 { return _mm_min_ps(b, a); }
+#endif
+      };
+
+      struct Max
+      {
+        template <typename T>
+        static constexpr auto apply(T const a, T const b) noexcept -> T { return a < b ? b : a; }
+#if defined(__SSE2__)
+        template <typename T>
+        static constexpr bool Simd = std::is_same<T, std::uint8_t>::value || std::is_same<T, std::int16_t>::value ||
+                                     std::is_same<T, float>::value;
+        static auto apply(__m128i a, __m128i b, std::uint8_t) noexcept -> __m128i { return _mm_max_epu8(a, b); }
+        static auto apply(__m128i a, __m128i b, std::int16_t) noexcept -> __m128i { return _mm_max_epi16(a, b); }
+        // maxps returns its second operand when either is NaN, swapped to match the scalar apply()
+        static auto apply(__m128 a, __m128 b, float) noexcept -> __m128 { return _mm_max_ps(b, a); }
+#endif
+      };
+
+      struct MulLo
+      {
+        template <typename T>
+        static constexpr auto apply(T const a, T const b) noexcept -> T { return mulLo(a, b); }
+#if defined(__SSE2__)
+        template <typename T>
+        static constexpr bool Simd = sizeof(T) == 2;
+        static auto apply(__m128i a, __m128i b, std::uint16_t) noexcept -> __m128i { return _mm_mullo_epi16(a, b); }
+        static auto apply(__m128i a, __m128i b, std::int16_t) noexcept -> __m128i { return _mm_mullo_epi16(a, b); }
+#endif
+      };
+
+      // An operand of transform() is either an array or a scalar used for every element
+      template <typename T>
+      constexpr auto element(T const *source, std::size_t const i) noexcept -> T
+      {
+        return source[i];
+      }
+
+      template <typename T>
+      constexpr auto element(T const source, std::size_t) noexcept -> T
+      {
+        return source;
+      }
+
+#if defined(__SSE2__)
+      inline auto load(float const *source, std::size_t const i) noexcept -> __m128 { return _mm_loadu_ps(source + i); }
+
+      inline auto load(float const source, std::size_t) noexcept -> __m128 { return _mm_set1_ps(source); }
+
+      template <typename T>
+      inline auto load(T const *source, std::size_t const i) noexcept -> __m128i
+      {
+        return _mm_loadu_si128(reinterpret_cast<__m128i const *>(source + i));
+      }
+
+      inline auto store(float *out, __m128 const value) noexcept -> void { _mm_storeu_ps(out, value); }
+
+      template <typename T>
+      inline auto store(T *out, __m128i const value) noexcept -> void
+      {
+        _mm_storeu_si128(reinterpret_cast<__m128i *>(out), value);
+      }
+#endif
+
+      /**
+       * out[i] = Op::apply(sources[i]...) for i in [0, count), 16 bytes at a
+       * time when SSE2 supports the operation on T.  Each source is an array
+       * of T or a single T.
+       */
+      template <typename Op, typename T, typename... Sources>
+      inline auto transform(T *out, std::size_t const count, Sources const... sources) noexcept -> void
+      {
+        std::size_t i = 0;
+#if defined(__SSE2__)
+        if constexpr (Op::template Simd<T>)
+        {
+          constexpr std::size_t Lanes = 16 / sizeof(T);
+          for (std::size_t const end = count - count % Lanes; i < end; i += Lanes)
+          {
+            store(out + i, Op::apply(load(sources, i)..., T{}));
+          }
+        }
+#endif
+        for (; i < count; ++i)
+        {
+          out[i] = Op::apply(element(sources, i)...);
+        }
+      }
+
+      template <typename T, std::size_t N, typename Space>
+      inline auto flatten(Vector<T, N, Space> const *v) noexcept -> T const *
+      {
+        static_assert(sizeof(Vector<T, N, Space>) == sizeof(T[N]), "vectors must be tightly packed");
+        return reinterpret_cast<T const *>(v);
+      }
+
+      template <typename T, std::size_t N, typename Space>
+      inline auto flatten(Vector<T, N, Space> *v) noexcept -> T *
+      {
+        static_assert(sizeof(Vector<T, N, Space>) == sizeof(T[N]), "vectors must be tightly packed");
+        return reinterpret_cast<T *>(v);
+      }
+
+      template <typename T, std::size_t N, typename Space, typename Compare>
+      inline auto compareMask(Vector<T, N, Space> const *lhs, Vector<T, N, Space> const *rhs, std::uint32_t *masks,
+                              std::size_t const count, Compare compare) noexcept -> void
+      {
+        static_assert(N <= 32, "masks hold at most 32 components");
+        for (std::size_t v = 0; v < count; ++v)
+        {
+          std::uint32_t mask = 0;
+          for (std::size_t i = 0; i < N; ++i)
+          {
+            mask |= static_cast<std::uint32_t>(compare(lhs[v][i], rhs[v][i])) << i;
+          }
+          masks[v] = mask;
+        }
+      }
+    } // namespace batch
+  }   // namespace detail
+
+  //==========================================================================
+  /// @name Single Vector Functions
+  //==========================================================================
+  ///@{
+
+  /**
+   * Computes the component wise sum of lhs and rhs clamped to the range of T.
+   *
+   * @tparam T The integer type of the components
+   * @tparam N The number of components
+   *
+   * @param lhs A Vector
+   * @param rhs A Vector
+   * @return the saturated sum of lhs and rhs
+   */
+  template <typename T, std::size_t N, typename Space>
+  inline constexpr auto addSaturated(Vector<T, N, Space> lhs,
+                                     Vector<T, N, Space> const &rhs) noexcept -> Vector<T, N, Space>
+  {
+    detail::vector::forEachIndex<N>([&](std::size_t i) { lhs[i] = detail::saturatingAdd(lhs[i], rhs[i]); });
+    return lhs;
+  }
+
+  /**
+   * Computes the component wise saturated sum of four packed bytes.
+   *
+   * The bytes are added as one 32 bit word, carries are kept from crossing
+   * byte boundaries and overflowing bytes are set to 255.
+   */
+  template <typename Space>
+  inline constexpr auto addSaturated(Vector<std::uint8_t, 4, Space> const &lhs,
+                                     Vector<std::uint8_t, 4, Space> const &rhs) noexcept
+                                     -> Vector<std::uint8_t, 4, Space>
+  {
+    auto const a = detail::pack(lhs);
+    auto const b = detail::pack(rhs);
+    auto const t = (a & 0x7F7F7F7Fu) + (b & 0x7F7F7F7Fu);
+    auto const sum = t ^ ((a ^ b) & 0x80808080u);
+    auto const carry = ((a & b) | ((a | b) & ~sum)) & 0x80808080u;
+    return detail::unpack<Space>(sum | ((carry >> 7) * 0xFFu));
+  }
+
+  /**
+   * Computes the component wise difference of lhs and rhs clamped to the
+   * range of T.
+   *
+   * @tparam T The integer type of the components
+   * @tparam N The number of components
+   *
+   * @param lhs A Vector
+   * @param rhs A Vector
+   * @return the saturated difference of lhs and rhs
+   */
+  template <typename T, std::size_t N, typename Space>
+  inline constexpr auto subSaturated(Vector<T, N, Space> lhs,
+                                     Vector<T, N, Space> const &rhs) noexcept -> Vector<T, N, Space>
+  {
+    detail::vector::forEachIndex<N>([&](std::size_t i) { lhs[i] = detail::saturatingSub(lhs[i], rhs[i]); });
+    return lhs;
+  }
+
+  /**
+   * Computes the component wise saturated difference of four packed bytes.
+   *
+   * The bytes are subtracted as one 32 bit word, borrows are kept from
+   * crossing byte boundaries and underflowing bytes are set to 0.
+   */
+  template <typename Space>
+  inline constexpr auto subSaturated(Vector<std::uint8_t, 4, Space> const &lhs,
+                                     Vector<std::uint8_t, 4, Space> const &rhs) noexcept
+                                     -> Vector<std::uint8_t, 4, Space>
+  {
+    auto const a = detail::pack(lhs);
+    auto const b = detail::pack(rhs);
+    auto const t = (a | 0x80808080u) - (b & 0x7F7F7F7Fu);
+    auto const diff = t ^ ((a ^ ~b) & 0x80808080u);
+    auto const borrow = ((~a & b) | (~(a ^ b) & diff)) & 0x80808080u;
+    return detail::unpack<Space>(diff & ~((borrow >> 7) * 0xFFu));
+  }
+
+  /**
+   * Shift each component of v left by s bits.  Bits shifted out are lost.
+   *
+   * @param v A Vector
+   * @param s The number of bits to shift, less than the bit width of T
+   */
+  template <typename T, std::size_t N, typename Space>
+  inline constexpr auto shiftLeft(Vector<T, N, Space> v, unsigned int const s) noexcept -> Vector<T, N, Space>
+  {
+    detail::vector::forEachIndex<N>([&](std::size_t i) { v[i] = detail::shiftLeft(v[i], s); });
+    return v;
+  }
+
+  /**
+   * Shift each component of v right by s bits.  Signed components are
+   * shifted arithmetically.
+   *
+   * @param v A Vector
+   * @param s The number of bits to shift, less than the bit width of T
+   */
+  template <typename T, std::size_t N, typename Space>
+  inline constexpr auto shiftRight(Vector<T, N, Space> v, unsigned int const s) noexcept -> Vector<T, N, Space>
+  {
+    detail::vector::forEachIndex<N>([&](std::size_t i) { v[i] = detail::shiftRight(v[i], s); });
+    return v;
+  }
+
+  /**
+   * Compare lhs and rhs componentwise for equality.
+   *
+   * @return a mask with bit i set when lhs[i] == rhs[i]
+   */
+  template <typename T, std::size_t N, typename Space>
+  inline constexpr auto equalMask(Vector<T, N, Space> const &lhs,
+                                  Vector<T, N, Space> const &rhs) noexcept -> std::uint32_t
+  {
+    static_assert(N <= 32, "masks hold at most 32 components");
+    std::uint32_t mask = 0;
+    detail::vector::forEachIndex<N>([&](std::size_t i) { mask |= static_cast<std::uint32_t>(lhs[i] == rhs[i]) << i; });
+    return mask;
+  }
+
+  /**
+   * Compare lhs and rhs componentwise.
+   *
+   * @return a mask with bit i set when lhs[i] < rhs[i]
+   */
+  template <typename T, std::size_t N, typename Space>
+  inline constexpr auto lessMask(Vector<T, N, Space> const &lhs,
+                                 Vector<T, N, Space> const &rhs) noexcept -> std::uint32_t
+  {
+    static_assert(N <= 32, "masks hold at most 32 components");
+    std::uint32_t mask = 0;
+    detail::vector::forEachIndex<N>([&](std::size_t i) { mask |= static_cast<std::uint32_t>(lhs[i] < rhs[i]) << i; });
+    return mask;
+  }
+
+  /**
+   * Compare lhs and rhs componentwise.
+   *
+   * @return a mask with bit i set when lhs[i] > rhs[i]
+   */
+  template <typename T, std::size_t N, typename Space>
+  inline constexpr auto greaterMask(Vector<T, N, Space> const &lhs,
+                                    Vector<T, N, Space> const &rhs) noexcept -> std::uint32_t
+  {
+    return lessMask(rhs, lhs);
+  }
+
+  ///@}
+
+  /**
+   * @brief Functions applied to arrays of vectors.
+   *
+   * Each function processes count vectors.  Input and output arrays may be
+   * the same array but must not otherwise overlap.
+   */
+  namespace batch
+  {
+    /**
+     * out[i] = addSaturated(lhs[i], rhs[i])
+     */
+    template <typename T, std::size_t N, typename Space>
+    inline auto addSaturated(Vector<T, N, Space> const *lhs, Vector<T, N, Space> const *rhs,
+                             Vector<T, N, Space> *out, std::size_t const count) noexcept -> void
+    {
+      using namespace detail::batch;
+      transform<AddSaturated>(flatten(out), count * N, flatten(lhs), flatten(rhs));
+    }
+
+    /**
+     * out[i] = subSaturated(lhs[i], rhs[i])
+     */
+    template <typename T, std::size_t N, typename Space>
+    inline auto subSaturated(Vector<T, N, Space> const *lhs, Vector<T, N, Space> const *rhs,
+                             Vector<T, N, Space> *out, std::size_t const count) noexcept -> void
+    {
+      using namespace detail::batch;
+      transform<SubSaturated>(flatten(out), count * N, flatten(lhs), flatten(rhs));
+    }
+
+    /**
+     * out[i] = min(lhs[i], rhs[i])
+     */
+    template <typename T, std::size_t N, typename Space>
+    inline auto min(Vector<T, N, Space> const *lhs, Vector<T, N, Space> const *rhs,
+                    Vector<T, N, Space> *out, std::size_t const count) noexcept -> void
+    {
+      using namespace detail::batch;
+      transform<Min>(flatten(out), count * N, flatten(lhs), flatten(rhs));
+    }
+
+    /**
+     * out[i] = max(lhs[i], rhs[i])
+     */
+    template <typename T, std::size_t N, typename Space>
+    inline auto max(Vector<T, N, Space> const *lhs, Vector<T, N, Space> const *rhs,
+                    Vector<T, N, Space> *out, std::size_t const count) noexcept -> void
+    {
+      using namespace detail::batch;
+      transform<Max>(flatten(out), count * N, flatten(lhs), flatten(rhs));
+    }
+
+    /**
+     * out[i] = lhs[i] * rhs[i] keeping the low bits of each product
+     */
+    template <typename T, std::size_t N, typename Space>
+    inline auto mulLo(Vector<T, N, Space> const *lhs, Vector<T, N, Space> const *rhs,
+                      Vector<T, N, Space> *out, std::size_t const count) noexcept -> void
+    {
+      using namespace detail::batch;
+      transform<MulLo>(flatten(out), count * N, flatten(lhs), flatten(rhs));
+    }
+
+    /**
+     * out[i] = shiftLeft(v[i], s)
+     */
+    template <typename T, std::size_t N, typename Space>
+    inline auto shiftLeft(Vector<T, N, Space> const *v, unsigned int const s,
+                          Vector<T, N, Space> *out, std::size_t const count) noexcept -> void
+    {
+      auto const *src = detail::batch::flatten(v);
+      auto *dst = detail::batch::flatten(out);
+      for (std::size_t i = 0; i < count * N; ++i)
+      {
+        dst[i] = detail::shiftLeft(src[i], s);
+      }
+    }
+
+    /**
+     * out[i] = shiftRight(v[i], s)
+     */
+    template <typename T, std::size_t N, typename Space>
+    inline auto shiftRight(Vector<T, N, Space> const *v, unsigned int const s,
+                           Vector<T, N, Space> *out, std::size_t const count) noexcept -> void
+    {
+      auto const *src = detail::batch::flatten(v);
+      auto *dst = detail::batch::flatten(out);
+      for (std::size_t i = 0; i < count * N; ++i)
+      {
+        dst[i] = detail::shiftRight(src[i], s);
+      }
+    }
+
+    /**
+     * masks[i] = equalMask(lhs[i], rhs[i])
+     */
+    template <typename T, std::size_t N, typename Space>
+    inline auto equalMask(Vector<T, N, Space> const *lhs, Vector<T, N, Space> const *rhs,
+                          std::uint32_t *masks, std::size_t const count) noexcept -> void
+    {
+      detail::batch::compareMask(lhs, rhs, masks, count, [](T a, T b) { return a == b; });
+    }
+
+    /**
+     * masks[i] = lessMask(lhs[i], rhs[i])
+     */
+    template <typename T, std::size_t N, typename Space>
+    inline auto lessMask(Vector<T, N, Space> const *lhs, Vector<T, N, Space> const *rhs,
+                         std::uint32_t *masks, std::size_t const count) noexcept -> void
+    {
+      detail::batch::compareMask(lhs, rhs, masks, count, [](T a, T b) { return a < b; });
+    }
+
+    /**
+     * masks[i] = greaterMask(lhs[i], rhs[i])
+     */
+    template <typename T, std::size_t N, typename Space>
+    inline auto greaterMask(Vector<T, N, Space> const *lhs, Vector<T, N, Space> const *rhs,
+                            std::uint32_t *masks, std::size_t const count) noexcept -> void
+    {
+      detail::batch::compareMask(lhs, rhs, masks, count, [](T a, T b) { return b < a; });
+    }
+  } // namespace batch
+
+} // namespace cagey::math
@@ -0,0 +1,438 @@
+//=============================================================================
+//
+// cagey-math - C++-17 Vector Math Library
+// Copyright (c) 2020 Kyle Girard <theycallmecoach@gmail.com>
+//
+// The MIT License (MIT)
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+//=============================================================================
+
+#pragma once
+
+/**
+ * @file
+ * @brief Interval arithmetic element type for conservative bounds
+ *
+ * An Interval holds a lower and upper bound that are guaranteed to enclose
+ * the exact result of every operation applied to it.  Each operation rounds
+ * to nearest and then widens the result outwards by at least one unit in the
+ * last place, which encloses the exact result without touching the floating
+ * point rounding mode.  The widening is branch free so interval code
+ * vectorizes like plain float code.  Intervals compose through the Vector and
+ * Matrix operators, dot and cross, giving bounds on a whole expression in
+ * one pass.
+ */
+
+#include <cmath>
+#include <cstring>
+#include <limits>
+#include <type_traits>
+
+#if defined(__SSE2__)
+#include <emmintrin.h>
+#endif
+
+#include "cagey-math/detail/vec_type.hh"
+
+namespace cagey::math
+{
+  template <typename T>
+  class Interval;
+
+  namespace detail::interval
+  {
+    /**
+     * The amount v must move outwards to pass the next representable value.
+     * |v| * epsilon is at least one unit in the last place of v, the smallest
+     * normal covers values near zero even when denormals are flushed.
+     */
+    template <typename T>
+    inline auto outward(T const v) noexcept -> T
+    {
+      using std::abs;
+      return abs(v) * std::numeric_limits<T>::epsilon() + std::numeric_limits<T>::min();
+    }
+
+    /// v widened towards +inf, infinities stay put
+    template <typename T>
+    inline auto roundUp(T const v) noexcept -> T
+    {
+      T const up = v + outward(v);
+      return v < up ? up : v;
+    }
+
+    /// v widened towards -inf, infinities stay put
+    template <typename T>
+    inline auto roundDown(T const v) noexcept -> T
+    {
+      T const down = v - outward(v);
+      return down < v ? down : v;
+    }
+
+    template <typename T>
+    inline auto sum(Interval<T> const &lhs, Interval<T> const &rhs) noexcept -> Interval<T>;
+
+    template <typename T>
+    inline auto difference(Interval<T> const &lhs, Interval<T> const &rhs) noexcept -> Interval<T>;
+
+    template <typename T>
+    inline auto product(Interval<T> const &lhs, Interval<T> const &rhs) noexcept -> Interval<T>;
+
+#if defined(__SSE2__)
+    inline auto sum(Interval<float> const &lhs, Interval<float> const &rhs) noexcept -> Interval<float>;
+    inline auto difference(Interval<float> const &lhs, Interval<float> const &rhs) noexcept -> Interval<float>;
+    inline auto product(Interval<float> const &lhs, Interval<float> const &rhs) noexcept -> Interval<float>;
+    inline auto sum(Interval<double> const &lhs, Interval<double> const &rhs) noexcept -> Interval<double>;
+    inline auto difference(Interval<double> const &lhs, Interval<double> const &rhs) noexcept -> Interval<double>;
+    inline auto product(Interval<double> const &lhs, Interval<double> const &rhs) noexcept -> Interval<double>;
+#endif
+
+  } // namespace detail::interval
+
+  /**
+   * A closed interval [lower, upper] of floating point values.
+   *
+   * @tparam T the type of the bounds
+   */
+  template <typename T>
+  class Interval
+  {
+  public:
+    /** @cond doxygen has some issues with static assert */
+    static_assert(std::is_floating_point<T>::value, "Interval bounds must be floating point");
+    /** @endcond */
+
+    using Type = T; ///< Underlying type
+
+    /**
+     * Default construct an interval, the bounds are uninitialized unless
+     * value initialized.
+     */
+    constexpr Interval() = default;
+
+    /**
+     * Construct the degenerate interval holding exactly value.  Implicit so
+     * that numbers mix with intervals in expressions.
+     *
+     * @param value the value of both bounds
+     */
+    constexpr Interval(T const value) noexcept : lo{value}, hi{value} {}
+
+    /**
+     * Construct the interval [lower, upper].
+     *
+     * @param lower the lower bound
+     * @param upper the upper bound, not less than lower
+     */
+    constexpr Interval(T const lower, T const upper) noexcept : lo{lower}, hi{upper} {}
+
+    /// The lower bound
+    constexpr auto lower() const noexcept -> T { return lo; }
+
+    /// The upper bound
+    constexpr auto upper() const noexcept -> T { return hi; }
+
+    /// The distance between the bounds, rounded to nearest
+    constexpr auto width() const noexcept -> T { return hi - lo; }
+
+    /// The value half way between the bounds, rounded to nearest
+    constexpr auto midpoint() const noexcept -> T { return lo + (hi - lo) / T(2); }
+
+    /// True if value lies within the bounds
+    constexpr auto contains(T const value) const noexcept -> bool { return lo <= value && value <= hi; }
+
+    auto operator+=(Interval const &other) noexcept -> Interval & { return *this = *this + other; }
+
+    auto operator-=(Interval const &other) noexcept -> Interval & { return *this = *this - other; }
+
+    auto operator*=(Interval const &other) noexcept -> Interval & { return *this = *this * other; }
+
+    auto operator/=(Interval const &other) noexcept -> Interval & { return *this = *this / other; }
+
+    friend auto operator+(Interval const &lhs, Interval const &rhs) noexcept -> Interval
+    {
+      return detail::interval::sum(lhs, rhs);
+    }
+
+    friend auto operator-(Interval const &lhs, Interval const &rhs) noexcept -> Interval
+    {
+      return detail::interval::difference(lhs, rhs);
+    }
+
+    friend constexpr auto operator-(Interval const &val) noexcept -> Interval { return {-val.hi, -val.lo}; }
+
+    friend auto operator*(Interval const &lhs, Interval const &rhs) noexcept -> Interval
+    {
+      return detail::interval::product(lhs, rhs);
+    }
+
+    /**
+     * Divide two intervals, the result is the whole real line when rhs
+     * contains zero.
+     */
+    friend auto operator/(Interval const &lhs, Interval const &rhs) noexcept -> Interval
+    {
+      if (rhs.lo <= T(0) && T(0) <= rhs.hi)
+      {
+        return {-std::numeric_limits<T>::infinity(), std::numeric_limits<T>::infinity()};
+      }
+      T const q0 = lhs.lo / rhs.lo;
+      T const q1 = lhs.lo / rhs.hi;
+      T const q2 = lhs.hi / rhs.lo;
+      T const q3 = lhs.hi / rhs.hi;
+      using std::max;
+      using std::min;
+      return {detail::interval::roundDown(min(min(q0, q1), min(q2, q3))),
+              detail::interval::roundUp(max(max(q0, q1), max(q2, q3)))};
+    }
+
+    /// Intervals are equal when both bounds are
+    friend constexpr auto operator==(Interval const &lhs, Interval const &rhs) noexcept -> bool
+    {
+      return lhs.lo == rhs.lo && lhs.hi == rhs.hi;
+    }
+
+    friend constexpr auto operator!=(Interval const &lhs, Interval const &rhs) noexcept -> bool
+    {
+      return !(lhs == rhs);
+    }
+
+  private:
+    T lo;
+    T hi;
+  };
+
+  namespace detail::interval
+  {
+    template <typename T>
+    inline auto sum(Interval<T> const &lhs, Interval<T> const &rhs) noexcept -> Interval<T>
+    {
+      return {roundDown(lhs.lower() + rhs.lower()), roundUp(lhs.upper() + rhs.upper())};
+    }
+
+    template <typename T>
+    inline auto difference(Interval<T> const &lhs, Interval<T> const &rhs) noexcept -> Interval<T>
+    {
+      return {roundDown(lhs.lower() - rhs.upper()), roundUp(lhs.upper() - rhs.lower())};
+    }
+
+    template <typename T>
+    inline auto product(Interval<T> const &lhs, Interval<T> const &rhs) noexcept -> Interval<T>
+    {
+      T const p0 = lhs.lower() * rhs.lower();
+      T const p1 = lhs.lower() * rhs.upper();
+      T const p2 = lhs.upper() * rhs.lower();
+      T const p3 = lhs.upper() * rhs.upper();
+      using std::max;
+      using std::min;
+      return {roundDown(min(min(p0, p1), min(p2, p3))), roundUp(max(max(p0, p1), max(p2, p3)))};
+    }
+
+#if defined(__SSE2__)
+    // The SSE versions keep [lower, upper] in the low lanes of one register.
+    // Negating the lower bound turns widening both bounds outwards into
+    // widening both upwards, done for both lanes at once.
+
+    static_assert(sizeof(Interval<float>) == sizeof(float[2]), "intervals must be tightly packed");
+    static_assert(sizeof(Interval<double>) == sizeof(double[2]), "intervals must be tightly packed");
+
+    inline auto load(Interval<float> const &val) noexcept -> __m128
+    {
+      double bits;
+      std::memcpy(&bits, &val, sizeof(bits));
+      return _mm_castpd_ps(_mm_load_sd(&bits));
+    }
+
+    inline auto store(__m128 const bounds) noexcept -> Interval<float>
+    {
+      return {_mm_cvtss_f32(bounds), _mm_cvtss_f32(_mm_shuffle_ps(bounds, bounds, _MM_SHUFFLE(1, 1, 1, 1)))};
+    }
+
+    inline auto widen(__m128 const bounds) noexcept -> __m128
+    {
+      __m128 const lowerSign = _mm_setr_ps(-0.0f, 0.0f, 0.0f, 0.0f);
+      __m128 const v = _mm_xor_ps(bounds, lowerSign);
+      __m128 const magnitude = _mm_andnot_ps(_mm_set1_ps(-0.0f), v);
+      __m128 const out = _mm_add_ps(_mm_mul_ps(magnitude, _mm_set1_ps(std::numeric_limits<float>::epsilon())),
+                                    _mm_set1_ps(std::numeric_limits<float>::min()));
+      // max returns v when the sum is NaN, keeping infinities in place
+      return _mm_xor_ps(_mm_max_ps(_mm_add_ps(v, out), v), lowerSign);
+    }
+
+    inline auto sum(Interval<float> const &lhs, Interval<float> const &rhs) noexcept -> Interval<float>
+    {
+      return store(widen(_mm_add_ps(load(lhs), load(rhs))));
+    }
+
+    inline auto difference(Interval<float> const &lhs, Interval<float> const &rhs) noexcept -> Interval<float>
+    {
+      __m128 const b = load(rhs);
+      return store(widen(_mm_sub_ps(load(lhs), _mm_shuffle_ps(b, b, _MM_SHUFFLE(0, 0, 0, 1)))));
+    }
+
+    inline auto product(Interval<float> const &lhs, Interval<float> const &rhs) noexcept -> Interval<float>
+    {
+      __m128 const a = load(lhs);
+      __m128 const b = load(rhs);
+      // [alo * blo, alo * bhi, ahi * blo, ahi * bhi]
+      __m128 const p = _mm_mul_ps(_mm_shuffle_ps(a, a, _MM_SHUFFLE(1, 1, 0, 0)),
+                                  _mm_shuffle_ps(b, b, _MM_SHUFFLE(1, 0, 1, 0)));
+      __m128 const q = _mm_movehl_ps(p, p);
+      __m128 const lo = _mm_min_ps(p, q);
+      __m128 const hi = _mm_max_ps(p, q);
+      __m128 const lower = _mm_min_ss(lo, _mm_shuffle_ps(lo, lo, _MM_SHUFFLE(1, 1, 1, 1)));
+      __m128 const upper = _mm_max_ps(hi, _mm_shuffle_ps(hi, hi, _MM_SHUFFLE(0, 0, 0, 0)));
+      return store(widen(_mm_move_ss(upper, lower)));
+    }
+
+    inline auto load(Interval<double> const &val) noexcept -> __m128d
+    {
+      double bits[2];
+      std::memcpy(bits, &val, sizeof(bits));
+      return _mm_loadu_pd(bits);
+    }
+
+    inline auto store(__m128d const bounds) noexcept -> Interval<double>
+    {
+      return {_mm_cvtsd_f64(bounds), _mm_cvtsd_f64(_mm_unpackhi_pd(bounds, bounds))};
+    }
+
+    inline auto widen(__m128d const bounds) noexcept -> __m128d
+    {
+      __m128d const lowerSign = _mm_setr_pd(-0.0, 0.0);
+      __m128d const v = _mm_xor_pd(bounds, lowerSign);
+      __m128d const magnitude = _mm_andnot_pd(_mm_set1_pd(-0.0), v);
+      __m128d const out = _mm_add_pd(_mm_mul_pd(magnitude, _mm_set1_pd(std::numeric_limits<double>::epsilon())),
+                                     _mm_set1_pd(std::numeric_limits<double>::min()));
+      return _mm_xor_pd(_mm_max_pd(_mm_add_pd(v, out), v), lowerSign);
+    }
+
+    inline auto sum(Interval<double> const &lhs, Interval<double> const &rhs) noexcept -> Interval<double>
+    {
+      return store(widen(_mm_add_pd(load(lhs), load(rhs))));
+    }
+
+    inline auto difference(Interval<double> const &lhs, Interval<double> const &rhs) noexcept -> Interval<double>
+    {
+      __m128d const b = load(rhs);
+      return store(widen(_mm_sub_pd(load(lhs), _mm_shuffle_pd(b, b, 1))));
+    }
+
+    inline auto product(Interval<double> const &lhs, Interval<double> const &rhs) noexcept -> Interval<double>
+    {
+      __m128d const a = load(lhs);
+      __m128d const b = load(rhs);
+      __m128d const p01 = _mm_mul_pd(_mm_unpacklo_pd(a, a), b);
+      __m128d const p23 = _mm_mul_pd(_mm_unpackhi_pd(a, a), b);
+      __m128d const lo = _mm_min_pd(p01, p23);
+      __m128d const hi = _mm_max_pd(p01, p23);
+      __m128d const lower = _mm_min_sd(lo, _mm_unpackhi_pd(lo, lo));
+      __m128d const upper = _mm_max_pd(hi, _mm_unpacklo_pd(hi, hi));
+      return store(widen(_mm_move_sd(upper, lower)));
+    }
+#endif
+
+  } // namespace detail::interval
+
+  /**
+   * The square of val, tighter than val * val when val contains zero.
+   *
+   * @param val an interval
+   * @return an interval enclosing the squares of all values in val
+   */
+  template <typename T>
+  inline auto square(Interval<T> const &val) noexcept -> Interval<T>
+  {
+    T const lo = val.lower();
+    T const hi = val.upper();
+    if (lo >= T(0))
+    {
+      return {detail::interval::roundDown(lo * lo), detail::interval::roundUp(hi * hi)};
+    }
+    if (hi <= T(0))
+    {
+      return {detail::interval::roundDown(hi * hi), detail::interval::roundUp(lo * lo)};
+    }
+    using std::max;
+    return {T(0), detail::interval::roundUp(max(lo * lo, hi * hi))};
+  }
+
+  /**
+   * The square root of val, negative parts of val are ignored.
+   *
+   * @param val an interval
+   * @return an interval enclosing the square roots of all values in val
+   */
+  template <typename T>
+  inline auto sqrt(Interval<T> const &val) noexcept -> Interval<T>
+  {
+    using std::max;
+    using std::sqrt;
+    return {max(T(0), detail::interval::roundDown(sqrt(max(T(0), val.lower())))),
+            detail::interval::roundUp(sqrt(max(T(0), val.upper())))};
+  }
+
+  /**
+   * The magnitude of val.
+   *
+   * @param val an interval
+   * @return an interval enclosing the absolute values of all values in val
+   */
+  template <typename T>
+  inline constexpr auto abs(Interval<T> const &val) noexcept -> Interval<T>
+  {
+    if (val.lower() >= T(0))
+    {
+      return val;
+    }
+    if (val.upper() <= T(0))
+    {
+      return -val;
+    }
+    return {T(0), -val.lower() < val.upper() ? val.upper() : -val.lower()};
+  }
+
+  /**
+   * The smallest interval containing both lhs and rhs.
+   */
+  template <typename T>
+  inline constexpr auto hull(Interval<T> const &lhs, Interval<T> const &rhs) noexcept -> Interval<T>
+  {
+    return {lhs.lower() < rhs.lower() ? lhs.lower() : rhs.lower(),
+            lhs.upper() < rhs.upper() ? rhs.upper() : lhs.upper()};
+  }
+
+  /**
+   * True if lhs and rhs have a value in common.
+   */
+  template <typename T>
+  inline constexpr auto intersects(Interval<T> const &lhs, Interval<T> const &rhs) noexcept -> bool
+  {
+    return lhs.lower() <= rhs.upper() && rhs.lower() <= lhs.upper();
+  }
+
+  /// Intervals are valid vector elements when their bound type is
+  template <typename T>
+  struct is_vec_type<Interval<T>> : public is_vec_type<T>
+  {
+  };
+
+} // namespace cagey::math
@@ -0,0 +1,354 @@
+//=============================================================================
+//
+// cagey-math - C++-17 Vector Math Library
+// Copyright (c) 2020 Kyle Girard <theycallmecoach@gmail.com>
+//
+// The MIT License (MIT)
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+//=============================================================================
+
+#pragma once
+
+/**
+ * @file
+ * @brief FABRIK, CCD and damped least squares inverse kinematics solvers
+ *
+ * A chain is a flat array of joint positions, the first is the fixed root
+ * and the last is the end effector.  An optional array of the same length
+ * holds the world orientation of each joint, which turns with the bone
+ * leaving the joint; the end effector turns with the last bone.  Each solver
+ * moves the end effector towards a target while keeping the bone lengths,
+ * within a budget of iterations, and nothing is allocated.
+ */
+
+#include <cmath>
+#include <cstddef>
+#include <limits>
+
+#include "cagey-math/MatrixExp.hh"
+#include "cagey-math/detail/Parallel.hh"
+
+namespace cagey::math
+{
+
+  /**
+   * The inverse kinematics algorithms.
+   */
+  enum class IkSolver
+  {
+    Fabrik,            ///< forward and backward reaching, moves positions directly
+    Ccd,               ///< cyclic coordinate descent, turns one joint at a time
+    DampedLeastSquares ///< turns every joint at once along the damped pseudo inverse of the Jacobian
+  };
+
+  /**
+   * @brief The iteration budget and stopping criterion of the solvers
+   */
+  template <typename T>
+  struct IkOptions
+  {
+    std::size_t maxIterations = 16; ///< the most iterations
+    T tolerance = T(1e-3);          ///< stop once the end effector is this close to the target
+    T damping = T(0.1);             ///< damped least squares only, larger is steadier near singularities
+  };
+
+  /**
+   * @brief The result of an inverse kinematics solve
+   */
+  template <typename T>
+  struct IkResult
+  {
+    T distance;             ///< the final distance from the end effector to the target
+    std::size_t iterations; ///< the number of iterations used
+    bool reached;           ///< true if distance is within the tolerance
+  };
+
+  /**
+   * @brief A chain for the batch solver
+   */
+  template <typename T>
+  struct IkChain
+  {
+    Vector<T, 3> *positions;     ///< the joint positions, the root first
+    Matrix<T, 3, 3> *rotations;  ///< the joint orientations, may be null
+    std::size_t count;           ///< the number of joints, at least two
+    Vector<T, 3> target;         ///< where the end effector should go
+  };
+
+  namespace detail::ik
+  {
+    /// The number of chains each thread of the batch solver takes at a time
+    inline constexpr std::size_t Grain = 16;
+
+    /**
+     * The smallest rotation turning the direction of from into the
+     * direction of to, without trigonometry.
+     */
+    template <typename T>
+    inline auto alignment(Vector<T, 3> const &from, Vector<T, 3> const &to) noexcept -> Matrix<T, 3, 3>
+    {
+      auto const a = normalize(from);
+      auto const b = normalize(to);
+      auto const c = dot(a, b);
+      if (c > T(-1) + std::sqrt(std::numeric_limits<T>::epsilon()))
+      {
+        // I + [v]x + [v]x^2 / (1 + c) with v = a x b
+        return matexp::rodriguesMatrix(cross(a, b), T(1), T(1) / (T(1) + c));
+      }
+      // opposite directions, half a turn about any perpendicular axis
+      auto const axis = std::abs(a.x) < T(0.5) ? Vector<T, 3>{T(1), T(0), T(0)} : Vector<T, 3>{T(0), T(1), T(0)};
+      return matexp::rodriguesMatrix(normalize(cross(a, axis)), T(0), T(2));
+    }
+
+    /// Turn joints first..count-1 by rotation about the joint at pivot
+    template <typename T>
+    inline auto turn(Vector<T, 3> *positions, Matrix<T, 3, 3> *rotations, std::size_t const count,
+                     std::size_t const pivot, Matrix<T, 3, 3> const &rotation) noexcept -> void
+    {
+      auto const origin = positions[pivot];
+      for (std::size_t j = pivot + 1; j < count; ++j)
+      {
+        positions[j] = origin + rotation * (positions[j] - origin);
+      }
+      if (rotations)
+      {
+        for (std::size_t j = pivot; j < count; ++j)
+        {
+          rotations[j] = rotation * rotations[j];
+        }
+      }
+    }
+
+    /// Turn the orientation of the joint starting bone i, and the end effector with the last bone
+    template <typename T>
+    inline auto turnBone(Matrix<T, 3, 3> *rotations, std::size_t const count, std::size_t const i,
+                         Vector<T, 3> const &before, Vector<T, 3> const &after) noexcept -> void
+    {
+      auto const rotation = alignment(before, after);
+      rotations[i] = rotation * rotations[i];
+      if (i + 2 == count)
+      {
+        rotations[i + 1] = rotation * rotations[i + 1];
+      }
+    }
+
+    template <typename T>
+    inline auto result(Vector<T, 3> const *positions, std::size_t const count, Vector<T, 3> const &target,
+                       std::size_t const iterations, IkOptions<T> const &options) noexcept -> IkResult<T>
+    {
+      auto const distance = length(target - positions[count - 1]);
+      return {distance, iterations, distance <= options.tolerance};
+    }
+
+  } // namespace detail::ik
+
+  /**
+   * Move the end effector of a chain towards target with FABRIK, alternately
+   * dragging the chain from the end effector to the target and back to the
+   * root.  Targets out of reach stretch the chain straight towards them.
+   *
+   * @param positions the joint positions, the root first
+   * @param rotations the joint orientations, may be null
+   * @param count the number of joints, at least two
+   * @param target where the end effector should go
+   * @param options the iteration budget and tolerance
+   * @return the final distance to the target and the iterations used
+   */
+  template <typename T>
+  inline auto fabrik(Vector<T, 3> *positions, Matrix<T, 3, 3> *rotations, std::size_t const count,
+                     Vector<T, 3> const &target, IkOptions<T> const &options = {}) noexcept -> IkResult<T>
+  {
+    auto const root = positions[0];
+    std::size_t const last = count - 1;
+    std::size_t iteration = 0;
+    for (; iteration < options.maxIterations; ++iteration)
+    {
+      if (lengthSquared(target - positions[last]) <= options.tolerance * options.tolerance)
+      {
+        break;
+      }
+
+      // backward, pin the end effector to the target.  bone holds the bone
+      // below the joint about to move as it was before the move.
+      auto bone = positions[last] - positions[last - 1];
+      positions[last] = target;
+      for (std::size_t i = last; i-- > 0;)
+      {
+        auto const below = i > 0 ? positions[i] - positions[i - 1] : Vector<T, 3>{};
+        positions[i] = positions[i + 1] + normalize(positions[i] - positions[i + 1]) * length(bone);
+        if (rotations)
+        {
+          detail::ik::turnBone(rotations, count, i, bone, positions[i + 1] - positions[i]);
+        }
+        bone = below;
+      }
+
+      // forward, pin the root back in place
+      bone = positions[1] - positions[0];
+      positions[0] = root;
+      for (std::size_t i = 1; i < count; ++i)
+      {
+        auto const above = i < last ? positions[i + 1] - positions[i] : Vector<T, 3>{};
+        positions[i] = positions[i - 1] + normalize(positions[i] - positions[i - 1]) * length(bone);
+        if (rotations)
+        {
+          detail::ik::turnBone(rotations, count, i - 1, bone, positions[i] - positions[i - 1]);
+        }
+        bone = above;
+      }
+    }
+    return detail::ik::result(positions, count, target, iteration, options);
+  }
+
+  /**
+   * Move the end effector of a chain towards target with cyclic coordinate
+   * descent, turning each joint from the end effector back to the root so
+   * the end effector points at the target.
+   *
+   * @param positions the joint positions, the root first
+   * @param rotations the joint orientations, may be null
+   * @param count the number of joints, at least two
+   * @param target where the end effector should go
+   * @param options the iteration budget and tolerance
+   * @return the final distance to the target and the iterations used
+   */
+  template <typename T>
+  inline auto ccd(Vector<T, 3> *positions, Matrix<T, 3, 3> *rotations, std::size_t const count,
+                  Vector<T, 3> const &target, IkOptions<T> const &options = {}) noexcept -> IkResult<T>
+  {
+    std::size_t const last = count - 1;
+    std::size_t iteration = 0;
+    for (; iteration < options.maxIterations; ++iteration)
+    {
+      if (lengthSquared(target - positions[last]) <= options.tolerance * options.tolerance)
+      {
+        break;
+      }
+      for (std::size_t i = last; i-- > 0;)
+      {
+        auto const toEnd = positions[last] - positions[i];
+        auto const toTarget = target - positions[i];
+        if (lengthSquared(toEnd) > T(0) && lengthSquared(toTarget) > T(0))
+        {
+          detail::ik::turn(positions, rotations, count, i, detail::ik::alignment(toEnd, toTarget));
+        }
+      }
+    }
+    return detail::ik::result(positions, count, target, iteration, options);
+  }
+
+  /**
+   * Move the end effector of a chain towards target with damped least
+   * squares, treating every joint as a ball joint.  Each iteration turns all
+   * joints by J^T (J J^T + damping^2 I)^-1 e, where e is the offset to the
+   * target and column block i of the Jacobian J maps a rotation vector at
+   * joint i to the motion of the end effector.  J J^T is only 3x3, so the
+   * step costs one small inverse regardless of the chain length.
+   *
+   * @param positions the joint positions, the root first
+   * @param rotations the joint orientations, may be null
+   * @param count the number of joints, at least two
+   * @param target where the end effector should go
+   * @param options the iteration budget, tolerance and damping
+   * @return the final distance to the target and the iterations used
+   */
+  template <typename T>
+  inline auto dampedLeastSquares(Vector<T, 3> *positions, Matrix<T, 3, 3> *rotations, std::size_t const count,
+                                 Vector<T, 3> const &target, IkOptions<T> const &options = {}) noexcept
+      -> IkResult<T>
+  {
+    std::size_t const last = count - 1;
+    std::size_t iteration = 0;
+    for (; iteration < options.maxIterations; ++iteration)
+    {
+      auto const error = target - positions[last];
+      if (lengthSquared(error) <= options.tolerance * options.tolerance)
+      {
+        break;
+      }
+
+      // J_i w = w x r_i, so J J^T = sum |r_i|^2 I - r_i r_i^T and J_i^T y = r_i x y
+      auto const lambda2 = options.damping * options.damping;
+      Matrix<T, 3, 3> jjt{lambda2, T(0), T(0), T(0), lambda2, T(0), T(0), T(0), lambda2};
+      for (std::size_t i = 0; i < last; ++i)
+      {
+        auto const r = positions[last] - positions[i];
+        auto const r2 = lengthSquared(r);
+        for (std::size_t col = 0; col < 3; ++col)
+        {
+          for (std::size_t row = 0; row < 3; ++row)
+          {
+            jjt[col][row] += (row == col ? r2 : T(0)) - r[row] * r[col];
+          }
+        }
+      }
+      auto const y = inverse(jjt) * error;
+
+      // tip first, so each pivot is still where its step was computed
+      auto const end = positions[last];
+      for (std::size_t i = last; i-- > 0;)
+      {
+        detail::ik::turn(positions, rotations, count, i, expRotation(cross(end - positions[i], y)));
+      }
+    }
+    return detail::ik::result(positions, count, target, iteration, options);
+  }
+
+  namespace batch
+  {
+    /**
+     * Solve many independent chains, split across threads.
+     *
+     * @param solver the algorithm to use for every chain
+     * @param chains the chains, their positions and rotations are updated
+     * @param results the result of each chain
+     * @param count the number of chains
+     * @param options the iteration budget, tolerance and damping
+     * @param threads the number of threads to use, 0 uses one per hardware thread
+     */
+    template <typename T>
+    inline auto inverseKinematics(IkSolver const solver, IkChain<T> const *chains, IkResult<T> *results,
+                                  std::size_t const count, IkOptions<T> const &options = {},
+                                  unsigned int const threads = 0) -> void
+    {
+      detail::parallelFor(count, threads, detail::ik::Grain, [&](std::size_t begin, std::size_t end) {
+        for (std::size_t i = begin; i < end; ++i)
+        {
+          auto const &c = chains[i];
+          switch (solver)
+          {
+          case IkSolver::Fabrik:
+            results[i] = fabrik(c.positions, c.rotations, c.count, c.target, options);
+            break;
+          case IkSolver::Ccd:
+            results[i] = ccd(c.positions, c.rotations, c.count, c.target, options);
+            break;
+          case IkSolver::DampedLeastSquares:
+            results[i] = dampedLeastSquares(c.positions, c.rotations, c.count, c.target, options);
+            break;
+          }
+        }
+      });
+    }
+
+  } // namespace batch
+
+} // namespace cagey::math
@@ -0,0 +1,330 @@
+//=============================================================================
+//
+// cagey-math - C++-17 Vector Math Library
+// Copyright (c) 2020 Kyle Girard <theycallmecoach@gmail.com>
+//
+// The MIT License (MIT)
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+//=============================================================================
+
+#pragma once
+
+/**
+ * @file
+ * @brief Gauss-Newton and Levenberg-Marquardt solvers for small nonlinear
+ * least squares problems
+ *
+ * The solvers minimize half the sum of squared residuals of a function of P
+ * parameters.  The residual function is written once as a generic callable
+ * taking a Vector<X, P> and returning a Vector<X, M> for an element type X.
+ * It is evaluated with Dual<T, P> elements, so the Jacobian comes with the
+ * residuals in one pass and never needs to be written by hand.  All storage
+ * has a size fixed at compile time, nothing is allocated.
+ */
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <cstddef>
+#include <limits>
+
+#include "cagey-math/Dual.hh"
+#include "cagey-math/VectorFunc.hh"
+#include "cagey-math/detail/Parallel.hh"
+
+namespace cagey::math
+{
+
+  /**
+   * @brief Stopping criteria and damping of the least squares solvers
+   */
+  template <typename T>
+  struct LeastSquaresOptions
+  {
+    std::size_t maxIterations = 50;                                    ///< the most steps to try
+    T damping = T(1e-3);                                               ///< initial damping relative to diag(J^T J)
+    T gradientTolerance = std::numeric_limits<T>::epsilon();           ///< stop once max |J^T r| is below this
+    T stepTolerance = std::sqrt(std::numeric_limits<T>::epsilon());    ///< stop once |step| < tolerance * |x|
+  };
+
+  /**
+   * @brief The result of a least squares solve
+   */
+  template <typename T, std::size_t P>
+  struct LeastSquaresResult
+  {
+    Vector<T, P> parameters; ///< the best parameters found
+    T cost;                  ///< half the sum of squared residuals at parameters
+    std::size_t iterations;  ///< the number of steps tried
+    bool converged;          ///< false if maxIterations was reached or the normal equations were singular
+  };
+
+  namespace detail::leastsquares
+  {
+    /// The number of problems each thread of the batch solvers takes at a time
+    inline constexpr std::size_t Grain = 64;
+
+    /// The lower triangle of J^T J, J^T r and the cost, row major
+    template <typename T, std::size_t P>
+    struct NormalEquations
+    {
+      std::array<T, P * P> jtj;
+      std::array<T, P> jtr;
+      T cost;
+    };
+
+    template <typename T, std::size_t P, typename Residuals>
+    inline auto accumulate(Residuals const &residuals) noexcept -> NormalEquations<T, P>
+    {
+      NormalEquations<T, P> n{};
+      for (auto const &r : residuals)
+      {
+        T const value = r.value();
+        auto const &d = r.derivatives();
+        n.cost += value * value;
+        for (std::size_t i = 0; i < P; ++i)
+        {
+          n.jtr[i] += d[i] * value;
+          for (std::size_t j = 0; j <= i; ++j)
+          {
+            n.jtj[i * P + j] += d[i] * d[j];
+          }
+        }
+      }
+      n.cost *= T(0.5);
+      return n;
+    }
+
+    /// The Marquardt scaling of parameter i, its diagonal of J^T J
+    template <typename T, std::size_t P>
+    inline auto scale(NormalEquations<T, P> const &n, std::size_t const i) noexcept -> T
+    {
+      return std::max(n.jtj[i * P + i], std::numeric_limits<T>::min());
+    }
+
+    /**
+     * Solve (J^T J + damping * diag(J^T J)) step = -J^T r with a Cholesky
+     * factorization, false if the matrix is not positive definite.
+     */
+    template <typename T, std::size_t P>
+    inline auto solve(NormalEquations<T, P> const &n, T const damping, Vector<T, P> &step) noexcept -> bool
+    {
+      std::array<T, P * P> l;
+      for (std::size_t j = 0; j < P; ++j)
+      {
+        T diagonal = n.jtj[j * P + j] + damping * scale(n, j);
+        for (std::size_t k = 0; k < j; ++k)
+        {
+          diagonal -= l[j * P + k] * l[j * P + k];
+        }
+        if (!(diagonal > T(0)))
+        {
+          return false;
+        }
+        l[j * P + j] = std::sqrt(diagonal);
+        for (std::size_t i = j + 1; i < P; ++i)
+        {
+          T sum = n.jtj[i * P + j];
+          for (std::size_t k = 0; k < j; ++k)
+          {
+            sum -= l[i * P + k] * l[j * P + k];
+          }
+          l[i * P + j] = sum / l[j * P + j];
+        }
+      }
+
+      for (std::size_t i = 0; i < P; ++i)
+      {
+        T sum = -n.jtr[i];
+        for (std::size_t k = 0; k < i; ++k)
+        {
+          sum -= l[i * P + k] * step[k];
+        }
+        step[i] = sum / l[i * P + i];
+      }
+      for (std::size_t i = P; i-- > 0;)
+      {
+        T sum = step[i];
+        for (std::size_t k = i + 1; k < P; ++k)
+        {
+          sum -= l[k * P + i] * step[k];
+        }
+        step[i] = sum / l[i * P + i];
+      }
+      return true;
+    }
+
+    template <typename T, std::size_t P>
+    inline auto maxGradient(NormalEquations<T, P> const &n) noexcept -> T
+    {
+      T result = T(0);
+      for (auto const g : n.jtr)
+      {
+        result = std::max(result, std::abs(g));
+      }
+      return result;
+    }
+
+    /**
+     * Gauss-Newton when Damped is false, every step is taken.  Otherwise
+     * Levenberg-Marquardt with Nielsen's damping update, steps that do not
+     * reduce the cost are rejected and retried with more damping.
+     */
+    template <bool Damped, typename T, std::size_t P, typename F>
+    inline auto minimize(F const &residuals, Vector<T, P> x, LeastSquaresOptions<T> const &options) noexcept
+        -> LeastSquaresResult<T, P>
+    {
+      auto n = accumulate<T, P>(residuals(variables(x)));
+      T damping = Damped ? options.damping : T(0);
+      T growth = T(2);
+
+      LeastSquaresResult<T, P> result{x, n.cost, 0, false};
+      while (result.iterations < options.maxIterations)
+      {
+        ++result.iterations;
+        if (n.cost == T(0) || maxGradient(n) <= options.gradientTolerance)
+        {
+          result.converged = true;
+          break;
+        }
+
+        Vector<T, P> step;
+        if (!solve(n, damping, step))
+        {
+          if (!Damped)
+          {
+            break;
+          }
+          damping *= growth;
+          growth *= T(2);
+          continue;
+        }
+        auto const trial = x + step;
+        auto const next = accumulate<T, P>(residuals(variables(trial)));
+        if (length(step) <= options.stepTolerance * (length(x) + options.stepTolerance))
+        {
+          // a small step is also the most accurate one, keep it unless it made things worse
+          if (next.cost <= n.cost)
+          {
+            x = trial;
+            n = next;
+          }
+          result.converged = true;
+          break;
+        }
+
+        if constexpr (Damped)
+        {
+          // the reduction the damped linear model predicts, step . (damping D step - J^T r) / 2
+          T predicted = T(0);
+          for (std::size_t i = 0; i < P; ++i)
+          {
+            predicted += step[i] * (damping * scale(n, i) * step[i] - n.jtr[i]);
+          }
+          T const ratio = (n.cost - next.cost) / (T(0.5) * predicted);
+          if (!(ratio > T(0)))
+          {
+            damping *= growth;
+            growth *= T(2);
+            continue;
+          }
+          T const t = T(2) * ratio - T(1);
+          damping *= std::max(T(1) / T(3), T(1) - t * t * t);
+          growth = T(2);
+        }
+        x = trial;
+        n = next;
+      }
+
+      result.parameters = x;
+      result.cost = n.cost;
+      return result;
+    }
+
+  } // namespace detail::leastsquares
+
+  /**
+   * Minimize half the sum of squared residuals with Gauss-Newton steps.
+   * Converges quickly from a good starting point on problems with small
+   * residuals, may diverge otherwise.
+   *
+   * @param residuals callable taking Vector<Dual<T, P>, P> and returning a
+   * Vector<Dual<T, P>, M> of residuals
+   * @param initial the starting parameters
+   * @param options the stopping criteria, damping is ignored
+   * @return the parameters found and how the solve went
+   */
+  template <typename T, std::size_t P, typename F>
+  inline auto gaussNewton(F const &residuals, Vector<T, P> const &initial,
+                          LeastSquaresOptions<T> const &options = {}) noexcept -> LeastSquaresResult<T, P>
+  {
+    return detail::leastsquares::minimize<false>(residuals, initial, options);
+  }
+
+  /**
+   * Minimize half the sum of squared residuals with Levenberg-Marquardt,
+   * damping Gauss-Newton steps until they reduce the cost.
+   *
+   * @param residuals callable taking Vector<Dual<T, P>, P> and returning a
+   * Vector<Dual<T, P>, M> of residuals
+   * @param initial the starting parameters
+   * @param options the stopping criteria and initial damping
+   * @return the parameters found and how the solve went
+   */
+  template <typename T, std::size_t P, typename F>
+  inline auto levenbergMarquardt(F const &residuals, Vector<T, P> const &initial,
+                                 LeastSquaresOptions<T> const &options = {}) noexcept -> LeastSquaresResult<T, P>
+  {
+    return detail::leastsquares::minimize<true>(residuals, initial, options);
+  }
+
+  namespace batch
+  {
+    /**
+     * Solve many independent problems with Levenberg-Marquardt, split
+     * across threads.
+     *
+     * @param residuals callable taking the index of a problem and
+     * Vector<Dual<T, P>, P>, returning a Vector<Dual<T, P>, M> of residuals
+     * @param initial the starting parameters of each problem
+     * @param results the result of each problem
+     * @param count the number of problems
+     * @param options the stopping criteria and initial damping
+     * @param threads the number of threads to use, 0 uses one per hardware thread
+     */
+    template <typename T, std::size_t P, typename F>
+    inline auto levenbergMarquardt(F const &residuals, Vector<T, P> const *initial,
+                                   LeastSquaresResult<T, P> *results, std::size_t const count,
+                                   LeastSquaresOptions<T> const &options = {}, unsigned int const threads = 0)
+        -> void
+    {
+      detail::parallelFor(count, threads, detail::leastsquares::Grain, [&](std::size_t begin, std::size_t end) {
+        for (std::size_t i = begin; i < end; ++i)
+        {
+          auto const problem = [&residuals, i](auto const &x) { return residuals(i, x); };
+          results[i] = detail::leastsquares::minimize<true>(problem, initial[i], options);
+        }
+      });
+    }
+
+  } // namespace batch
+
+} // namespace cagey::math
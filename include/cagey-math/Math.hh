@@ -86,7 +86,7 @@ namespace cagey::math
   // /// Shorthand for the three element double Point
   // using Point3d = Point<double, 3>;
 
-  template <typename, std::size_t>
+  template <typename, std::size_t, typename Space = void>
   class Vector;
 
   // Shorthand for the two element Vector
@@ -139,6 +139,24 @@ namespace cagey::math
   using Matrix22i = Matrix<std::int32_t, 2, 2>;
   using Matrix22u = Matrix<std::uint32_t, 2, 2>;
 
+  // Shorthand for 3x3 square matrix
+  template <typename T>
+  using Matrix33 = Matrix<T, 3, 3>;
+  // Shorthand for 3x3 square float matrix
+  using Matrix33f = Matrix<float, 3, 3>;
+  using Matrix33d = Matrix<double, 3, 3>;
+  using Matrix33i = Matrix<std::int32_t, 3, 3>;
+  using Matrix33u = Matrix<std::uint32_t, 3, 3>;
+
+  // Shorthand for 4x4 square matrix
+  template <typename T>
+  using Matrix44 = Matrix<T, 4, 4>;
+  // Shorthand for 4x4 square float matrix
+  using Matrix44f = Matrix<float, 4, 4>;
+  using Matrix44d = Matrix<double, 4, 4>;
+  using Matrix44i = Matrix<std::int32_t, 4, 4>;
+  using Matrix44u = Matrix<std::uint32_t, 4, 4>;
+
   // // /// Shorthand for 2x3 Matrix.
   // // template <typename T> using Mat23 = Matrix<T, 2, 3>;
   // // /// Shorthand for 2x4 Matrix.
@@ -410,4 +410,10 @@ namespace cagey::math
                            lhs[0][1] * rhs[1][0] + lhs[1][1] * rhs[1][1]};
   }
 
+#if defined(CAGEY_MATH_EXTERN_TEMPLATES)
+  // instantiated once in the cagey_math library, see src/Instantiations.cc
+  extern template class Matrix<float, 2, 2>;
+  extern template class Matrix<double, 2, 2>;
+#endif
+
 } //namespace cagey::math
\ No newline at end of file
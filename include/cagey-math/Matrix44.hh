@@ -0,0 +1,423 @@
+//=============================================================================
+//
+// cagey-math - C++-17 Vector Math Library
+// Copyright (c) 2020 Kyle Girard <theycallmecoach@gmail.com>
+//
+// The MIT License (MIT)
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+//=============================================================================
+
+#pragma once
+
+/**
+ * @file
+ * @brief 4x4 element Matrix class template
+ */
+
+#include <cmath>
+#include "cagey-math/detail/Matrix.hh"
+#include "cagey-math/Vector4.hh"
+#include "cagey-math/VectorFunc.hh"
+
+namespace cagey::math
+{
+
+  /**
+   * @class Matrix
+   * 4x4 specialization of Matrix.  Matrix uses column vectors.
+   *
+   * @tparam T underlying data type of this Matrix
+   */
+  template <typename T>
+  class Matrix<T, 4, 4>
+  {
+
+  public:
+    enum : std::size_t
+    {
+      Rows = 4, ///< the number of rows in this matrix
+      Cols = 4, ///< the number of columns in this matrix
+    };
+
+    static const std::size_t Size = Rows * Cols;                                       ///< the number of elements in this matrix
+    using Type = Matrix<T, Cols, Rows>;                                                ///< The matrix type
+    using ColumnType = Vector<T, Cols>;                                                ///< The type of columns
+    using RowType = Vector<T, Rows>;                                                   ///< The type of rows
+    using ElementType = T;                                                             ///< The underlying value type
+    using Reference = ElementType &;                                                   ///< The matrix element reference type
+    using ConstReference = ElementType const &;                                        ///< The matrix element const reference type
+    using ColumnIterator = typename std::array<ColumnType, Cols>::iterator;            ///< The column iterator type
+    using ConstColumnIterator = typename std::array<ColumnType, Cols>::const_iterator; ///< The const column iterator type
+
+    //===========================================================================
+    // Static Member Functions
+    //===========================================================================
+
+    /**
+     * @brief Create matrix with all elements equal to the given value
+     * 
+     * @param v the value to assign to all elements
+     */
+    static constexpr auto fill(T const v) noexcept -> Matrix<ElementType, Cols, Rows>
+    {
+      return Matrix{v};
+    }
+
+    /**
+     * @brief Create an indentity matrix
+     * 
+     */
+    static constexpr auto identity() noexcept -> Matrix<ElementType, Cols, Rows>
+    {
+      return Matrix{{1, 0, 0, 0}, {0, 1, 0, 0}, {0, 0, 1, 0}, {0, 0, 0, 1}};
+    }
+
+    /**
+     * @brief Create a matrix with all elements set to zero
+     */
+    static constexpr auto zero() noexcept -> Matrix<ElementType, Cols, Rows>
+    {
+      return Matrix{0};
+    }
+
+    //==========================================================================
+    /// @name Implicit Constructors
+    //==========================================================================
+    ///@{
+
+    /**
+     * @brief Default constructor
+     */
+    constexpr Matrix() noexcept = default;
+
+    /**
+     * @brief Default copy consructor
+     */
+    constexpr Matrix(Matrix const &m) noexcept = default;
+
+    ///@}
+
+    //==========================================================================
+    /// @name Explicit Constructors
+    //==========================================================================
+    ///@{
+
+    /**
+     * @brief Construct matrix will all values equal to given value
+     * 
+     * @param v value for all elements
+     */
+    explicit constexpr Matrix(T v) noexcept
+        : Matrix(ColumnType{v, v, v, v}, ColumnType{v, v, v, v}, ColumnType{v, v, v, v}, ColumnType{v, v, v, v})
+    {
+    }
+
+    /**
+     * @brief Construct matrix from column vectors
+     * 
+     * @param col0 first column
+     * @param col1 second column
+     * @param col2 third column
+     * @param col3 fourth column
+     */
+    inline constexpr Matrix(ColumnType const &col0,
+                            ColumnType const &col1,
+                            ColumnType const &col2,
+                            ColumnType const &col3) noexcept
+        : columns{{col0, col1, col2, col3}}
+    {
+    }
+
+    /**
+     * @brief Construct matrix from an array of Size values
+     * 
+     * The values are assumed to be in the following order x0, y0, z0, w0, x1, ..., w3
+     * 
+     * @param elements for the given matrix.
+     */
+    inline constexpr explicit Matrix(std::array<T, Size> const &elements) noexcept
+        : Matrix(ColumnType{elements[0], elements[1], elements[2], elements[3]},
+                 ColumnType{elements[4], elements[5], elements[6], elements[7]},
+                 ColumnType{elements[8], elements[9], elements[10], elements[11]},
+                 ColumnType{elements[12], elements[13], elements[14], elements[15]})
+    {
+    }
+
+    /**
+     * @brief Construct matrix from Size values
+     * 
+     * The values are given column by column.
+     */
+    inline constexpr explicit Matrix(T const x0, T const y0, T const z0, T const w0,
+                                     T const x1, T const y1, T const z1, T const w1,
+                                     T const x2, T const y2, T const z2, T const w2,
+                                     T const x3, T const y3, T const z3, T const w3) noexcept
+        : Matrix(ColumnType{x0, y0, z0, w0}, ColumnType{x1, y1, z1, w1},
+                 ColumnType{x2, y2, z2, w2}, ColumnType{x3, y3, z3, w3})
+    {
+    }
+
+    ///@}
+
+    //==========================================================================
+    /// @name Component Access
+    //==========================================================================
+    ///@{
+
+    /**
+     * @brief Column Access
+     * 
+     * @param index 
+     */
+    inline constexpr auto operator[](std::size_t i) noexcept -> ColumnType &
+    {
+      assert(i < Cols);
+      return columns[i];
+    }
+
+    /**
+     * @brief Column Access
+     * 
+     * @param index 
+     */
+    inline constexpr auto operator[](std::size_t i) const noexcept -> ColumnType const &
+    {
+      assert(i < Cols);
+      return columns[i];
+    }
+
+    ///@}
+
+    //==========================================================================
+    /// @name Unary Operators
+    //==========================================================================
+    ///@{
+
+    inline constexpr auto operator=(Matrix<T, Cols, Rows> const &value) noexcept -> Matrix &
+    {
+      columns[0] = value.columns[0];
+      columns[1] = value.columns[1];
+      columns[2] = value.columns[2];
+      columns[3] = value.columns[3];
+      return *this;
+    }
+
+    /** 
+     * @brief Add the given value to each element in this matrix
+     * 
+     * @tparam U type of the src matrix 
+     * @param value value to add to each element
+     */
+    template <typename U>
+    inline constexpr auto operator+=(U const &value) noexcept -> Matrix &
+    {
+      columns[0] += value;
+      columns[1] += value;
+      columns[2] += value;
+      columns[3] += value;
+      return *this;
+    }
+
+    /**
+     * @brief Add the given matrix componentwise to this vector
+     *
+     * @tparam U type of the src matrix 
+     * @param value src matrix;
+     */
+    template <typename U>
+    inline constexpr auto operator+=(Matrix<U, Cols, Rows> const &value) noexcept -> Matrix &
+    {
+      columns[0] += value[0];
+      columns[1] += value[1];
+      columns[2] += value[2];
+      columns[3] += value[3];
+      return *this;
+    }
+
+    /** 
+     * @brief Subtract the given value from each element in this matrix
+     * 
+     * @tparam U type of the src matrix 
+     * @param value value to add to each element
+     */
+    template <typename U>
+    inline constexpr auto operator-=(U const &value) noexcept -> Matrix &
+    {
+      columns[0] -= value;
+      columns[1] -= value;
+      columns[2] -= value;
+      columns[3] -= value;
+      return *this;
+    }
+
+    /**
+     * @brief subtract the given matrix componentwise from this vector
+     *
+     * @tparam U type of the src matrix 
+     * @param value src matrix;
+     */
+    template <typename U>
+    inline constexpr auto operator-=(Matrix<U, Cols, Rows> const &value) noexcept -> Matrix &
+    {
+      columns[0] -= value[0];
+      columns[1] -= value[1];
+      columns[2] -= value[2];
+      columns[3] -= value[3];
+      return *this;
+    }
+
+    /** 
+     * @brief Scale all elements by the given value
+     * 
+     * @tparam U type of the scalar 
+     * @param value value to scale each element
+     */
+    template <typename U>
+    inline constexpr auto operator*=(U const &value) noexcept -> Matrix &
+    {
+      columns[0] *= value;
+      columns[1] *= value;
+      columns[2] *= value;
+      columns[3] *= value;
+      return *this;
+    }
+
+    /** 
+     * @brief Scale all elements by the given value
+     * 
+     * @tparam U type of the scalar 
+     * @param value value to scale each element
+     */
+    template <typename U>
+    inline constexpr auto operator/=(U const &value) noexcept -> Matrix &
+    {
+      columns[0] /= value;
+      columns[1] /= value;
+      columns[2] /= value;
+      columns[3] /= value;
+      return *this;
+    }
+
+    ///@}
+
+    //==========================================================================
+    /// @name Member functions
+    //==========================================================================
+    ///@{
+
+    /**
+     * @brief returns iterator to the beginning
+     */
+    inline constexpr auto columnBegin() -> ColumnIterator
+    {
+      return columns.begin();
+    }
+
+    /**
+     * @brief returns iterator to the first column
+     */
+    inline constexpr auto columnBegin() const -> ConstColumnIterator
+    {
+      return columns.begin();
+    }
+
+    /**
+     * @brief returns iterator to the end
+     */
+    inline constexpr auto columnEnd() -> ColumnIterator
+    {
+      return columns.end();
+    }
+
+    /**
+     * @brief returns iterator to the beginning
+     */
+    inline constexpr auto columnEnd() const -> ConstColumnIterator
+    {
+      return columns.end();
+    }
+
+    //@}
+
+  private:
+    union
+    {
+      std::array<ColumnType, Cols> columns;
+      ElementType data[Size];
+    };
+
+  }; // Matrix44
+
+  /**
+   * Compute the product of the matrix lhs and the column vector rhs.
+   *
+   * @tparam T The component type of the rhs and lhs
+   *
+   * @param lhs the left-hand operand
+   * @param rhs the right-hand operand
+   * @return the product of lhs and rhs
+   */
+  template <typename T>
+  inline constexpr auto operator*(Matrix<T, 4, 4> const &lhs,
+                                  typename Matrix<T, 4, 4>::RowType const &rhs) noexcept -> typename Matrix<T, 4, 4>::ColumnType
+  {
+    return lhs[0] * rhs.x + lhs[1] * rhs.y + lhs[2] * rhs.z + lhs[3] * rhs.w;
+  }
+
+  /**
+   * Compute the product of the row vector lhs and the matrix rhs.
+   *
+   * @tparam T The component type of the rhs and lhs
+   *
+   * @param lhs the left-hand operand
+   * @param rhs the right-hand operand
+   * @return the product of lhs and rhs
+   */
+  template <typename T>
+  inline constexpr auto operator*(typename Matrix<T, 4, 4>::ColumnType const &lhs,
+                                  Matrix<T, 4, 4> const &rhs) noexcept -> typename Matrix<T, 4, 4>::RowType
+  {
+    return {dot(lhs, rhs[0]), dot(lhs, rhs[1]), dot(lhs, rhs[2]), dot(lhs, rhs[3])};
+  }
+
+  /**
+   * Compute the matrix product of lhs and rhs.
+   *
+   * @tparam T The component type of the rhs and lhs
+   *
+   * @param lhs the left-hand operand
+   * @param rhs the right-hand operand
+   * @return the product of lhs and rhs
+   */
+  template <typename T>
+  inline constexpr auto operator*(Matrix<T, 4, 4> const &lhs,
+                                  Matrix<T, 4, 4> const &rhs) noexcept -> Matrix<T, 4, 4>
+  {
+    return Matrix<T, 4, 4>{lhs * rhs[0], lhs * rhs[1], lhs * rhs[2], lhs * rhs[3]};
+  }
+
+#if defined(CAGEY_MATH_EXTERN_TEMPLATES)
+  // instantiated once in the cagey_math library, see src/Instantiations.cc
+  extern template class Matrix<float, 4, 4>;
+  extern template class Matrix<double, 4, 4>;
+#endif
+
+} // namespace cagey::math
@@ -0,0 +1,413 @@
+//=============================================================================
+//
+// cagey-math - C++-17 Vector Math Library
+// Copyright (c) 2020 Kyle Girard <theycallmecoach@gmail.com>
+//
+// The MIT License (MIT)
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+//=============================================================================
+
+#pragma once
+
+/**
+ * @file
+ * @brief Matrix exponential and logarithm for small fixed size matrices
+ *
+ * Rotations and rigid transforms use the closed form Rodrigues formulas,
+ * general square matrices use Pade approximation with scaling and squaring.
+ * Nothing here allocates.
+ */
+
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <limits>
+
+#include "cagey-math/MatrixFunc.hh"
+#include "cagey-math/VectorFunc.hh"
+
+namespace cagey::math
+{
+
+  /**
+   * A twist, the logarithm of a rigid transform.  Rotates by angular (an
+   * axis scaled by the angle in radians) while moving along linear.
+   *
+   * @tparam T the component type
+   */
+  template <typename T>
+  struct Twist
+  {
+    Vector<T, 3> angular; ///< rotation vector
+    Vector<T, 3> linear;  ///< translational velocity
+  };
+
+  namespace detail::matexp
+  {
+    /**
+     * The coefficients of the Rodrigues formulas as functions of the
+     * rotation angle theta:
+     *
+     *   a = sin(t) / t
+     *   b = (1 - cos(t)) / t^2
+     *   c = (t - sin(t)) / t^3
+     *
+     * Near zero the quotients cancel catastrophically so their Taylor
+     * series are used instead.
+     */
+    template <typename T>
+    struct Rodrigues
+    {
+      T a;
+      T b;
+      T c;
+    };
+
+    template <typename T>
+    inline auto rodrigues(T const thetaSquared) noexcept -> Rodrigues<T>
+    {
+      using std::cos;
+      using std::sin;
+      using std::sqrt;
+      // the first dropped term is t^6 / 5040, below epsilon for t^2 < sqrt(epsilon)
+      if (thetaSquared < sqrt(std::numeric_limits<T>::epsilon()))
+      {
+        auto const t2 = thetaSquared;
+        return {T(1) - t2 / T(6) * (T(1) - t2 / T(20)),
+                T(1) / T(2) - t2 / T(24) * (T(1) - t2 / T(30)),
+                T(1) / T(6) - t2 / T(120) * (T(1) - t2 / T(42))};
+      }
+      auto const theta = sqrt(thetaSquared);
+      auto const s = sin(theta);
+      return {s / theta, (T(1) - cos(theta)) / thetaSquared, (theta - s) / (thetaSquared * theta)};
+    }
+
+    /// The cross product matrix of v, skew(v) * u == cross(v, u)
+    template <typename T>
+    inline constexpr auto skew(Vector<T, 3> const &v) noexcept -> Matrix<T, 3, 3>
+    {
+      return Matrix<T, 3, 3>{T(0), v[2], -v[1],
+                             -v[2], T(0), v[0],
+                             v[1], -v[0], T(0)};
+    }
+
+    /// I + a * K + b * K^2 where K is the cross product matrix of w
+    template <typename T>
+    inline auto rodriguesMatrix(Vector<T, 3> const &w, T const a, T const b) noexcept -> Matrix<T, 3, 3>
+    {
+      // K^2 = w w^T - |w|^2 I
+      auto const w2 = lengthSquared(w);
+      Matrix<T, 3, 3> result;
+      for (std::size_t c = 0; c < 3; ++c)
+      {
+        for (std::size_t r = 0; r < 3; ++r)
+        {
+          result[c][r] = b * w[c] * w[r];
+        }
+        result[c][c] += T(1) - b * w2;
+      }
+      result[1][0] -= a * w[2];
+      result[2][0] += a * w[1];
+      result[0][1] += a * w[2];
+      result[2][1] -= a * w[0];
+      result[0][2] -= a * w[1];
+      result[1][2] += a * w[0];
+      return result;
+    }
+
+    /// The maximum absolute column sum
+    template <typename T, std::size_t N>
+    inline auto normOne(Matrix<T, N, N> const &mat) noexcept -> T
+    {
+      using std::abs;
+      T result{0};
+      for (std::size_t c = 0; c < N; ++c)
+      {
+        T sum{0};
+        for (std::size_t r = 0; r < N; ++r)
+        {
+          sum += abs(mat[c][r]);
+        }
+        result = std::max(result, sum);
+      }
+      return result;
+    }
+
+    /// Degree of the diagonal Pade approximant, accurate to double precision for |A| <= 1/2
+    static constexpr int PadeDegree = 6;
+
+  } // namespace detail::matexp
+
+  /**
+   * Computes the rotation matrix of the rotation vector omega, the rotation
+   * of length(omega) radians counter clockwise about omega.
+   *
+   * @param omega the rotation vector
+   * @return the rotation matrix exp(skew(omega))
+   */
+  template <typename T>
+  inline auto expRotation(Vector<T, 3> const &omega) noexcept -> Matrix<T, 3, 3>
+  {
+    auto const k = detail::matexp::rodrigues(lengthSquared(omega));
+    return detail::matexp::rodriguesMatrix(omega, k.a, k.b);
+  }
+
+  /**
+   * Computes the rotation vector of a rotation matrix, the inverse of
+   * expRotation.  The returned angle is in [0, pi].
+   *
+   * @param rotation an orthonormal matrix with determinant 1
+   * @return the rotation vector of rotation
+   */
+  template <typename T>
+  inline auto logRotation(Matrix<T, 3, 3> const &rotation) noexcept -> Vector<T, 3>
+  {
+    using std::atan2;
+    using std::sqrt;
+    // R - R^T = 2 * a * skew(w)
+    auto const axial = Vector<T, 3>{rotation[1][2] - rotation[2][1],
+                                    rotation[2][0] - rotation[0][2],
+                                    rotation[0][1] - rotation[1][0]};
+    auto const cosine = std::clamp((rotation[0][0] + rotation[1][1] + rotation[2][2] - T(1)) / T(2), T(-1), T(1));
+    auto const sine = length(axial) / T(2);
+    // acos loses half the digits near 0 and pi, atan2 does not
+    auto const theta = atan2(sine, cosine);
+    if (cosine > T(0))
+    {
+      // away from pi sin(t) is well conditioned, t / sin(t) ~ 1 + t^2 / 6 near zero
+      auto const scale = sine < sqrt(std::numeric_limits<T>::epsilon()) ? T(1) + theta * theta / T(6) : theta / sine;
+      return axial * (scale / T(2));
+    }
+
+    // near pi the antisymmetric part vanishes, recover the axis from the
+    // symmetric part (R + R^T) / 2 = I + b * (w w^T - t^2 I)
+    auto const b = (T(1) - cosine) / (theta * theta);
+    std::size_t i = 0;
+    for (std::size_t j = 1; j < 3; ++j)
+    {
+      if (rotation[j][j] > rotation[i][i])
+      {
+        i = j;
+      }
+    }
+    Vector<T, 3> w;
+    for (std::size_t j = 0; j < 3; ++j)
+    {
+      w[j] = ((rotation[i][j] + rotation[j][i]) / T(2) - (i == j ? T(1) : T(0))) / b;
+    }
+    w[i] += theta * theta;
+    w /= sqrt(std::max(w[i], T(0)));
+    // the antisymmetric part still carries the sign of the axis
+    return dot(w, axial) < T(0) ? -w : w;
+  }
+
+  /**
+   * Computes the rigid transform of a twist, a rotation in the upper 3x3
+   * block and the translation in the last column.
+   *
+   * @param twist the rotation vector and linear velocity
+   * @return the 4x4 homogeneous transform exp(twist)
+   */
+  template <typename T>
+  inline auto expRigid(Twist<T> const &twist) noexcept -> Matrix<T, 4, 4>
+  {
+    auto const k = detail::matexp::rodrigues(lengthSquared(twist.angular));
+    auto const rotation = detail::matexp::rodriguesMatrix(twist.angular, k.a, k.b);
+    auto const translation = detail::matexp::rodriguesMatrix(twist.angular, k.b, k.c) * twist.linear;
+    return Matrix<T, 4, 4>{rotation[0][0], rotation[0][1], rotation[0][2], T(0),
+                           rotation[1][0], rotation[1][1], rotation[1][2], T(0),
+                           rotation[2][0], rotation[2][1], rotation[2][2], T(0),
+                           translation[0], translation[1], translation[2], T(1)};
+  }
+
+  /**
+   * Computes the twist of a rigid transform, the inverse of expRigid.
+   *
+   * @param transform a 4x4 homogeneous transform with an orthonormal upper 3x3 block
+   * @return the twist of transform
+   */
+  template <typename T>
+  inline auto logRigid(Matrix<T, 4, 4> const &transform) noexcept -> Twist<T>
+  {
+    auto const rotation = Matrix<T, 3, 3>{transform[0][0], transform[0][1], transform[0][2],
+                                          transform[1][0], transform[1][1], transform[1][2],
+                                          transform[2][0], transform[2][1], transform[2][2]};
+    auto const omega = logRotation(rotation);
+    auto const t2 = lengthSquared(omega);
+    // V^-1 = I - K / 2 + d * K^2 with d = (1 - a / (2 b)) / t^2
+    auto d = T(1) / T(12) + t2 / T(720) * (T(1) + t2 / T(42));
+    if (t2 >= std::sqrt(std::numeric_limits<T>::epsilon()))
+    {
+      auto const k = detail::matexp::rodrigues(t2);
+      d = (T(1) - k.a / (T(2) * k.b)) / t2;
+    }
+    auto const translation = Vector<T, 3>{transform[3][0], transform[3][1], transform[3][2]};
+    return {omega, detail::matexp::rodriguesMatrix(omega, T(-1) / T(2), d) * translation};
+  }
+
+  /**
+   * Computes the exponential of a general square matrix with a diagonal Pade
+   * approximant after scaling the matrix to unit norm, then squares the
+   * result back.  Prefer expRotation and expRigid when the matrix is known
+   * to be a rotation or a rigid motion generator.
+   *
+   * @param mat a square matrix
+   * @return the matrix exponential of mat
+   */
+  template <typename T, std::size_t N>
+  inline auto exp(Matrix<T, N, N> const &mat) noexcept -> Matrix<T, N, N>
+  {
+    using std::frexp;
+    using std::ldexp;
+    // scale so that |A| <= 1/2
+    int exponent = 0;
+    frexp(detail::matexp::normOne(mat), &exponent);
+    auto const squarings = std::max(0, exponent + 1);
+    auto a = mat;
+    a *= ldexp(T(1), -squarings);
+
+    // numerator and denominator of the [q/q] approximant, the denominator
+    // is the numerator evaluated at -A
+    auto const identity = Matrix<T, N, N>::identity();
+    auto power = a;
+    auto c = T(1) / T(2);
+    auto numerator = identity;
+    auto denominator = identity;
+    auto term = a;
+    term *= c;
+    numerator += term;
+    denominator -= term;
+    constexpr auto q = detail::matexp::PadeDegree;
+    for (int k = 2; k <= q; ++k)
+    {
+      c = c * T(q - k + 1) / T(k * (2 * q - k + 1));
+      power = a * power;
+      term = power;
+      term *= c;
+      numerator += term;
+      if (k % 2 == 0)
+      {
+        denominator += term;
+      }
+      else
+      {
+        denominator -= term;
+      }
+    }
+
+    auto result = inverse(denominator) * numerator;
+    for (int k = 0; k < squarings; ++k)
+    {
+      result = result * result;
+    }
+    return result;
+  }
+
+  namespace batch
+  {
+    /**
+     * Computes expRotation of each rotation vector.
+     *
+     * @param omegas the rotation vectors
+     * @param count the number of rotation vectors
+     * @param rotations receives one rotation matrix per rotation vector
+     */
+    template <typename T>
+    inline auto expRotation(Vector<T, 3> const *omegas, std::size_t const count, Matrix<T, 3, 3> *rotations) noexcept
+        -> void
+    {
+      for (std::size_t i = 0; i < count; ++i)
+      {
+        rotations[i] = math::expRotation(omegas[i]);
+      }
+    }
+
+    /**
+     * Computes logRotation of each rotation matrix.
+     *
+     * @param rotations the rotation matrices
+     * @param count the number of rotation matrices
+     * @param omegas receives one rotation vector per rotation matrix
+     */
+    template <typename T>
+    inline auto logRotation(Matrix<T, 3, 3> const *rotations, std::size_t const count, Vector<T, 3> *omegas) noexcept
+        -> void
+    {
+      for (std::size_t i = 0; i < count; ++i)
+      {
+        omegas[i] = math::logRotation(rotations[i]);
+      }
+    }
+
+    /**
+     * Computes expRigid of each twist.
+     *
+     * @param twists the twists
+     * @param count the number of twists
+     * @param transforms receives one transform per twist
+     */
+    template <typename T>
+    inline auto expRigid(Twist<T> const *twists, std::size_t const count, Matrix<T, 4, 4> *transforms) noexcept
+        -> void
+    {
+      for (std::size_t i = 0; i < count; ++i)
+      {
+        transforms[i] = math::expRigid(twists[i]);
+      }
+    }
+
+    /**
+     * Computes logRigid of each transform.
+     *
+     * @param transforms the rigid transforms
+     * @param count the number of transforms
+     * @param twists receives one twist per transform
+     */
+    template <typename T>
+    inline auto logRigid(Matrix<T, 4, 4> const *transforms, std::size_t const count, Twist<T> *twists) noexcept
+        -> void
+    {
+      for (std::size_t i = 0; i < count; ++i)
+      {
+        twists[i] = math::logRigid(transforms[i]);
+      }
+    }
+
+    /**
+     * Computes the exponential of each square matrix.
+     *
+     * @param matrices the matrices
+     * @param count the number of matrices
+     * @param results receives one matrix exponential per matrix
+     */
+    template <typename T, std::size_t N>
+    inline auto exp(Matrix<T, N, N> const *matrices, std::size_t const count, Matrix<T, N, N> *results) noexcept
+        -> void
+    {
+      for (std::size_t i = 0; i < count; ++i)
+      {
+        results[i] = math::exp(matrices[i]);
+      }
+    }
+
+  } // namespace batch
+
+} // namespace cagey::math
@@ -32,6 +32,9 @@
  */
 
 #include "cagey-math/Matrix22.hh"
+#include "cagey-math/Matrix33.hh"
+#include "cagey-math/Matrix44.hh"
+#include "cagey-math/VectorFunc.hh"
 
 namespace cagey::math
 {
@@ -51,6 +54,39 @@ namespace cagey::math
       }
     };
 
+    template <typename T>
+    struct determinantImpl<T, 3, 3>
+    {
+      static constexpr auto exec(Matrix<T, 3, 3> const &mat) -> T
+      {
+        return mat[0][0] * (mat[1][1] * mat[2][2] - mat[2][1] * mat[1][2]) -
+               mat[1][0] * (mat[0][1] * mat[2][2] - mat[2][1] * mat[0][2]) +
+               mat[2][0] * (mat[0][1] * mat[1][2] - mat[1][1] * mat[0][2]);
+      }
+    };
+
+    template <typename T>
+    struct determinantImpl<T, 4, 4>
+    {
+      static constexpr auto exec(Matrix<T, 4, 4> const &a) -> T
+      {
+        // Laplace expansion along the first two columns
+        auto const s0 = a[0][0] * a[1][1] - a[1][0] * a[0][1];
+        auto const s1 = a[0][0] * a[1][2] - a[1][0] * a[0][2];
+        auto const s2 = a[0][0] * a[1][3] - a[1][0] * a[0][3];
+        auto const s3 = a[0][1] * a[1][2] - a[1][1] * a[0][2];
+        auto const s4 = a[0][1] * a[1][3] - a[1][1] * a[0][3];
+        auto const s5 = a[0][2] * a[1][3] - a[1][2] * a[0][3];
+        auto const c5 = a[2][2] * a[3][3] - a[3][2] * a[2][3];
+        auto const c4 = a[2][1] * a[3][3] - a[3][1] * a[2][3];
+        auto const c3 = a[2][1] * a[3][2] - a[3][1] * a[2][2];
+        auto const c2 = a[2][0] * a[3][3] - a[3][0] * a[2][3];
+        auto const c1 = a[2][0] * a[3][2] - a[3][0] * a[2][2];
+        auto const c0 = a[2][0] * a[3][1] - a[3][0] * a[2][1];
+        return s0 * c5 - s1 * c4 + s2 * c3 + s3 * c2 - s4 * c1 + s5 * c0;
+      }
+    };
+
     template <typename T, std::size_t C, std::size_t R>
     struct transposeImpl
     {
@@ -70,6 +106,29 @@ namespace cagey::math
       }
     };
 
+    template <typename T>
+    struct transposeImpl<T, 3, 3>
+    {
+      static constexpr auto exec(Matrix<T, 3, 3> const &mat) -> Matrix<T, 3, 3>
+      {
+        return Matrix<T, 3, 3>{mat[0][0], mat[1][0], mat[2][0],
+                               mat[0][1], mat[1][1], mat[2][1],
+                               mat[0][2], mat[1][2], mat[2][2]};
+      }
+    };
+
+    template <typename T>
+    struct transposeImpl<T, 4, 4>
+    {
+      static constexpr auto exec(Matrix<T, 4, 4> const &mat) -> Matrix<T, 4, 4>
+      {
+        return Matrix<T, 4, 4>{mat[0][0], mat[1][0], mat[2][0], mat[3][0],
+                               mat[0][1], mat[1][1], mat[2][1], mat[3][1],
+                               mat[0][2], mat[1][2], mat[2][2], mat[3][2],
+                               mat[0][3], mat[1][3], mat[2][3], mat[3][3]};
+      }
+    };
+
     template <typename T, std::size_t C, std::size_t R>
     struct inverseImpl
     {
@@ -88,17 +147,61 @@ namespace cagey::math
       }
     };
 
-    // template <typename T>
-    // struct inverseImpl<T, 3, 3>
-    // {
-    //   static constexpr auto exec(Matrix<T, 3, 3> const &mat) -> Matrix<T, 3, 3>
-    //   {
-    //     auto invDet = static_cast<T>(1) / determinant(mat);
-    //     return Matrix<T, 3, 3> { + mat[0][0] * (mat[1][1] * mat[2][2] - mat[2][1] * mat[1][2])
-    // 		- mat[1][0] * (mat[0][1] * mat[2][2] - mat[2][1] * mat[0][2])
-    // 		+ mat[2][0] * (mat[0][1] * mat[1][2] - mat[1][1] * mat[0][2]));
-    // //   }
-    // };
+    template <typename T>
+    struct inverseImpl<T, 3, 3>
+    {
+      static constexpr auto exec(Matrix<T, 3, 3> const &mat) -> Matrix<T, 3, 3>
+      {
+        // the columns of the adjugate transposed are cross products of the columns
+        auto const invDet = static_cast<T>(1) / determinant(mat);
+        auto const r0 = cross(mat[1], mat[2]) * invDet;
+        auto const r1 = cross(mat[2], mat[0]) * invDet;
+        auto const r2 = cross(mat[0], mat[1]) * invDet;
+        return Matrix<T, 3, 3>{r0[0], r1[0], r2[0],
+                               r0[1], r1[1], r2[1],
+                               r0[2], r1[2], r2[2]};
+      }
+    };
+
+    template <typename T>
+    struct inverseImpl<T, 4, 4>
+    {
+      static constexpr auto exec(Matrix<T, 4, 4> const &a) -> Matrix<T, 4, 4>
+      {
+        // 2x2 minors of the first two and last two columns, shared between
+        // the determinant and every cofactor
+        auto const s0 = a[0][0] * a[1][1] - a[1][0] * a[0][1];
+        auto const s1 = a[0][0] * a[1][2] - a[1][0] * a[0][2];
+        auto const s2 = a[0][0] * a[1][3] - a[1][0] * a[0][3];
+        auto const s3 = a[0][1] * a[1][2] - a[1][1] * a[0][2];
+        auto const s4 = a[0][1] * a[1][3] - a[1][1] * a[0][3];
+        auto const s5 = a[0][2] * a[1][3] - a[1][2] * a[0][3];
+        auto const c5 = a[2][2] * a[3][3] - a[3][2] * a[2][3];
+        auto const c4 = a[2][1] * a[3][3] - a[3][1] * a[2][3];
+        auto const c3 = a[2][1] * a[3][2] - a[3][1] * a[2][2];
+        auto const c2 = a[2][0] * a[3][3] - a[3][0] * a[2][3];
+        auto const c1 = a[2][0] * a[3][2] - a[3][0] * a[2][2];
+        auto const c0 = a[2][0] * a[3][1] - a[3][0] * a[2][1];
+        auto const invDet = static_cast<T>(1) / (s0 * c5 - s1 * c4 + s2 * c3 + s3 * c2 - s4 * c1 + s5 * c0);
+        return Matrix<T, 4, 4>{
+            (+a[1][1] * c5 - a[1][2] * c4 + a[1][3] * c3) * invDet,
+            (-a[0][1] * c5 + a[0][2] * c4 - a[0][3] * c3) * invDet,
+            (+a[3][1] * s5 - a[3][2] * s4 + a[3][3] * s3) * invDet,
+            (-a[2][1] * s5 + a[2][2] * s4 - a[2][3] * s3) * invDet,
+            (-a[1][0] * c5 + a[1][2] * c2 - a[1][3] * c1) * invDet,
+            (+a[0][0] * c5 - a[0][2] * c2 + a[0][3] * c1) * invDet,
+            (-a[3][0] * s5 + a[3][2] * s2 - a[3][3] * s1) * invDet,
+            (+a[2][0] * s5 - a[2][2] * s2 + a[2][3] * s1) * invDet,
+            (+a[1][0] * c4 - a[1][1] * c2 + a[1][3] * c0) * invDet,
+            (-a[0][0] * c4 + a[0][1] * c2 - a[0][3] * c0) * invDet,
+            (+a[3][0] * s4 - a[3][1] * s2 + a[3][3] * s0) * invDet,
+            (-a[2][0] * s4 + a[2][1] * s2 - a[2][3] * s0) * invDet,
+            (-a[1][0] * c3 + a[1][1] * c1 - a[1][2] * c0) * invDet,
+            (+a[0][0] * c3 - a[0][1] * c1 + a[0][2] * c0) * invDet,
+            (-a[3][0] * s3 + a[3][1] * s1 - a[3][2] * s0) * invDet,
+            (+a[2][0] * s3 - a[2][1] * s1 + a[2][2] * s0) * invDet};
+      }
+    };
 
   } // namespace detail
 
@@ -137,4 +240,26 @@ namespace cagey::math
     return detail::inverseImpl<T, C, R>::exec(mat);
   }
 
+#if defined(CAGEY_MATH_EXTERN_TEMPLATES)
+  // instantiated once in the cagey_math library, see src/Instantiations.cc
+  extern template auto determinant(Matrix<float, 2, 2> const &) -> float;
+  extern template auto transpose(Matrix<float, 2, 2> const &) -> Matrix<float, 2, 2>;
+  extern template auto inverse(Matrix<float, 2, 2> const &) -> Matrix<float, 2, 2>;
+  extern template auto determinant(Matrix<float, 3, 3> const &) -> float;
+  extern template auto transpose(Matrix<float, 3, 3> const &) -> Matrix<float, 3, 3>;
+  extern template auto inverse(Matrix<float, 3, 3> const &) -> Matrix<float, 3, 3>;
+  extern template auto determinant(Matrix<float, 4, 4> const &) -> float;
+  extern template auto transpose(Matrix<float, 4, 4> const &) -> Matrix<float, 4, 4>;
+  extern template auto inverse(Matrix<float, 4, 4> const &) -> Matrix<float, 4, 4>;
+  extern template auto determinant(Matrix<double, 2, 2> const &) -> double;
+  extern template auto transpose(Matrix<double, 2, 2> const &) -> Matrix<double, 2, 2>;
+  extern template auto inverse(Matrix<double, 2, 2> const &) -> Matrix<double, 2, 2>;
+  extern template auto determinant(Matrix<double, 3, 3> const &) -> double;
+  extern template auto transpose(Matrix<double, 3, 3> const &) -> Matrix<double, 3, 3>;
+  extern template auto inverse(Matrix<double, 3, 3> const &) -> Matrix<double, 3, 3>;
+  extern template auto determinant(Matrix<double, 4, 4> const &) -> double;
+  extern template auto transpose(Matrix<double, 4, 4> const &) -> Matrix<double, 4, 4>;
+  extern template auto inverse(Matrix<double, 4, 4> const &) -> Matrix<double, 4, 4>;
+#endif
+
 } // namespace cagey::math
\ No newline at end of file
@@ -0,0 +1,330 @@
+//=============================================================================
+//
+// cagey-math - C++-17 Vector Math Library
+// Copyright (c) 2020 Kyle Girard <theycallmecoach@gmail.com>
+//
+// The MIT License (MIT)
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+//=============================================================================
+
+#pragma once
+
+/**
+ * @file
+ * @brief Normals, tangents, area and volume of indexed triangle meshes
+ */
+
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+#include "cagey-math/Vector2.hh"
+#include "cagey-math/Vector3.hh"
+#include "cagey-math/Vector4.hh"
+#include "cagey-math/VectorFunc.hh"
+#include "cagey-math/detail/Parallel.hh"
+
+namespace cagey::math
+{
+
+  namespace detail::mesh
+  {
+    /// Triangles and vertices are split into ranges of at least this many per thread
+    constexpr std::size_t Grain = 1 << 12;
+
+    template <typename T>
+    struct Triangle
+    {
+      Vector<T, 3> a, b, c;
+    };
+
+    template <typename T>
+    inline auto triangle(Vector<T, 3> const *positions, std::uint32_t const *indices, std::size_t const t) noexcept
+        -> Triangle<T>
+    {
+      return {positions[indices[3 * t]], positions[indices[3 * t + 1]], positions[indices[3 * t + 2]]};
+    }
+
+    /**
+     * @return vec scaled to unit length, or zero if vec is zero
+     */
+    template <typename T>
+    inline auto safeNormalize(Vector<T, 3> const &vec) noexcept -> Vector<T, 3>
+    {
+      auto const len = length(vec);
+      return vec * (len > T{0} ? T{1} / len : T{0});
+    }
+
+    /**
+     * @brief Accumulated tangent and bitangent directions of a vertex
+     */
+    template <typename T>
+    struct TangentFrame
+    {
+      Vector<T, 3> s;
+      Vector<T, 3> t;
+
+      auto operator+=(TangentFrame const &rhs) noexcept -> TangentFrame &
+      {
+        s += rhs.s;
+        t += rhs.t;
+        return *this;
+      }
+    };
+
+    /**
+     * Call fn(t, accumulator) for every triangle, each thread scattering
+     * into its own per vertex accumulator.  The accumulators are then summed
+     * in range order, in parallel over vertex ranges, so the result does not
+     * depend on which thread finishes first.
+     *
+     * @return the per vertex sums
+     */
+    template <typename Value, typename Fn>
+    inline auto scatter(std::size_t const vertexCount, std::size_t const triangleCount, unsigned int const threads,
+                        Fn const &fn) -> std::vector<Value>
+    {
+      auto const chunk = parallelChunk(triangleCount, threads, Grain);
+      std::vector<std::vector<Value>> partials(parallelRanges(triangleCount, chunk));
+      parallelFor(triangleCount, threads, Grain, [&](std::size_t begin, std::size_t end) {
+        auto &local = partials[begin / chunk];
+        local.assign(vertexCount, Value{});
+        for (auto t = begin; t < end; ++t)
+        {
+          fn(t, local.data());
+        }
+      });
+
+      auto result = std::move(partials.front());
+      parallelFor(vertexCount, threads, Grain, [&](std::size_t begin, std::size_t end) {
+        for (std::size_t p = 1; p < partials.size(); ++p)
+        {
+          for (auto v = begin; v < end; ++v)
+          {
+            result[v] += partials[p][v];
+          }
+        }
+      });
+      return result;
+    }
+
+    /**
+     * Sum fn(t) over all triangles.  Each range is summed separately and the
+     * range sums are added in range order.
+     */
+    template <typename T, typename Fn>
+    inline auto reduce(std::size_t const triangleCount, unsigned int const threads, Fn const &fn) -> T
+    {
+      auto const chunk = parallelChunk(triangleCount, threads, Grain);
+      std::vector<T> sums(parallelRanges(triangleCount, chunk), T{0});
+      parallelFor(triangleCount, threads, Grain, [&](std::size_t begin, std::size_t end) {
+        auto sum = T{0};
+        for (auto t = begin; t < end; ++t)
+        {
+          sum += fn(t);
+        }
+        sums[begin / chunk] = sum;
+      });
+
+      auto total = T{0};
+      for (auto const sum : sums)
+      {
+        total += sum;
+      }
+      return total;
+    }
+
+    /**
+     * @return the angle between unit vectors u and v
+     */
+    template <typename T>
+    inline auto angle(Vector<T, 3> const &u, Vector<T, 3> const &v) noexcept -> T
+    {
+      using std::acos;
+      return acos(std::clamp(dot(u, v), T{-1}, T{1}));
+    }
+  } // namespace detail::mesh
+
+  namespace batch
+  {
+    /**
+     * Computes the unit normal of each triangle of an indexed mesh.
+     * Degenerate triangles get a zero normal.
+     *
+     * @param positions the vertex positions
+     * @param indices three vertex indices per counter clockwise triangle
+     * @param triangleCount the number of triangles
+     * @param normals receives one normal per triangle
+     * @param threads the number of threads to use, 0 uses one per hardware thread
+     */
+    template <typename T>
+    inline auto faceNormals(Vector<T, 3> const *positions, std::uint32_t const *indices,
+                            std::size_t const triangleCount, Vector<T, 3> *normals, unsigned int const threads = 0)
+        -> void
+    {
+      detail::parallelFor(triangleCount, threads, detail::mesh::Grain, [&](std::size_t begin, std::size_t end) {
+        for (auto t = begin; t < end; ++t)
+        {
+          auto const tri = detail::mesh::triangle(positions, indices, t);
+          normals[t] = detail::mesh::safeNormalize(cross(tri.b - tri.a, tri.c - tri.a));
+        }
+      });
+    }
+
+    /**
+     * Computes area weighted vertex normals of an indexed mesh, the
+     * normalized sum of the normals of the triangles around each vertex
+     * scaled by their area.  Vertices without triangles get a zero normal.
+     *
+     * @param positions the vertex positions
+     * @param vertexCount the number of vertices
+     * @param indices three vertex indices per counter clockwise triangle
+     * @param triangleCount the number of triangles
+     * @param normals receives one normal per vertex
+     * @param threads the number of threads to use, 0 uses one per hardware thread
+     */
+    template <typename T>
+    inline auto vertexNormals(Vector<T, 3> const *positions, std::size_t const vertexCount,
+                              std::uint32_t const *indices, std::size_t const triangleCount, Vector<T, 3> *normals,
+                              unsigned int const threads = 0) -> void
+    {
+      auto const sums = detail::mesh::scatter<Vector<T, 3>>(
+          vertexCount, triangleCount, threads, [&](std::size_t t, Vector<T, 3> *accumulator) {
+            // the length of the cross product is twice the area
+            auto const tri = detail::mesh::triangle(positions, indices, t);
+            auto const n = cross(tri.b - tri.a, tri.c - tri.a);
+            accumulator[indices[3 * t]] += n;
+            accumulator[indices[3 * t + 1]] += n;
+            accumulator[indices[3 * t + 2]] += n;
+          });
+      detail::parallelFor(vertexCount, threads, detail::mesh::Grain, [&](std::size_t begin, std::size_t end) {
+        for (auto v = begin; v < end; ++v)
+        {
+          normals[v] = detail::mesh::safeNormalize(sums[v]);
+        }
+      });
+    }
+
+    /**
+     * Computes per vertex tangents of an indexed mesh following the
+     * MikkTSpace conventions: per triangle tangent directions from the uv
+     * derivatives are projected into the tangent plane of each vertex
+     * normal, weighted by the corner angle and summed.  The w component
+     * holds the bitangent sign, bitangent = w * cross(normal, tangent).
+     *
+     * MikkTSpace also splits vertices whose triangles disagree on
+     * handedness.  Here the input vertices are kept, so results match for
+     * meshes already split per unique position, normal and uv, as is usual
+     * for GPU vertex buffers.
+     *
+     * @param positions the vertex positions
+     * @param normals the unit vertex normals
+     * @param uvs the vertex texture coordinates
+     * @param vertexCount the number of vertices
+     * @param indices three vertex indices per counter clockwise triangle
+     * @param triangleCount the number of triangles
+     * @param tangents receives one tangent per vertex
+     * @param threads the number of threads to use, 0 uses one per hardware thread
+     */
+    template <typename T>
+    inline auto tangents(Vector<T, 3> const *positions, Vector<T, 3> const *normals, Vector<T, 2> const *uvs,
+                         std::size_t const vertexCount, std::uint32_t const *indices, std::size_t const triangleCount,
+                         Vector<T, 4> *tangents, unsigned int const threads = 0) -> void
+    {
+      using Frame = detail::mesh::TangentFrame<T>;
+      auto const sums = detail::mesh::scatter<Frame>(
+          vertexCount, triangleCount, threads, [&](std::size_t t, Frame *accumulator) {
+            std::uint32_t const corner[] = {indices[3 * t], indices[3 * t + 1], indices[3 * t + 2]};
+            auto const e1 = positions[corner[1]] - positions[corner[0]];
+            auto const e2 = positions[corner[2]] - positions[corner[0]];
+            auto const d1 = uvs[corner[1]] - uvs[corner[0]];
+            auto const d2 = uvs[corner[2]] - uvs[corner[0]];
+            auto const orientation = cross(d1, d2) < T{0} ? T{-1} : T{1};
+            auto const s = (e1 * d2[1] - e2 * d1[1]) * orientation;
+            auto const tDir = (e2 * d1[0] - e1 * d2[0]) * orientation;
+
+            for (std::size_t i = 0; i < 3; ++i)
+            {
+              auto const v = corner[i];
+              auto const &n = normals[v];
+              auto const &p = positions[v];
+              auto const toNext = detail::mesh::safeNormalize(positions[corner[(i + 1) % 3]] - p);
+              auto const toPrev = detail::mesh::safeNormalize(positions[corner[(i + 2) % 3]] - p);
+              auto const weight = detail::mesh::angle(toNext, toPrev);
+              accumulator[v] += Frame{detail::mesh::safeNormalize(s - n * dot(n, s)) * weight,
+                                      detail::mesh::safeNormalize(tDir - n * dot(n, tDir)) * weight};
+            }
+          });
+      detail::parallelFor(vertexCount, threads, detail::mesh::Grain, [&](std::size_t begin, std::size_t end) {
+        for (auto v = begin; v < end; ++v)
+        {
+          auto const &n = normals[v];
+          auto const t = detail::mesh::safeNormalize(sums[v].s - n * dot(n, sums[v].s));
+          auto const w = dot(cross(n, t), sums[v].t) < T{0} ? T{-1} : T{1};
+          tangents[v] = {t[0], t[1], t[2], w};
+        }
+      });
+    }
+
+    /**
+     * Computes the total area of the triangles of an indexed mesh.
+     *
+     * @param positions the vertex positions
+     * @param indices three vertex indices per triangle
+     * @param triangleCount the number of triangles
+     * @param threads the number of threads to use, 0 uses one per hardware thread
+     * @return the surface area
+     */
+    template <typename T>
+    inline auto surfaceArea(Vector<T, 3> const *positions, std::uint32_t const *indices,
+                            std::size_t const triangleCount, unsigned int const threads = 0) -> T
+    {
+      return detail::mesh::reduce<T>(triangleCount, threads, [&](std::size_t t) {
+        auto const tri = detail::mesh::triangle(positions, indices, t);
+        return length(cross(tri.b - tri.a, tri.c - tri.a)) / T{2};
+      });
+    }
+
+    /**
+     * Computes the signed volume enclosed by a closed indexed mesh, the sum
+     * of the signed volumes of the tetrahedra between the origin and each
+     * triangle.
+     *
+     * @param positions the vertex positions
+     * @param indices three vertex indices per counter clockwise triangle
+     * @param triangleCount the number of triangles
+     * @param threads the number of threads to use, 0 uses one per hardware thread
+     * @return the volume, positive if the triangles face outwards
+     */
+    template <typename T>
+    inline auto volume(Vector<T, 3> const *positions, std::uint32_t const *indices, std::size_t const triangleCount,
+                       unsigned int const threads = 0) -> T
+    {
+      return detail::mesh::reduce<T>(triangleCount, threads, [&](std::size_t t) {
+        auto const tri = detail::mesh::triangle(positions, indices, t);
+        return dot(tri.a, cross(tri.b, tri.c)) / T{6};
+      });
+    }
+  } // namespace batch
+
+} // namespace cagey::math
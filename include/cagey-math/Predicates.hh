@@ -0,0 +1,538 @@
+//=============================================================================
+//
+// cagey-math - C++-17 Vector Math Library
+// Copyright (c) 2020 Kyle Girard <theycallmecoach@gmail.com>
+//
+// The MIT License (MIT)
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+//=============================================================================
+
+#pragma once
+
+/**
+ * @file
+ * @brief Robust orientation and in-circle predicates
+ *
+ * Adaptive precision predicates after Shewchuk, "Adaptive Precision
+ * Floating-Point Arithmetic and Fast Robust Geometric Predicates".  Each
+ * predicate first evaluates the determinant in plain double arithmetic and
+ * checks it against a forward error bound.  Only when the sign cannot be
+ * trusted is the determinant recomputed exactly with floating point
+ * expansions, so the returned value always has the correct sign.
+ */
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <cstddef>
+#include <limits>
+#include <vector>
+
+#include "cagey-math/Vector2.hh"
+#include "cagey-math/Vector3.hh"
+
+namespace cagey::math
+{
+
+  namespace detail::predicates
+  {
+    /// Half an ulp of 1, the relative rounding error of double arithmetic
+    constexpr double Epsilon = std::numeric_limits<double>::epsilon() / 2.0;
+
+    constexpr double Orient2dBound = (3.0 + 16.0 * Epsilon) * Epsilon;
+    constexpr double Orient3dBound = (7.0 + 56.0 * Epsilon) * Epsilon;
+    constexpr double InCircleBound = (10.0 + 96.0 * Epsilon) * Epsilon;
+    constexpr double InSphereBound = (16.0 + 224.0 * Epsilon) * Epsilon;
+
+    /**
+     * Computes a + b = sum + err exactly.
+     */
+    inline auto twoSum(double const a, double const b, double &err) noexcept -> double
+    {
+      auto const sum = a + b;
+      auto const bVirtual = sum - a;
+      auto const aVirtual = sum - bVirtual;
+      err = (a - aVirtual) + (b - bVirtual);
+      return sum;
+    }
+
+    /**
+     * Computes a * b = product + err exactly.
+     */
+    inline auto twoProduct(double const a, double const b, double &err) noexcept -> double
+    {
+      auto const product = a * b;
+      err = std::fma(a, b, -product);
+      return product;
+    }
+
+    /**
+     * @brief An exact sum of non overlapping doubles
+     *
+     * Terms are kept in order of increasing magnitude without zeros, so the
+     * sign of the expansion is the sign of its last term.  Only used on the
+     * slow path of the predicates.
+     */
+    class Expansion
+    {
+    public:
+      Expansion() = default;
+
+      explicit Expansion(double const value)
+      {
+        if (value != 0.0)
+        {
+          mTerms.push_back(value);
+        }
+      }
+
+      /**
+       * The exact difference of a and b.
+       */
+      static auto difference(double const a, double const b) -> Expansion
+      {
+        Expansion result;
+        double err;
+        auto const diff = twoSum(a, -b, err);
+        result.push(err);
+        result.push(diff);
+        return result;
+      }
+
+      /**
+       * @return an approximation of the value with the correct sign
+       */
+      auto estimate() const noexcept -> double
+      {
+        auto sum = 0.0;
+        for (auto const term : mTerms)
+        {
+          sum += term;
+        }
+        return sum;
+      }
+
+      friend auto operator+(Expansion const &lhs, Expansion const &rhs) -> Expansion
+      {
+        auto result = lhs;
+        for (auto const term : rhs.mTerms)
+        {
+          result = result.grow(term);
+        }
+        return result;
+      }
+
+      friend auto operator-(Expansion const &lhs, Expansion rhs) -> Expansion
+      {
+        for (auto &term : rhs.mTerms)
+        {
+          term = -term;
+        }
+        return lhs + rhs;
+      }
+
+      friend auto operator*(Expansion const &lhs, Expansion const &rhs) -> Expansion
+      {
+        Expansion result;
+        for (auto const term : rhs.mTerms)
+        {
+          result = result + lhs.scale(term);
+        }
+        return result;
+      }
+
+    private:
+      auto push(double const term) -> void
+      {
+        if (term != 0.0)
+        {
+          mTerms.push_back(term);
+        }
+      }
+
+      /**
+       * @return this + b
+       */
+      auto grow(double b) const -> Expansion
+      {
+        Expansion result;
+        result.mTerms.reserve(mTerms.size() + 1);
+        for (auto const term : mTerms)
+        {
+          double err;
+          b = twoSum(b, term, err);
+          result.push(err);
+        }
+        result.push(b);
+        return result;
+      }
+
+      /**
+       * @return this * b
+       */
+      auto scale(double const b) const -> Expansion
+      {
+        Expansion result;
+        if (mTerms.empty())
+        {
+          return result;
+        }
+        result.mTerms.reserve(2 * mTerms.size());
+        double err;
+        auto q = twoProduct(mTerms[0], b, err);
+        result.push(err);
+        for (std::size_t i = 1; i < mTerms.size(); ++i)
+        {
+          double productErr;
+          auto const product = twoProduct(mTerms[i], b, productErr);
+          auto const sum = twoSum(q, productErr, err);
+          result.push(err);
+          q = twoSum(product, sum, err);
+          result.push(err);
+        }
+        result.push(q);
+        return result;
+      }
+
+      std::vector<double> mTerms;
+    };
+
+    inline auto orient2dExact(Vector<double, 2> const &a, Vector<double, 2> const &b,
+                              Vector<double, 2> const &c) -> double
+    {
+      auto const acx = Expansion::difference(a[0], c[0]);
+      auto const acy = Expansion::difference(a[1], c[1]);
+      auto const bcx = Expansion::difference(b[0], c[0]);
+      auto const bcy = Expansion::difference(b[1], c[1]);
+      return (acx * bcy - acy * bcx).estimate();
+    }
+
+    inline auto orient3dExact(Vector<double, 3> const &a, Vector<double, 3> const &b,
+                              Vector<double, 3> const &c, Vector<double, 3> const &d) -> double
+    {
+      std::array<Expansion, 3> ad, bd, cd;
+      for (std::size_t i = 0; i < 3; ++i)
+      {
+        ad[i] = Expansion::difference(a[i], d[i]);
+        bd[i] = Expansion::difference(b[i], d[i]);
+        cd[i] = Expansion::difference(c[i], d[i]);
+      }
+      return (ad[2] * (bd[0] * cd[1] - cd[0] * bd[1]) + bd[2] * (cd[0] * ad[1] - ad[0] * cd[1]) +
+              cd[2] * (ad[0] * bd[1] - bd[0] * ad[1]))
+          .estimate();
+    }
+
+    inline auto inCircleExact(Vector<double, 2> const &a, Vector<double, 2> const &b,
+                              Vector<double, 2> const &c, Vector<double, 2> const &d) -> double
+    {
+      std::array<Expansion, 2> ad, bd, cd;
+      for (std::size_t i = 0; i < 2; ++i)
+      {
+        ad[i] = Expansion::difference(a[i], d[i]);
+        bd[i] = Expansion::difference(b[i], d[i]);
+        cd[i] = Expansion::difference(c[i], d[i]);
+      }
+      auto const alift = ad[0] * ad[0] + ad[1] * ad[1];
+      auto const blift = bd[0] * bd[0] + bd[1] * bd[1];
+      auto const clift = cd[0] * cd[0] + cd[1] * cd[1];
+      return (alift * (bd[0] * cd[1] - cd[0] * bd[1]) + blift * (cd[0] * ad[1] - ad[0] * cd[1]) +
+              clift * (ad[0] * bd[1] - bd[0] * ad[1]))
+          .estimate();
+    }
+
+    inline auto inSphereExact(Vector<double, 3> const &a, Vector<double, 3> const &b, Vector<double, 3> const &c,
+                              Vector<double, 3> const &d, Vector<double, 3> const &e) -> double
+    {
+      std::array<Expansion, 3> ae, be, ce, de;
+      for (std::size_t i = 0; i < 3; ++i)
+      {
+        ae[i] = Expansion::difference(a[i], e[i]);
+        be[i] = Expansion::difference(b[i], e[i]);
+        ce[i] = Expansion::difference(c[i], e[i]);
+        de[i] = Expansion::difference(d[i], e[i]);
+      }
+      auto const ab = ae[0] * be[1] - be[0] * ae[1];
+      auto const bc = be[0] * ce[1] - ce[0] * be[1];
+      auto const cd = ce[0] * de[1] - de[0] * ce[1];
+      auto const da = de[0] * ae[1] - ae[0] * de[1];
+      auto const ac = ae[0] * ce[1] - ce[0] * ae[1];
+      auto const bd = be[0] * de[1] - de[0] * be[1];
+
+      auto const abc = ae[2] * bc - be[2] * ac + ce[2] * ab;
+      auto const bcd = be[2] * cd - ce[2] * bd + de[2] * bc;
+      auto const cda = ce[2] * da + de[2] * ac + ae[2] * cd;
+      auto const dab = de[2] * ab + ae[2] * bd + be[2] * da;
+
+      auto const lift = [](std::array<Expansion, 3> const &v) { return v[0] * v[0] + v[1] * v[1] + v[2] * v[2]; };
+      return ((lift(de) * abc - lift(ce) * dab) + (lift(be) * cda - lift(ae) * bcd)).estimate();
+    }
+
+    /**
+     * @brief A determinant evaluated in double arithmetic with its error bound
+     */
+    struct Filtered
+    {
+      double det;
+      double bound;
+    };
+
+    inline auto orient2dFilter(Vector<double, 2> const &a, Vector<double, 2> const &b,
+                               Vector<double, 2> const &c) noexcept -> Filtered
+    {
+      auto const left = (a[0] - c[0]) * (b[1] - c[1]);
+      auto const right = (a[1] - c[1]) * (b[0] - c[0]);
+      return {left - right, Orient2dBound * (std::abs(left) + std::abs(right))};
+    }
+
+    inline auto orient3dFilter(Vector<double, 3> const &a, Vector<double, 3> const &b,
+                               Vector<double, 3> const &c, Vector<double, 3> const &d) noexcept -> Filtered
+    {
+      auto const adx = a[0] - d[0], ady = a[1] - d[1], adz = a[2] - d[2];
+      auto const bdx = b[0] - d[0], bdy = b[1] - d[1], bdz = b[2] - d[2];
+      auto const cdx = c[0] - d[0], cdy = c[1] - d[1], cdz = c[2] - d[2];
+      auto const bdxcdy = bdx * cdy, cdxbdy = cdx * bdy;
+      auto const cdxady = cdx * ady, adxcdy = adx * cdy;
+      auto const adxbdy = adx * bdy, bdxady = bdx * ady;
+      auto const det = adz * (bdxcdy - cdxbdy) + bdz * (cdxady - adxcdy) + cdz * (adxbdy - bdxady);
+      auto const permanent = (std::abs(bdxcdy) + std::abs(cdxbdy)) * std::abs(adz) +
+                             (std::abs(cdxady) + std::abs(adxcdy)) * std::abs(bdz) +
+                             (std::abs(adxbdy) + std::abs(bdxady)) * std::abs(cdz);
+      return {det, Orient3dBound * permanent};
+    }
+
+    inline auto inCircleFilter(Vector<double, 2> const &a, Vector<double, 2> const &b,
+                               Vector<double, 2> const &c, Vector<double, 2> const &d) noexcept -> Filtered
+    {
+      auto const adx = a[0] - d[0], ady = a[1] - d[1];
+      auto const bdx = b[0] - d[0], bdy = b[1] - d[1];
+      auto const cdx = c[0] - d[0], cdy = c[1] - d[1];
+      auto const bdxcdy = bdx * cdy, cdxbdy = cdx * bdy;
+      auto const cdxady = cdx * ady, adxcdy = adx * cdy;
+      auto const adxbdy = adx * bdy, bdxady = bdx * ady;
+      auto const alift = adx * adx + ady * ady;
+      auto const blift = bdx * bdx + bdy * bdy;
+      auto const clift = cdx * cdx + cdy * cdy;
+      auto const det = alift * (bdxcdy - cdxbdy) + blift * (cdxady - adxcdy) + clift * (adxbdy - bdxady);
+      auto const permanent = (std::abs(bdxcdy) + std::abs(cdxbdy)) * alift +
+                             (std::abs(cdxady) + std::abs(adxcdy)) * blift +
+                             (std::abs(adxbdy) + std::abs(bdxady)) * clift;
+      return {det, InCircleBound * permanent};
+    }
+
+    inline auto inSphereFilter(Vector<double, 3> const &a, Vector<double, 3> const &b, Vector<double, 3> const &c,
+                               Vector<double, 3> const &d, Vector<double, 3> const &e) noexcept -> Filtered
+    {
+      auto const aex = a[0] - e[0], aey = a[1] - e[1], aez = a[2] - e[2];
+      auto const bex = b[0] - e[0], bey = b[1] - e[1], bez = b[2] - e[2];
+      auto const cex = c[0] - e[0], cey = c[1] - e[1], cez = c[2] - e[2];
+      auto const dex = d[0] - e[0], dey = d[1] - e[1], dez = d[2] - e[2];
+
+      auto const aexbey = aex * bey, bexaey = bex * aey;
+      auto const bexcey = bex * cey, cexbey = cex * bey;
+      auto const cexdey = cex * dey, dexcey = dex * cey;
+      auto const dexaey = dex * aey, aexdey = aex * dey;
+      auto const aexcey = aex * cey, cexaey = cex * aey;
+      auto const bexdey = bex * dey, dexbey = dex * bey;
+
+      auto const ab = aexbey - bexaey;
+      auto const bc = bexcey - cexbey;
+      auto const cd = cexdey - dexcey;
+      auto const da = dexaey - aexdey;
+      auto const ac = aexcey - cexaey;
+      auto const bd = bexdey - dexbey;
+
+      auto const abc = aez * bc - bez * ac + cez * ab;
+      auto const bcd = bez * cd - cez * bd + dez * bc;
+      auto const cda = cez * da + dez * ac + aez * cd;
+      auto const dab = dez * ab + aez * bd + bez * da;
+
+      auto const alift = aex * aex + aey * aey + aez * aez;
+      auto const blift = bex * bex + bey * bey + bez * bez;
+      auto const clift = cex * cex + cey * cey + cez * cez;
+      auto const dlift = dex * dex + dey * dey + dez * dez;
+      auto const det = (dlift * abc - clift * dab) + (blift * cda - alift * bcd);
+
+      auto const aezplus = std::abs(aez), bezplus = std::abs(bez);
+      auto const cezplus = std::abs(cez), dezplus = std::abs(dez);
+      auto const abplus = std::abs(aexbey) + std::abs(bexaey);
+      auto const bcplus = std::abs(bexcey) + std::abs(cexbey);
+      auto const cdplus = std::abs(cexdey) + std::abs(dexcey);
+      auto const daplus = std::abs(dexaey) + std::abs(aexdey);
+      auto const acplus = std::abs(aexcey) + std::abs(cexaey);
+      auto const bdplus = std::abs(bexdey) + std::abs(dexbey);
+      auto const permanent = (cdplus * bezplus + bdplus * cezplus + bcplus * dezplus) * alift +
+                             (daplus * cezplus + acplus * dezplus + cdplus * aezplus) * blift +
+                             (abplus * dezplus + bdplus * aezplus + daplus * bezplus) * clift +
+                             (bcplus * aezplus + acplus * bezplus + abplus * cezplus) * dlift;
+      return {det, InSphereBound * permanent};
+    }
+
+    /// Batches are filtered in blocks of this many before the exact pass
+    constexpr std::size_t BlockSize = 64;
+
+    /**
+     * Evaluate filter over [0, count) in blocks, the filter loop has no
+     * branches, then recompute the uncertain results with exact.
+     */
+    template <typename Filter, typename Exact>
+    inline auto filtered(std::size_t const count, double *out, Filter const &filter, Exact const &exact) -> void
+    {
+      std::array<double, BlockSize> bound;
+      for (std::size_t begin = 0; begin < count; begin += BlockSize)
+      {
+        auto const size = std::min(BlockSize, count - begin);
+        for (std::size_t i = 0; i < size; ++i)
+        {
+          auto const f = filter(begin + i);
+          out[begin + i] = f.det;
+          bound[i] = f.bound;
+        }
+        for (std::size_t i = 0; i < size; ++i)
+        {
+          if (!(std::abs(out[begin + i]) > bound[i]))
+          {
+            out[begin + i] = exact(begin + i);
+          }
+        }
+      }
+    }
+  } // namespace detail::predicates
+
+  //==========================================================================
+  /// @name Predicates
+  //==========================================================================
+  ///@{
+
+  /**
+   * Computes the orientation of the triangle a, b, c.
+   *
+   * @return positive if a, b, c are in counter clockwise order, negative if
+   * clockwise and zero if collinear.  The magnitude approximates twice the
+   * signed area of the triangle.
+   */
+  inline auto orient2d(Vector<double, 2> const &a, Vector<double, 2> const &b,
+                       Vector<double, 2> const &c) -> double
+  {
+    auto const f = detail::predicates::orient2dFilter(a, b, c);
+    return std::abs(f.det) > f.bound ? f.det : detail::predicates::orient2dExact(a, b, c);
+  }
+
+  /**
+   * Computes the orientation of d relative to the plane through a, b, c.
+   *
+   * @return positive if d lies below the plane, where a, b, c appear
+   * counter clockwise seen from above, negative if above and zero if the
+   * points are coplanar.  The magnitude approximates six times the signed
+   * volume of the tetrahedron.
+   */
+  inline auto orient3d(Vector<double, 3> const &a, Vector<double, 3> const &b, Vector<double, 3> const &c,
+                       Vector<double, 3> const &d) -> double
+  {
+    auto const f = detail::predicates::orient3dFilter(a, b, c, d);
+    return std::abs(f.det) > f.bound ? f.det : detail::predicates::orient3dExact(a, b, c, d);
+  }
+
+  /**
+   * Computes whether d lies inside the circle through a, b, c, which must
+   * be in counter clockwise order.
+   *
+   * @return positive if d is inside the circle, negative if outside and
+   * zero if the four points are cocircular
+   */
+  inline auto inCircle(Vector<double, 2> const &a, Vector<double, 2> const &b, Vector<double, 2> const &c,
+                       Vector<double, 2> const &d) -> double
+  {
+    auto const f = detail::predicates::inCircleFilter(a, b, c, d);
+    return std::abs(f.det) > f.bound ? f.det : detail::predicates::inCircleExact(a, b, c, d);
+  }
+
+  /**
+   * Computes whether e lies inside the sphere through a, b, c, d, which
+   * must have orient3d(a, b, c, d) > 0.
+   *
+   * @return positive if e is inside the sphere, negative if outside and
+   * zero if the five points are cospherical
+   */
+  inline auto inSphere(Vector<double, 3> const &a, Vector<double, 3> const &b, Vector<double, 3> const &c,
+                       Vector<double, 3> const &d, Vector<double, 3> const &e) -> double
+  {
+    auto const f = detail::predicates::inSphereFilter(a, b, c, d, e);
+    return std::abs(f.det) > f.bound ? f.det : detail::predicates::inSphereExact(a, b, c, d, e);
+  }
+
+  ///@}
+
+  namespace batch
+  {
+    /**
+     * Computes orient2d(a[i], b[i], c[i]) for i in [0, count).
+     *
+     * All determinants are filtered first in a branch free loop, only the
+     * uncertain ones are recomputed exactly.
+     */
+    inline auto orient2d(Vector<double, 2> const *a, Vector<double, 2> const *b, Vector<double, 2> const *c,
+                         double *out, std::size_t const count) -> void
+    {
+      using namespace detail::predicates;
+      filtered(
+          count, out, [&](std::size_t i) { return orient2dFilter(a[i], b[i], c[i]); },
+          [&](std::size_t i) { return orient2dExact(a[i], b[i], c[i]); });
+    }
+
+    /**
+     * Computes orient3d(a[i], b[i], c[i], d[i]) for i in [0, count).
+     */
+    inline auto orient3d(Vector<double, 3> const *a, Vector<double, 3> const *b, Vector<double, 3> const *c,
+                         Vector<double, 3> const *d, double *out, std::size_t const count) -> void
+    {
+      using namespace detail::predicates;
+      filtered(
+          count, out, [&](std::size_t i) { return orient3dFilter(a[i], b[i], c[i], d[i]); },
+          [&](std::size_t i) { return orient3dExact(a[i], b[i], c[i], d[i]); });
+    }
+
+    /**
+     * Computes inCircle(a[i], b[i], c[i], d[i]) for i in [0, count).
+     */
+    inline auto inCircle(Vector<double, 2> const *a, Vector<double, 2> const *b, Vector<double, 2> const *c,
+                         Vector<double, 2> const *d, double *out, std::size_t const count) -> void
+    {
+      using namespace detail::predicates;
+      filtered(
+          count, out, [&](std::size_t i) { return inCircleFilter(a[i], b[i], c[i], d[i]); },
+          [&](std::size_t i) { return inCircleExact(a[i], b[i], c[i], d[i]); });
+    }
+
+    /**
+     * Computes inSphere(a[i], b[i], c[i], d[i], e[i]) for i in [0, count).
+     */
+    inline auto inSphere(Vector<double, 3> const *a, Vector<double, 3> const *b, Vector<double, 3> const *c,
+                         Vector<double, 3> const *d, Vector<double, 3> const *e, double *out,
+                         std::size_t const count) -> void
+    {
+      using namespace detail::predicates;
+      filtered(
+          count, out, [&](std::size_t i) { return inSphereFilter(a[i], b[i], c[i], d[i], e[i]); },
+          [&](std::size_t i) { return inSphereExact(a[i], b[i], c[i], d[i], e[i]); });
+    }
+  } // namespace batch
+
+} // namespace cagey::math
@@ -0,0 +1,281 @@
+//=============================================================================
+//
+// cagey-math - C++-17 Vector Math Library
+// Copyright (c) 2020 Kyle Girard <theycallmecoach@gmail.com>
+//
+// The MIT License (MIT)
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+//=============================================================================
+
+#pragma once
+
+/**
+ * @file
+ * @brief View and projection matrix builders
+ *
+ * All builders assume a right handed view space looking down -z and return
+ * column major matrices together with their analytic inverse, so unprojecting
+ * never needs a generic 4x4 inverse.
+ */
+
+#include <cmath>
+
+#include "cagey-math/Matrix44.hh"
+#include "cagey-math/VectorFunc.hh"
+
+namespace cagey::math
+{
+
+  /**
+   * The range normalized device depth is mapped into.
+   */
+  enum class ClipDepth
+  {
+    ZeroToOne,       ///< Vulkan, Direct3D and Metal
+    NegativeOneToOne ///< OpenGL
+  };
+
+  /**
+   * Which end of the clip depth range the near plane maps to.
+   */
+  enum class DepthOrder
+  {
+    Forward, ///< near maps to the low end of the range
+    Reversed ///< near maps to the high end, spreading float precision evenly with distance
+  };
+
+  /**
+   * A transform and its inverse.
+   *
+   * @tparam T the element type
+   */
+  template <typename T>
+  struct InvertibleTransform
+  {
+    Matrix<T, 4, 4> matrix;  ///< the transform
+    Matrix<T, 4, 4> inverse; ///< the inverse of matrix
+  };
+
+  namespace detail::projection
+  {
+    /// The normalized depth of the near and far planes
+    template <typename T>
+    struct DepthPlanes
+    {
+      T zNear;
+      T zFar;
+    };
+
+    template <typename T>
+    inline constexpr auto depthPlanes(DepthOrder const order, ClipDepth const depth) noexcept -> DepthPlanes<T>
+    {
+      auto const low = depth == ClipDepth::ZeroToOne ? T(0) : T(-1);
+      return order == DepthOrder::Forward ? DepthPlanes<T>{low, T(1)} : DepthPlanes<T>{T(1), low};
+    }
+
+    /**
+     * Builds the perspective matrix with rows
+     *
+     *   [a 0  c 0]
+     *   [0 b  d 0]
+     *   [0 0 za zb]
+     *   [0 0 -1 0]
+     *
+     * and its inverse.
+     */
+    template <typename T>
+    inline constexpr auto perspective(T const a, T const b, T const c, T const d, T const za, T const zb) noexcept
+        -> InvertibleTransform<T>
+    {
+      return {Matrix<T, 4, 4>{a, T(0), T(0), T(0),
+                              T(0), b, T(0), T(0),
+                              c, d, za, T(-1),
+                              T(0), T(0), zb, T(0)},
+              Matrix<T, 4, 4>{T(1) / a, T(0), T(0), T(0),
+                              T(0), T(1) / b, T(0), T(0),
+                              T(0), T(0), T(0), T(1) / zb,
+                              c / a, d / b, T(-1), za / zb}};
+    }
+
+    /// The perspective matrix of the near plane extents with depth d = -za - zb / z
+    template <typename T>
+    inline constexpr auto perspective(T const left, T const right, T const bottom, T const top, T const zNear,
+                                      T const za, T const zb) noexcept -> InvertibleTransform<T>
+    {
+      return perspective(T(2) * zNear / (right - left), T(2) * zNear / (top - bottom), (right + left) / (right - left),
+                         (top + bottom) / (top - bottom), za, zb);
+    }
+
+  } // namespace detail::projection
+
+  /**
+   * Builds a perspective projection for the view frustum with the given
+   * extents on the near plane.
+   *
+   * @param left the left edge of the near plane
+   * @param right the right edge of the near plane
+   * @param bottom the bottom edge of the near plane
+   * @param top the top edge of the near plane
+   * @param zNear the positive distance to the near plane
+   * @param zFar the positive distance to the far plane
+   * @param order whether the near plane maps to the low or high end of the depth range
+   * @param depth the clip depth range
+   * @return the projection and its inverse
+   */
+  template <typename T>
+  inline constexpr auto frustum(T const left, T const right, T const bottom, T const top, T const zNear, T const zFar,
+                                DepthOrder const order = DepthOrder::Forward,
+                                ClipDepth const depth = ClipDepth::ZeroToOne) noexcept -> InvertibleTransform<T>
+  {
+    auto const planes = detail::projection::depthPlanes<T>(order, depth);
+    auto const zb = (planes.zNear - planes.zFar) * zNear * zFar / (zFar - zNear);
+    return detail::projection::perspective(left, right, bottom, top, zNear, zb / zNear - planes.zNear, zb);
+  }
+
+  /**
+   * Builds a perspective projection like frustum with the far plane at
+   * infinity.
+   *
+   * @param left the left edge of the near plane
+   * @param right the right edge of the near plane
+   * @param bottom the bottom edge of the near plane
+   * @param top the top edge of the near plane
+   * @param zNear the positive distance to the near plane
+   * @param order whether the near plane maps to the low or high end of the depth range
+   * @param depth the clip depth range
+   * @return the projection and its inverse
+   */
+  template <typename T>
+  inline constexpr auto frustumInfinite(T const left, T const right, T const bottom, T const top, T const zNear,
+                                        DepthOrder const order = DepthOrder::Forward,
+                                        ClipDepth const depth = ClipDepth::ZeroToOne) noexcept
+      -> InvertibleTransform<T>
+  {
+    auto const planes = detail::projection::depthPlanes<T>(order, depth);
+    return detail::projection::perspective(left, right, bottom, top, zNear, -planes.zFar,
+                                           (planes.zNear - planes.zFar) * zNear);
+  }
+
+  /**
+   * Builds a symmetric perspective projection.
+   *
+   * @param fovY the vertical field of view in radians
+   * @param aspect the width of the viewport divided by its height
+   * @param zNear the positive distance to the near plane
+   * @param zFar the positive distance to the far plane
+   * @param order whether the near plane maps to the low or high end of the depth range
+   * @param depth the clip depth range
+   * @return the projection and its inverse
+   */
+  template <typename T>
+  inline auto perspective(T const fovY, T const aspect, T const zNear, T const zFar,
+                          DepthOrder const order = DepthOrder::Forward,
+                          ClipDepth const depth = ClipDepth::ZeroToOne) noexcept -> InvertibleTransform<T>
+  {
+    using std::tan;
+    auto const top = zNear * tan(fovY / T(2));
+    return frustum(-top * aspect, top * aspect, -top, top, zNear, zFar, order, depth);
+  }
+
+  /**
+   * Builds a symmetric perspective projection with the far plane at
+   * infinity.  With DepthOrder::Reversed and a floating point depth buffer
+   * this gives nearly uniform depth precision at every distance.
+   *
+   * @param fovY the vertical field of view in radians
+   * @param aspect the width of the viewport divided by its height
+   * @param zNear the positive distance to the near plane
+   * @param order whether the near plane maps to the low or high end of the depth range
+   * @param depth the clip depth range
+   * @return the projection and its inverse
+   */
+  template <typename T>
+  inline auto perspectiveInfinite(T const fovY, T const aspect, T const zNear,
+                                  DepthOrder const order = DepthOrder::Forward,
+                                  ClipDepth const depth = ClipDepth::ZeroToOne) noexcept -> InvertibleTransform<T>
+  {
+    using std::tan;
+    auto const top = zNear * tan(fovY / T(2));
+    return frustumInfinite(-top * aspect, top * aspect, -top, top, zNear, order, depth);
+  }
+
+  /**
+   * Builds an orthographic projection of the given view volume.
+   *
+   * @param left the left edge of the view volume
+   * @param right the right edge of the view volume
+   * @param bottom the bottom edge of the view volume
+   * @param top the top edge of the view volume
+   * @param zNear the distance to the near plane
+   * @param zFar the distance to the far plane
+   * @param order whether the near plane maps to the low or high end of the depth range
+   * @param depth the clip depth range
+   * @return the projection and its inverse
+   */
+  template <typename T>
+  inline constexpr auto orthographic(T const left, T const right, T const bottom, T const top, T const zNear,
+                                     T const zFar, DepthOrder const order = DepthOrder::Forward,
+                                     ClipDepth const depth = ClipDepth::ZeroToOne) noexcept -> InvertibleTransform<T>
+  {
+    auto const planes = detail::projection::depthPlanes<T>(order, depth);
+    auto const a = T(2) / (right - left);
+    auto const b = T(2) / (top - bottom);
+    auto const za = (planes.zNear - planes.zFar) / (zFar - zNear);
+    auto const tx = -(right + left) / (right - left);
+    auto const ty = -(top + bottom) / (top - bottom);
+    auto const tz = planes.zNear + za * zNear;
+    return {Matrix<T, 4, 4>{a, T(0), T(0), T(0),
+                            T(0), b, T(0), T(0),
+                            T(0), T(0), za, T(0),
+                            tx, ty, tz, T(1)},
+            Matrix<T, 4, 4>{T(1) / a, T(0), T(0), T(0),
+                            T(0), T(1) / b, T(0), T(0),
+                            T(0), T(0), T(1) / za, T(0),
+                            -tx / a, -ty / b, -tz / za, T(1)}};
+  }
+
+  /**
+   * Builds a right handed view matrix for a camera at eye looking at target.
+   * The inverse is the camera to world transform.
+   *
+   * @param eye the position of the camera
+   * @param target the point the camera looks at, distinct from eye
+   * @param up the up direction, not parallel to target - eye
+   * @return the view matrix and its inverse
+   */
+  template <typename T>
+  inline auto lookAt(Vector<T, 3> const &eye, Vector<T, 3> const &target, Vector<T, 3> const &up) noexcept
+      -> InvertibleTransform<T>
+  {
+    auto const f = normalize(target - eye);
+    auto const s = normalize(cross(f, up));
+    auto const u = cross(s, f);
+    return {Matrix<T, 4, 4>{s[0], u[0], -f[0], T(0),
+                            s[1], u[1], -f[1], T(0),
+                            s[2], u[2], -f[2], T(0),
+                            -dot(s, eye), -dot(u, eye), dot(f, eye), T(1)},
+            Matrix<T, 4, 4>{s[0], s[1], s[2], T(0),
+                            u[0], u[1], u[2], T(0),
+                            -f[0], -f[1], -f[2], T(0),
+                            eye[0], eye[1], eye[2], T(1)}};
+  }
+
+} // namespace cagey::math
@@ -0,0 +1,590 @@
+//=============================================================================
+//
+// cagey-math - C++-17 Vector Math Library
+// Copyright (c) 2020 Kyle Girard <theycallmecoach@gmail.com>
+//
+// The MIT License (MIT)
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+//=============================================================================
+
+#pragma once
+
+/**
+ * @file
+ * @brief Singular value and polar decomposition of 3x3 matrices
+ */
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <cstddef>
+#include <limits>
+
+#include "cagey-math/MatrixFunc.hh"
+
+namespace cagey::math
+{
+
+  /**
+   * @brief The singular value decomposition a = u * diag(sigma) * transpose(v)
+   *
+   * u and v are rotations.  The singular values are sorted by decreasing
+   * magnitude, the last one is negative if the determinant of a is.
+   */
+  template <typename T>
+  struct Svd
+  {
+    Matrix<T, 3, 3> u;  ///< left singular vectors
+    Vector<T, 3> sigma; ///< singular values
+    Matrix<T, 3, 3> v;  ///< right singular vectors
+  };
+
+  /**
+   * @brief The polar decomposition a = rotation * stretch
+   */
+  template <typename T>
+  struct Polar
+  {
+    Matrix<T, 3, 3> rotation; ///< the closest rotation to a
+    Matrix<T, 3, 3> stretch;  ///< symmetric, negative definite along one axis if det(a) < 0
+  };
+
+  namespace detail::svd
+  {
+    /**
+     * @brief N values of T processed in lockstep
+     *
+     * Every operation is a loop over the lanes so the decomposition below
+     * compiles to vector instructions when instantiated with Lanes.
+     */
+    template <typename T, std::size_t N>
+    struct Lanes
+    {
+      std::array<T, N> v;
+
+      Lanes() = default;
+
+      /**
+       * Broadcast s to all lanes.
+       */
+      Lanes(T const s) noexcept { v.fill(s); }
+
+      friend auto operator+(Lanes lhs, Lanes const &rhs) noexcept -> Lanes
+      {
+        for (std::size_t i = 0; i < N; ++i)
+        {
+          lhs.v[i] += rhs.v[i];
+        }
+        return lhs;
+      }
+
+      friend auto operator-(Lanes lhs, Lanes const &rhs) noexcept -> Lanes
+      {
+        for (std::size_t i = 0; i < N; ++i)
+        {
+          lhs.v[i] -= rhs.v[i];
+        }
+        return lhs;
+      }
+
+      friend auto operator*(Lanes lhs, Lanes const &rhs) noexcept -> Lanes
+      {
+        for (std::size_t i = 0; i < N; ++i)
+        {
+          lhs.v[i] *= rhs.v[i];
+        }
+        return lhs;
+      }
+
+      friend auto operator/(Lanes lhs, Lanes const &rhs) noexcept -> Lanes
+      {
+        for (std::size_t i = 0; i < N; ++i)
+        {
+          lhs.v[i] /= rhs.v[i];
+        }
+        return lhs;
+      }
+
+      friend auto operator-(Lanes value) noexcept -> Lanes
+      {
+        for (std::size_t i = 0; i < N; ++i)
+        {
+          value.v[i] = -value.v[i];
+        }
+        return value;
+      }
+
+      friend auto operator<(Lanes const &lhs, Lanes const &rhs) noexcept -> std::array<bool, N>
+      {
+        std::array<bool, N> result;
+        for (std::size_t i = 0; i < N; ++i)
+        {
+          result[i] = lhs.v[i] < rhs.v[i];
+        }
+        return result;
+      }
+
+      friend auto select(std::array<bool, N> const &mask, Lanes const &lhs, Lanes const &rhs) noexcept -> Lanes
+      {
+        Lanes result;
+        for (std::size_t i = 0; i < N; ++i)
+        {
+          result.v[i] = mask[i] ? lhs.v[i] : rhs.v[i];
+        }
+        return result;
+      }
+
+      friend auto rsqrt(Lanes value) noexcept -> Lanes
+      {
+        for (std::size_t i = 0; i < N; ++i)
+        {
+          value.v[i] = T{1} / std::sqrt(value.v[i]);
+        }
+        return value;
+      }
+
+      friend auto sqrt(Lanes value) noexcept -> Lanes
+      {
+        for (std::size_t i = 0; i < N; ++i)
+        {
+          value.v[i] = std::sqrt(value.v[i]);
+        }
+        return value;
+      }
+
+      friend auto abs(Lanes value) noexcept -> Lanes
+      {
+        for (std::size_t i = 0; i < N; ++i)
+        {
+          value.v[i] = std::abs(value.v[i]);
+        }
+        return value;
+      }
+
+      friend auto maximum(Lanes lhs, Lanes const &rhs) noexcept -> Lanes
+      {
+        for (std::size_t i = 0; i < N; ++i)
+        {
+          lhs.v[i] = std::max(lhs.v[i], rhs.v[i]);
+        }
+        return lhs;
+      }
+    };
+
+    template <typename T>
+    inline auto select(bool const mask, T const lhs, T const rhs) noexcept -> T
+    {
+      return mask ? lhs : rhs;
+    }
+
+    template <typename T>
+    inline auto rsqrt(T const value) noexcept -> T
+    {
+      return T{1} / std::sqrt(value);
+    }
+
+    template <typename T>
+    inline auto maximum(T const lhs, T const rhs) noexcept -> T
+    {
+      return std::max(lhs, rhs);
+    }
+
+    /// Jacobi sweeps, McAdams et al. use 4 for float but 6 are needed for errors below 1e-5
+    template <typename T>
+    constexpr int Sweeps = sizeof(T) > 4 ? 8 : 6;
+
+    /**
+     * Swap x and y where mask is set.
+     */
+    template <typename M, typename V>
+    inline auto condSwap(M const &mask, V &x, V &y) noexcept -> void
+    {
+      auto const z = x;
+      x = select(mask, y, x);
+      y = select(mask, z, y);
+    }
+
+    /**
+     * Swap x and y where mask is set, negating the new y.
+     */
+    template <typename M, typename V>
+    inline auto condNegSwap(M const &mask, V &x, V &y) noexcept -> void
+    {
+      auto const z = -x;
+      x = select(mask, y, x);
+      y = select(mask, z, y);
+    }
+
+    /**
+     * The quaternion (ch, sh) of an approximate Givens rotation that
+     * reduces the off diagonal element of the symmetric 2x2 matrix
+     * [a11 a12; a12 a22].
+     */
+    template <typename V>
+    inline auto approximateGivens(V const &a11, V const &a12, V const &a22, V &ch, V &sh) noexcept -> void
+    {
+      V const gamma{5.828427124746190}; // 3 + 2 sqrt(2)
+      V const cstar{0.923879532511287}; // cos(pi / 8)
+      V const sstar{0.382683432365090}; // sin(pi / 8)
+      ch = V{2} * (a11 - a22);
+      sh = a12;
+      auto const exact = gamma * sh * sh < ch * ch;
+      auto const w = rsqrt(ch * ch + sh * sh);
+      ch = select(exact, w * ch, cstar);
+      sh = select(exact, w * sh, sstar);
+    }
+
+    /**
+     * Conjugate the symmetric matrix s by a Givens rotation in the plane of
+     * its first two axes and accumulate the rotation into q, then cycle the
+     * axes of s.  x, y and z map the cycled axes back to the original ones.
+     */
+    template <typename V>
+    inline auto jacobiConjugation(std::size_t const x, std::size_t const y, std::size_t const z, V &s11, V &s21,
+                                  V &s22, V &s31, V &s32, V &s33, std::array<V, 4> &q) noexcept -> void
+    {
+      V ch, sh;
+      approximateGivens(s11, s21, s22, ch, sh);
+
+      auto const scale = ch * ch + sh * sh;
+      auto const inv = V{1} / scale;
+      auto const a = (ch * ch - sh * sh) * inv;
+      auto const b = V{2} * sh * ch * inv;
+
+      auto const t11 = s11, t21 = s21, t22 = s22, t31 = s31, t32 = s32, t33 = s33;
+      s11 = a * (a * t11 + b * t21) + b * (a * t21 + b * t22);
+      s21 = a * (-b * t11 + a * t21) + b * (-b * t21 + a * t22);
+      s22 = -b * (-b * t11 + a * t21) + a * (-b * t21 + a * t22);
+      s31 = a * t31 + b * t32;
+      s32 = -b * t31 + a * t32;
+      s33 = t33;
+
+      std::array<V, 3> const tmp{q[0] * sh, q[1] * sh, q[2] * sh};
+      sh = sh * q[3];
+      q[0] = q[0] * ch;
+      q[1] = q[1] * ch;
+      q[2] = q[2] * ch;
+      q[3] = q[3] * ch;
+      q[z] = q[z] + sh;
+      q[3] = q[3] - tmp[z];
+      q[x] = q[x] + tmp[y];
+      q[y] = q[y] - tmp[x];
+
+      auto const r11 = s22, r21 = s32, r22 = s33, r31 = s21, r32 = s31, r33 = s11;
+      s11 = r11;
+      s21 = r21;
+      s22 = r22;
+      s31 = r31;
+      s32 = r32;
+      s33 = r33;
+    }
+
+    /**
+     * The quaternion (ch, sh) of the Givens rotation zeroing a2 in (a1, a2).
+     */
+    template <typename V>
+    inline auto qrGivens(V const &a1, V const &a2, V const &epsilon, V &ch, V &sh) noexcept -> void
+    {
+      using std::abs;
+      using std::sqrt;
+      auto const rho = sqrt(a1 * a1 + a2 * a2);
+      sh = select(epsilon < rho, a2, V{0});
+      ch = abs(a1) + maximum(rho, epsilon);
+      condSwap(a1 < V{0}, sh, ch);
+      auto const w = rsqrt(ch * ch + sh * sh);
+      ch = ch * w;
+      sh = sh * w;
+    }
+
+    /**
+     * The branch free decomposition of McAdams et al., "Computing the
+     * Singular Value Decomposition of 3x3 matrices with minimal branching
+     * and elementary floating point operations".  Matrices are indexed
+     * [row][column].
+     */
+    template <typename V, typename T>
+    inline auto decompose(V const (&a)[3][3], V (&u)[3][3], V (&s)[3], V (&v)[3][3]) noexcept -> void
+    {
+      // symmetric eigenanalysis of transpose(a) * a
+      V ata[3][3];
+      for (std::size_t i = 0; i < 3; ++i)
+      {
+        for (std::size_t j = 0; j <= i; ++j)
+        {
+          ata[i][j] = a[0][i] * a[0][j] + a[1][i] * a[1][j] + a[2][i] * a[2][j];
+        }
+      }
+      V s11 = ata[0][0], s21 = ata[1][0], s22 = ata[1][1], s31 = ata[2][0], s32 = ata[2][1], s33 = ata[2][2];
+      std::array<V, 4> q{V{0}, V{0}, V{0}, V{1}};
+      for (int sweep = 0; sweep < Sweeps<T>; ++sweep)
+      {
+        jacobiConjugation(0, 1, 2, s11, s21, s22, s31, s32, s33, q);
+        jacobiConjugation(1, 2, 0, s11, s21, s22, s31, s32, s33, q);
+        jacobiConjugation(2, 0, 1, s11, s21, s22, s31, s32, s33, q);
+      }
+
+      auto const norm = rsqrt(q[0] * q[0] + q[1] * q[1] + q[2] * q[2] + q[3] * q[3]);
+      auto const qx = q[0] * norm, qy = q[1] * norm, qz = q[2] * norm, qw = q[3] * norm;
+      v[0][0] = V{1} - V{2} * (qy * qy + qz * qz);
+      v[0][1] = V{2} * (qx * qy - qw * qz);
+      v[0][2] = V{2} * (qx * qz + qw * qy);
+      v[1][0] = V{2} * (qx * qy + qw * qz);
+      v[1][1] = V{1} - V{2} * (qx * qx + qz * qz);
+      v[1][2] = V{2} * (qy * qz - qw * qx);
+      v[2][0] = V{2} * (qx * qz - qw * qy);
+      v[2][1] = V{2} * (qy * qz + qw * qx);
+      v[2][2] = V{1} - V{2} * (qx * qx + qy * qy);
+
+      // b = a * v, columns sorted by decreasing norm
+      V b[3][3];
+      for (std::size_t i = 0; i < 3; ++i)
+      {
+        for (std::size_t j = 0; j < 3; ++j)
+        {
+          b[i][j] = a[i][0] * v[0][j] + a[i][1] * v[1][j] + a[i][2] * v[2][j];
+        }
+      }
+      V rho[3];
+      for (std::size_t j = 0; j < 3; ++j)
+      {
+        rho[j] = b[0][j] * b[0][j] + b[1][j] * b[1][j] + b[2][j] * b[2][j];
+      }
+      auto const sortColumns = [&](std::size_t const j, std::size_t const k) {
+        auto const mask = rho[j] < rho[k];
+        for (std::size_t i = 0; i < 3; ++i)
+        {
+          condNegSwap(mask, b[i][j], b[i][k]);
+          condNegSwap(mask, v[i][j], v[i][k]);
+        }
+        condSwap(mask, rho[j], rho[k]);
+      };
+      sortColumns(0, 1);
+      sortColumns(0, 2);
+      sortColumns(1, 2);
+
+      // QR decomposition of b with three Givens rotations
+      V const epsilon{std::numeric_limits<T>::epsilon() * T{8}};
+      V ch1, sh1, ch2, sh2, ch3, sh3;
+      V r[3][3];
+
+      qrGivens(b[0][0], b[1][0], epsilon, ch1, sh1);
+      auto ga = V{1} - V{2} * sh1 * sh1;
+      auto gb = V{2} * ch1 * sh1;
+      for (std::size_t j = 0; j < 3; ++j)
+      {
+        r[0][j] = ga * b[0][j] + gb * b[1][j];
+        r[1][j] = -gb * b[0][j] + ga * b[1][j];
+        r[2][j] = b[2][j];
+      }
+
+      qrGivens(r[0][0], r[2][0], epsilon, ch2, sh2);
+      ga = V{1} - V{2} * sh2 * sh2;
+      gb = V{2} * ch2 * sh2;
+      for (std::size_t j = 0; j < 3; ++j)
+      {
+        b[0][j] = ga * r[0][j] + gb * r[2][j];
+        b[1][j] = r[1][j];
+        b[2][j] = -gb * r[0][j] + ga * r[2][j];
+      }
+
+      qrGivens(b[1][1], b[2][1], epsilon, ch3, sh3);
+      ga = V{1} - V{2} * sh3 * sh3;
+      gb = V{2} * ch3 * sh3;
+      for (std::size_t j = 0; j < 3; ++j)
+      {
+        r[0][j] = b[0][j];
+        r[1][j] = ga * b[1][j] + gb * b[2][j];
+        r[2][j] = -gb * b[1][j] + ga * b[2][j];
+      }
+      s[0] = r[0][0];
+      s[1] = r[1][1];
+      s[2] = r[2][2];
+
+      // u = q1 * q2 * q3
+      auto const sh12 = sh1 * sh1, sh22 = sh2 * sh2, sh32 = sh3 * sh3;
+      auto const m12 = V{2} * sh12 - V{1}, m22 = V{2} * sh22 - V{1}, m32 = V{2} * sh32 - V{1};
+      u[0][0] = m12 * m22;
+      u[0][1] = V{4} * ch2 * ch3 * m12 * sh2 * sh3 + V{2} * ch1 * sh1 * m32;
+      u[0][2] = V{4} * ch1 * ch3 * sh1 * sh3 - V{2} * ch2 * m12 * sh2 * m32;
+      u[1][0] = -V{2} * ch1 * sh1 * m22;
+      u[1][1] = -V{8} * ch1 * ch2 * ch3 * sh1 * sh2 * sh3 + m12 * m32;
+      u[1][2] = -V{2} * ch3 * sh3 + V{4} * sh1 * (ch3 * sh1 * sh3 + ch1 * ch2 * sh2 * m32);
+      u[2][0] = V{2} * ch2 * sh2;
+      u[2][1] = -V{2} * ch3 * m22 * sh3;
+      u[2][2] = m22 * m32;
+    }
+
+    template <typename T>
+    inline auto polarFromSvd(Svd<T> const &d) noexcept -> Polar<T>
+    {
+      auto const vt = transpose(d.v);
+      Matrix<T, 3, 3> const scaled{d.v[0] * d.sigma[0], d.v[1] * d.sigma[1], d.v[2] * d.sigma[2]};
+      return {d.u * vt, scaled * vt};
+    }
+  } // namespace detail::svd
+
+  /**
+   * Computes the singular value decomposition of a 3x3 matrix.
+   *
+   * Uses a fixed number of Jacobi sweeps with approximate Givens rotations
+   * and no data dependent branches, after McAdams et al.
+   *
+   * @param mat the matrix to decompose
+   * @return u, sigma and v with mat = u * diag(sigma) * transpose(v)
+   */
+  template <typename T>
+  inline auto svd(Matrix<T, 3, 3> const &mat) noexcept -> Svd<T>
+  {
+    T a[3][3], u[3][3], s[3], v[3][3];
+    for (std::size_t i = 0; i < 3; ++i)
+    {
+      for (std::size_t j = 0; j < 3; ++j)
+      {
+        a[i][j] = mat[j][i];
+      }
+    }
+    detail::svd::decompose<T, T>(a, u, s, v);
+    return {Matrix<T, 3, 3>{u[0][0], u[1][0], u[2][0], u[0][1], u[1][1], u[2][1], u[0][2], u[1][2], u[2][2]},
+            {s[0], s[1], s[2]},
+            Matrix<T, 3, 3>{v[0][0], v[1][0], v[2][0], v[0][1], v[1][1], v[2][1], v[0][2], v[1][2], v[2][2]}};
+  }
+
+  /**
+   * Computes the polar decomposition of a 3x3 matrix.
+   *
+   * @param mat the matrix to decompose
+   * @return the rotation and symmetric stretch with mat = rotation * stretch
+   */
+  template <typename T>
+  inline auto polar(Matrix<T, 3, 3> const &mat) noexcept -> Polar<T>
+  {
+    return detail::svd::polarFromSvd(svd(mat));
+  }
+
+  namespace batch
+  {
+    /// Matrices decomposed in lockstep, 8 floats fill one AVX register
+    constexpr std::size_t SvdLanes = 8;
+
+    /**
+     * @brief Read only 3x3 matrices stored as one array per element
+     *
+     * elements[3 * c + r] points to the element at column c, row r of every
+     * matrix.
+     */
+    template <typename T>
+    struct Matrices33SoA
+    {
+      std::array<T const *, 9> elements; ///< one array per element, column major
+    };
+
+    /**
+     * @brief Writable 3x3 matrices stored as one array per element
+     */
+    template <typename T>
+    struct Matrices33SoAOut
+    {
+      std::array<T *, 9> elements; ///< one array per element, column major
+    };
+
+    /**
+     * Computes the singular value decomposition of count matrices,
+     * SvdLanes at a time.
+     *
+     * @param mat the matrices to decompose
+     * @param u receives the left singular vectors
+     * @param sigma receives the singular values, one array per value
+     * @param v receives the right singular vectors
+     * @param count the number of matrices
+     */
+    template <typename T>
+    inline auto svd(Matrices33SoA<T> const &mat, Matrices33SoAOut<T> const &u, std::array<T *, 3> const &sigma,
+                    Matrices33SoAOut<T> const &v, std::size_t const count) noexcept -> void
+    {
+      using Lanes = detail::svd::Lanes<T, SvdLanes>;
+      for (std::size_t begin = 0; begin < count; begin += SvdLanes)
+      {
+        auto const size = std::min(SvdLanes, count - begin);
+        Lanes a[3][3], lu[3][3], ls[3], lv[3][3];
+        for (std::size_t i = 0; i < 3; ++i)
+        {
+          for (std::size_t j = 0; j < 3; ++j)
+          {
+            a[i][j] = Lanes{T{0}};
+            std::copy_n(mat.elements[3 * j + i] + begin, size, a[i][j].v.begin());
+          }
+        }
+        detail::svd::decompose<Lanes, T>(a, lu, ls, lv);
+        for (std::size_t i = 0; i < 3; ++i)
+        {
+          for (std::size_t j = 0; j < 3; ++j)
+          {
+            std::copy_n(lu[i][j].v.begin(), size, u.elements[3 * j + i] + begin);
+            std::copy_n(lv[i][j].v.begin(), size, v.elements[3 * j + i] + begin);
+          }
+          std::copy_n(ls[i].v.begin(), size, sigma[i] + begin);
+        }
+      }
+    }
+
+    /**
+     * Computes the polar decomposition of count matrices, SvdLanes at a
+     * time.
+     *
+     * @param mat the matrices to decompose
+     * @param rotation receives the rotations
+     * @param stretch receives the symmetric stretches
+     * @param count the number of matrices
+     */
+    template <typename T>
+    inline auto polar(Matrices33SoA<T> const &mat, Matrices33SoAOut<T> const &rotation,
+                      Matrices33SoAOut<T> const &stretch, std::size_t const count) noexcept -> void
+    {
+      using Lanes = detail::svd::Lanes<T, SvdLanes>;
+      for (std::size_t begin = 0; begin < count; begin += SvdLanes)
+      {
+        auto const size = std::min(SvdLanes, count - begin);
+        Lanes a[3][3], u[3][3], s[3], v[3][3];
+        for (std::size_t i = 0; i < 3; ++i)
+        {
+          for (std::size_t j = 0; j < 3; ++j)
+          {
+            a[i][j] = Lanes{T{0}};
+            std::copy_n(mat.elements[3 * j + i] + begin, size, a[i][j].v.begin());
+          }
+        }
+        detail::svd::decompose<Lanes, T>(a, u, s, v);
+        for (std::size_t i = 0; i < 3; ++i)
+        {
+          for (std::size_t j = 0; j < 3; ++j)
+          {
+            // rotation = u * transpose(v), stretch = v * diag(s) * transpose(v)
+            auto const r = u[i][0] * v[j][0] + u[i][1] * v[j][1] + u[i][2] * v[j][2];
+            auto const p = v[i][0] * s[0] * v[j][0] + v[i][1] * s[1] * v[j][1] + v[i][2] * s[2] * v[j][2];
+            std::copy_n(r.v.begin(), size, rotation.elements[3 * j + i] + begin);
+            std::copy_n(p.v.begin(), size, stretch.elements[3 * j + i] + begin);
+          }
+        }
+      }
+    }
+  } // namespace batch
+
+} // namespace cagey::math
@@ -0,0 +1,211 @@
+//=============================================================================
+//
+// cagey-math - C++-17 Vector Math Library
+// Copyright (c) 2020 Kyle Girard <theycallmecoach@gmail.com>
+//
+// The MIT License (MIT)
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+//=============================================================================
+
+#pragma once
+
+/**
+ * @file
+ * @brief Compile time swizzles for vectors of any size
+ */
+
+#include <cstddef>
+#include <utility>
+
+#include "cagey-math/Vector2.hh"
+#include "cagey-math/Vector3.hh"
+#include "cagey-math/Vector4.hh"
+
+namespace cagey::math
+{
+
+  /**
+   * @brief A writable view of the elements I... of a vector.
+   *
+   * Created by swizzleRef().  Assigning to the proxy writes through to the
+   * referenced vector, reading converts to a Vector with sizeof...(I) elements.
+   *
+   * @tparam T the type of elements of the referenced vector
+   * @tparam N the number of elements of the referenced vector
+   * @tparam S the coordinate space of the referenced vector
+   * @tparam I the indices of the referenced elements
+   */
+  template <typename T, std::size_t N, typename S, std::size_t... I>
+  class SwizzleProxy
+  {
+  public:
+    const static std::size_t Size = sizeof...(I); ///< The number of elements in this swizzle
+    using VectorType = Vector<T, Size, S>;        ///< The type this swizzle converts to
+
+    /**
+     * @brief Create a swizzle of the given vector
+     *
+     * @param v the referenced vector
+     */
+    explicit constexpr SwizzleProxy(Vector<T, N, S> &v) noexcept : vec{v} {}
+
+    /**
+     * @brief Read the swizzled elements into a new vector
+     */
+    constexpr operator VectorType() const noexcept
+    {
+      return VectorType{vec[I]...};
+    }
+
+    /**
+     * @brief Write the given vector to the swizzled elements
+     *
+     * @param v the source vector
+     */
+    constexpr auto operator=(VectorType const &v) noexcept -> SwizzleProxy &
+    {
+      apply(v, [](T &l, T const &r) { l = r; }, std::make_index_sequence<Size>());
+      return *this;
+    }
+
+    /**
+     * @brief Add the given vector componentwise to the swizzled elements
+     *
+     * @param v the source vector
+     */
+    constexpr auto operator+=(VectorType const &v) noexcept -> SwizzleProxy &
+    {
+      apply(v, [](T &l, T const &r) { l += r; }, std::make_index_sequence<Size>());
+      return *this;
+    }
+
+    /**
+     * @brief Subtract the given vector componentwise from the swizzled elements
+     *
+     * @param v the source vector
+     */
+    constexpr auto operator-=(VectorType const &v) noexcept -> SwizzleProxy &
+    {
+      apply(v, [](T &l, T const &r) { l -= r; }, std::make_index_sequence<Size>());
+      return *this;
+    }
+
+    /**
+     * @brief Multiply the swizzled elements componentwise with the given vector
+     *
+     * @param v the source vector
+     */
+    constexpr auto operator*=(VectorType const &v) noexcept -> SwizzleProxy &
+    {
+      apply(v, [](T &l, T const &r) { l *= r; }, std::make_index_sequence<Size>());
+      return *this;
+    }
+
+    /**
+     * @brief Divide the swizzled elements componentwise with the given vector
+     *
+     * @param v the source vector
+     */
+    constexpr auto operator/=(VectorType const &v) noexcept -> SwizzleProxy &
+    {
+      apply(v, [](T &l, T const &r) { l /= r; }, std::make_index_sequence<Size>());
+      return *this;
+    }
+
+  private:
+    template <typename Op, std::size_t... J>
+    constexpr auto apply(VectorType const &v, Op op, std::index_sequence<J...>) noexcept -> void
+    {
+      constexpr std::size_t indices[] = {I...};
+      (op(vec[indices[J]], v[J]), ...);
+    }
+
+    Vector<T, N, S> &vec;
+  };
+
+  namespace detail
+  {
+    template <std::size_t... I>
+    constexpr auto uniqueIndices() noexcept -> bool
+    {
+      constexpr std::size_t indices[] = {I...};
+      for (std::size_t i = 0; i < sizeof...(I); ++i)
+      {
+        for (std::size_t j = i + 1; j < sizeof...(I); ++j)
+        {
+          if (indices[i] == indices[j])
+          {
+            return false;
+          }
+        }
+      }
+      return true;
+    }
+  } // namespace detail
+
+  /**
+   * Create a new vector from the elements I... of v.
+   *
+   * Indices may repeat, for example swizzle<0, 0, 1, 1>(v) is v.xxyy.  The
+   * result is built with a single pack expansion so optimizing compilers
+   * lower it to one shuffle when v is held in a SIMD register.
+   *
+   * @tparam I the indices of the elements of v to use
+   * @tparam T The component type of v
+   * @tparam N The number of components of v
+   * @tparam S The coordinate space of v, kept by the result
+   *
+   * @param v A Vector.
+   * @return A vector with sizeof...(I) elements
+   */
+  template <std::size_t... I, typename T, std::size_t N, typename S>
+  inline constexpr auto swizzle(Vector<T, N, S> const &v) noexcept -> Vector<T, sizeof...(I), S>
+  {
+    static_assert(sizeof...(I) > 0, "swizzle needs at least one index");
+    static_assert(((I < N) && ...), "swizzle index out of range");
+    return Vector<T, sizeof...(I), S>{v[I]...};
+  }
+
+  /**
+   * Create a writable view of the elements I... of v.
+   *
+   * @code
+   * swizzleRef<2, 1, 0>(v) = Vector3f{1, 2, 3}; // v.z = 1, v.y = 2, v.x = 3
+   * @endcode
+   *
+   * @tparam I the indices of the elements of v to reference, must be unique
+   * @tparam T The component type of v
+   * @tparam N The number of components of v
+   * @tparam S The coordinate space of v
+   *
+   * @param v A Vector.
+   * @return A proxy referencing the elements of v
+   */
+  template <std::size_t... I, typename T, std::size_t N, typename S>
+  inline constexpr auto swizzleRef(Vector<T, N, S> &v) noexcept -> SwizzleProxy<T, N, S, I...>
+  {
+    static_assert(sizeof...(I) > 0, "swizzle needs at least one index");
+    static_assert(((I < N) && ...), "swizzle index out of range");
+    static_assert(detail::uniqueIndices<I...>(), "writable swizzles cannot repeat an index");
+    return SwizzleProxy<T, N, S, I...>{v};
+  }
+
+} //namespace cagey::math
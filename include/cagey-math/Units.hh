@@ -0,0 +1,311 @@
+//=============================================================================
+//
+// cagey-math - C++-17 Vector Math Library
+// Copyright (c) 2020 Kyle Girard <theycallmecoach@gmail.com>
+//
+// The MIT License (MIT)
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+//=============================================================================
+
+#pragma once
+
+/**
+ * @file
+ * @brief Dimension checked physical quantities usable as Vector elements
+ *
+ * A Quantity is a value tagged with the exponents of length, mass and time of
+ * its unit, in the same way BaseAngle tags a value with its angle unit.  Adding
+ * quantities of different dimensions does not compile, multiplying and
+ * dividing them computes the dimension of the result.  Quantities compose
+ * through the Vector operators, dot and cross, and cost nothing at runtime.
+ */
+
+#include <cmath>
+#include <type_traits>
+
+#include "cagey-math/detail/vec_type.hh"
+
+namespace cagey::math
+{
+
+  /**
+   * The dimension of a physical quantity as SI base unit exponents.
+   *
+   * @tparam L the exponent of length (meters)
+   * @tparam M the exponent of mass (kilograms)
+   * @tparam S the exponent of time (seconds)
+   */
+  template <int L, int M, int S>
+  struct Dimension
+  {
+    static constexpr int Length = L; ///< the exponent of length
+    static constexpr int Mass = M;   ///< the exponent of mass
+    static constexpr int Time = S;   ///< the exponent of time
+  };
+
+  template <typename T, typename D>
+  class Quantity;
+
+  namespace detail::units
+  {
+    template <typename A, typename B>
+    using Multiply = Dimension<A::Length + B::Length, A::Mass + B::Mass, A::Time + B::Time>;
+
+    template <typename A, typename B>
+    using Divide = Dimension<A::Length - B::Length, A::Mass - B::Mass, A::Time - B::Time>;
+
+    /// A quantity of dimension D, or a plain T when D is dimensionless
+    template <typename T, typename D>
+    struct Make
+    {
+      using Type = Quantity<T, D>;
+    };
+
+    template <typename T>
+    struct Make<T, Dimension<0, 0, 0>>
+    {
+      using Type = T;
+    };
+
+    template <typename T, typename D>
+    using Result = typename Make<T, D>::Type;
+
+    template <typename T, typename D>
+    inline constexpr auto make(T const value) noexcept -> Result<T, D>
+    {
+      return Result<T, D>(value);
+    }
+
+  } // namespace detail::units
+
+  /**
+   * A value of type T in the SI units of dimension D.
+   *
+   * @tparam T the type of the value
+   * @tparam D the Dimension of the value
+   */
+  template <typename T, typename D>
+  class Quantity
+  {
+  public:
+    /** @cond doxygen has some issues with static assert */
+    static_assert(std::is_arithmetic<T>::value, "Underlying type must be a number");
+    /** @endcond */
+
+    using Type = T;              ///< Underlying type
+    using DimensionType = D;     ///< The dimension of this quantity
+
+    /**
+     * Default construct a quantity, the value is uninitialized unless value
+     * initialized.
+     */
+    constexpr Quantity() = default;
+
+    /**
+     * Explicit conversion constructor from a raw value in SI units
+     *
+     * @param value A value
+     */
+    constexpr explicit Quantity(T const value) noexcept : value{value} {}
+
+    /**
+     * Explicit conversion operator to the raw value in SI units
+     *
+     * @return the value without its unit
+     */
+    constexpr explicit operator T() const noexcept { return value; }
+
+    /**
+     * Add the value of 'other' to this value.
+     *
+     * @param other a quantity of the same dimension
+     */
+    constexpr auto operator+=(Quantity const &other) noexcept -> Quantity &
+    {
+      value += other.value;
+      return *this;
+    }
+
+    /**
+     * Subtract the value of 'other' from this value.
+     *
+     * @param other a quantity of the same dimension
+     */
+    constexpr auto operator-=(Quantity const &other) noexcept -> Quantity &
+    {
+      value -= other.value;
+      return *this;
+    }
+
+    /**
+     * Multiply this value by a dimensionless 'val'.
+     *
+     * @param val the scaling factor
+     */
+    constexpr auto operator*=(T const val) noexcept -> Quantity &
+    {
+      value *= val;
+      return *this;
+    }
+
+    /**
+     * Divide this value by a dimensionless 'val'.
+     *
+     * @param val the scaling factor
+     */
+    constexpr auto operator/=(T const val) noexcept -> Quantity &
+    {
+      value /= val;
+      return *this;
+    }
+
+    friend constexpr auto operator+(Quantity lhs, Quantity const &rhs) noexcept -> Quantity { return lhs += rhs; }
+
+    friend constexpr auto operator-(Quantity lhs, Quantity const &rhs) noexcept -> Quantity { return lhs -= rhs; }
+
+    friend constexpr auto operator-(Quantity const &val) noexcept -> Quantity { return Quantity{-val.value}; }
+
+    friend constexpr auto operator*(Quantity lhs, T const val) noexcept -> Quantity { return lhs *= val; }
+
+    friend constexpr auto operator*(T const val, Quantity rhs) noexcept -> Quantity { return rhs *= val; }
+
+    friend constexpr auto operator/(Quantity lhs, T const val) noexcept -> Quantity { return lhs /= val; }
+
+    friend constexpr auto operator/(T const val, Quantity const &rhs) noexcept
+        -> detail::units::Result<T, detail::units::Divide<Dimension<0, 0, 0>, D>>
+    {
+      return detail::units::make<T, detail::units::Divide<Dimension<0, 0, 0>, D>>(val / rhs.value);
+    }
+
+    friend constexpr auto operator==(Quantity const &lhs, Quantity const &rhs) noexcept -> bool
+    {
+      return lhs.value == rhs.value;
+    }
+
+    friend constexpr auto operator!=(Quantity const &lhs, Quantity const &rhs) noexcept -> bool
+    {
+      return !(lhs == rhs);
+    }
+
+    friend constexpr auto operator<(Quantity const &lhs, Quantity const &rhs) noexcept -> bool
+    {
+      return lhs.value < rhs.value;
+    }
+
+    friend constexpr auto operator>(Quantity const &lhs, Quantity const &rhs) noexcept -> bool { return rhs < lhs; }
+
+    friend constexpr auto operator<=(Quantity const &lhs, Quantity const &rhs) noexcept -> bool
+    {
+      return !(lhs > rhs);
+    }
+
+    friend constexpr auto operator>=(Quantity const &lhs, Quantity const &rhs) noexcept -> bool
+    {
+      return !(lhs < rhs);
+    }
+
+  private:
+    Type value;
+  };
+
+  /**
+   * Multiply two quantities, the dimensions add.
+   *
+   * @param lhs the left hand side of the multiplication
+   * @param rhs the right hand side of the multiplication
+   * @return the product, a plain T when dimensionless
+   */
+  template <typename T, typename A, typename B>
+  inline constexpr auto operator*(Quantity<T, A> const &lhs, Quantity<T, B> const &rhs) noexcept
+      -> detail::units::Result<T, detail::units::Multiply<A, B>>
+  {
+    return detail::units::make<T, detail::units::Multiply<A, B>>(static_cast<T>(lhs) * static_cast<T>(rhs));
+  }
+
+  /**
+   * Divide two quantities, the dimensions subtract.
+   *
+   * @param lhs the left hand side of the division
+   * @param rhs the right hand side of the division
+   * @return the quotient, a plain T when dimensionless
+   */
+  template <typename T, typename A, typename B>
+  inline constexpr auto operator/(Quantity<T, A> const &lhs, Quantity<T, B> const &rhs) noexcept
+      -> detail::units::Result<T, detail::units::Divide<A, B>>
+  {
+    return detail::units::make<T, detail::units::Divide<A, B>>(static_cast<T>(lhs) / static_cast<T>(rhs));
+  }
+
+  /**
+   * The square root of a quantity whose dimension has even exponents, so
+   * that length() works on vectors of quantities.
+   *
+   * @param value a quantity
+   * @return the square root of value
+   */
+  template <typename T, int L, int M, int S>
+  inline auto sqrt(Quantity<T, Dimension<L, M, S>> const &value) noexcept
+      -> detail::units::Result<T, Dimension<L / 2, M / 2, S / 2>>
+  {
+    static_assert(L % 2 == 0 && M % 2 == 0 && S % 2 == 0, "the square root of this dimension is not a dimension");
+    using std::sqrt;
+    return detail::units::make<T, Dimension<L / 2, M / 2, S / 2>>(sqrt(static_cast<T>(value)));
+  }
+
+  /**
+   * The magnitude of a quantity, so that fuzzyEquals works on vectors of
+   * quantities.
+   *
+   * @param value a quantity
+   * @return the absolute value of value
+   */
+  template <typename T, typename D>
+  inline auto abs(Quantity<T, D> const &value) noexcept -> Quantity<T, D>
+  {
+    using std::abs;
+    return Quantity<T, D>{abs(static_cast<T>(value))};
+  }
+
+  /// Quantities are valid vector elements when their value type is
+  template <typename T, typename D>
+  struct is_vec_type<Quantity<T, D>> : public is_vec_type<T>
+  {
+  };
+
+  /// @name Common quantities
+  ///@{
+  template <typename T>
+  using Length = Quantity<T, Dimension<1, 0, 0>>; ///< meters
+  template <typename T>
+  using Mass = Quantity<T, Dimension<0, 1, 0>>; ///< kilograms
+  template <typename T>
+  using Time = Quantity<T, Dimension<0, 0, 1>>; ///< seconds
+  template <typename T>
+  using Velocity = Quantity<T, Dimension<1, 0, -1>>; ///< meters per second
+  template <typename T>
+  using Acceleration = Quantity<T, Dimension<1, 0, -2>>; ///< meters per second squared
+  template <typename T>
+  using Force = Quantity<T, Dimension<1, 1, -2>>; ///< newtons
+  template <typename T>
+  using Energy = Quantity<T, Dimension<2, 1, -2>>; ///< joules
+  ///@}
+
+} // namespace cagey::math
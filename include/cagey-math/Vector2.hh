@@ -41,13 +41,14 @@ namespace cagey::math
    * @brief A 2 element Vector.
    * 
    * @tparam T the type of elements of this vector
+   * @tparam Space a tag for the coordinate space of this vector, void when untagged
    */
-  template <typename T>
-  class Vector<T, 2>
+  template <typename T, typename Space>
+  class Vector<T, 2, Space>
   {
   public:
     const static std::size_t Size = 2;                                  ///< The number of elements in this Point
-    using Type = Vector<T, Size>;                                       ///< The vector type
+    using Type = Vector<T, Size, Space>;                                ///< The vector type
     using ElementType = T;                                              ///< The underlying value type
     using Reference = ElementType &;                                    ///< The vector element reference type
     using ConstReference = ElementType const &;                         ///< The vector element const reference type
@@ -139,7 +140,7 @@ namespace cagey::math
      * @param v the source vector
      */
     template <typename U>
-    explicit constexpr Vector(Vector<U, Size> const &v) noexcept
+    explicit constexpr Vector(Vector<U, Size, Space> const &v) noexcept
         : elements{static_cast<T>(v.elements[0]),
                    static_cast<T>(v.elements[1])} {}
     ///@}
@@ -182,7 +183,7 @@ namespace cagey::math
      * 
      * @param v src vectror
      */
-    constexpr auto operator=(Vector<T, Size> const &v) noexcept -> Vector &
+    constexpr auto operator=(Vector<T, Size, Space> const &v) noexcept -> Vector &
     {
       elements = v.elements;
       return *this;
@@ -197,7 +198,7 @@ namespace cagey::math
      * @param v a vector
      */
     template <typename U>
-    constexpr auto operator+=(Vector<U, Size> const &v) noexcept -> Vector &
+    constexpr auto operator+=(Vector<U, Size, Space> const &v) noexcept -> Vector &
     {
       elements[0] += static_cast<T>(v.elements[0]);
       elements[1] += static_cast<T>(v.elements[1]);
@@ -209,7 +210,7 @@ namespace cagey::math
      * 
      * @param scalar the amount to add to each element of this vector
      */
-    template <typename U>
+    template <typename U, typename = detail::vector::EnableIfScalar<U>>
     constexpr auto operator+=(U const &scalar) noexcept -> Vector &
     {
       elements[0] += static_cast<T>(scalar);
@@ -223,7 +224,7 @@ namespace cagey::math
      * @param v the vector
      */
     template <typename U>
-    constexpr auto operator-=(Vector<U, Size> const &v) noexcept -> Vector &
+    constexpr auto operator-=(Vector<U, Size, Space> const &v) noexcept -> Vector &
     {
       elements[0] -= static_cast<T>(v.elements[0]);
       elements[1] -= static_cast<T>(v.elements[1]);
@@ -235,7 +236,7 @@ namespace cagey::math
      * 
      * @param scalar the amount to subtract
      */
-    template <typename U>
+    template <typename U, typename = detail::vector::EnableIfScalar<U>>
     constexpr auto operator-=(U const &scalar) noexcept -> Vector &
     {
       elements[0] -= static_cast<T>(scalar);
@@ -248,7 +249,7 @@ namespace cagey::math
      * 
      * @param scalar the amount to scale
      */
-    template <typename U>
+    template <typename U, typename = detail::vector::EnableIfScalar<U>>
     constexpr auto operator*=(U const &scalar) noexcept -> Vector &
     {
       elements[0] *= static_cast<T>(scalar);
@@ -262,7 +263,7 @@ namespace cagey::math
      * @param v the vector to scale
      */
     template <typename U>
-    constexpr auto operator*=(Vector<U, Size> const &v) noexcept -> Vector &
+    constexpr auto operator*=(Vector<U, Size, Space> const &v) noexcept -> Vector &
     {
       elements[0] *= static_cast<T>(v.elements[0]);
       elements[1] *= static_cast<T>(v.elements[1]);
@@ -274,7 +275,7 @@ namespace cagey::math
      * 
      * @param scalar the amount to use in the division
      */
-    template <typename U>
+    template <typename U, typename = detail::vector::EnableIfScalar<U>>
     constexpr auto operator/=(U const &scalar) noexcept -> Vector &
     {
       elements[0] /= static_cast<T>(scalar);
@@ -288,7 +289,7 @@ namespace cagey::math
      * @param v the vector to divide with
      */
     template <typename U>
-    constexpr auto operator/=(Vector<U, Size> const &v) noexcept -> Vector &
+    constexpr auto operator/=(Vector<U, Size, Space> const &v) noexcept -> Vector &
     {
       elements[0] /= static_cast<T>(v.elements[0]);
       elements[1] /= static_cast<T>(v.elements[1]);
@@ -318,21 +319,21 @@ namespace cagey::math
     /**
      * @brief Increase each element of a copy of this vector
      */
-    constexpr auto operator++(int) noexcept -> Vector &
+    constexpr auto operator++(int) noexcept -> Vector
     {
-      Vector res = Vector{*this};
-      res = res++ * this;
-      return *res;
+      Vector res{*this};
+      ++*this;
+      return res;
     }
 
     /**
      * @brief Decrease each element of a copy of this vector
      */
-    constexpr auto operator--(int) noexcept -> Vector &
+    constexpr auto operator--(int) noexcept -> Vector
     {
-      Vector res = Vector{*this};
-      res = res-- * this;
-      return *res;
+      Vector res{*this};
+      --*this;
+      return res;
     }
 
     ///@}
@@ -406,4 +407,11 @@ namespace cagey::math
       };
     };
   };
+
+#if defined(CAGEY_MATH_EXTERN_TEMPLATES)
+  // instantiated once in the cagey_math library, see src/Instantiations.cc
+  extern template class Vector<float, 2>;
+  extern template class Vector<std::int32_t, 2>;
+#endif
+
 } //namespace cagey::math
\ No newline at end of file
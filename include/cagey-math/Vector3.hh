@@ -40,14 +40,15 @@ namespace cagey::math
    * @brief A 3 element Vector.
    * 
    * @tparam T the type of elements of this vector
+   * @tparam Space a tag for the coordinate space of this vector, void when untagged
    */
-  template <typename T>
-  class Vector<T, 3>
+  template <typename T, typename Space>
+  class Vector<T, 3, Space>
   {
   public:
     /// The number of elements in this Point
     const static std::size_t Size = 3;
-    using Type = Vector<T, Size>;                                       ///< The vector type
+    using Type = Vector<T, Size, Space>;                                ///< The vector type
     using ElementType = T;                                              ///< The underlying value type
     using Reference = ElementType &;                                    ///< The vector element reference type
     using ConstReference = ElementType const &;                         ///< The vector element const reference type
@@ -156,7 +157,7 @@ namespace cagey::math
      * @param v source vector
      */
     template <typename U>
-    explicit constexpr Vector(Vector<U, Size> const &v) noexcept
+    explicit constexpr Vector(Vector<U, Size, Space> const &v) noexcept
         : elements{static_cast<T>(v.elements[0]),
                    static_cast<T>(v.elements[1]),
                    static_cast<T>(v.elements[2])} {}
@@ -167,7 +168,7 @@ namespace cagey::math
      * @tparam VN a number >= Size
      */
     template <std::size_t VN, typename = std::enable_if_t<(VN > 2)>>
-    explicit constexpr Vector(Vector<T, VN> const &v) noexcept
+    explicit constexpr Vector(Vector<T, VN, Space> const &v) noexcept
         : elements{v.elements[0], v.elements[1], v.elements[2]} {}
 
     ///@}
@@ -209,7 +210,7 @@ namespace cagey::math
      * 
      * @param v src vectror
      */
-    constexpr auto operator=(Vector<T, Size> const &v) noexcept -> Vector &
+    constexpr auto operator=(Vector<T, Size, Space> const &v) noexcept -> Vector &
     {
       elements = v.elements;
       return *this;
@@ -224,7 +225,7 @@ namespace cagey::math
      * @param v a vector
      */
     template <typename U>
-    constexpr auto operator+=(Vector<U, Size> const &v) noexcept -> Vector &
+    constexpr auto operator+=(Vector<U, Size, Space> const &v) noexcept -> Vector &
     {
       elements[0] += static_cast<T>(v.elements[0]);
       elements[1] += static_cast<T>(v.elements[1]);
@@ -238,7 +239,7 @@ namespace cagey::math
      * @tparam U type of the given scalar
      * @param scalar the amount to add to each element of this vector
      */
-    template <typename U>
+    template <typename U, typename = detail::vector::EnableIfScalar<U>>
     constexpr auto operator+=(U const &scalar) noexcept -> Vector &
     {
       for (auto &&r : elements)
@@ -254,7 +255,7 @@ namespace cagey::math
      * @param v the vector
      */
     template <typename U>
-    constexpr auto operator-=(Vector<U, Size> const &v) noexcept -> Vector &
+    constexpr auto operator-=(Vector<U, Size, Space> const &v) noexcept -> Vector &
     {
       elements[0] -= static_cast<T>(v.elements[0]);
       elements[1] -= static_cast<T>(v.elements[1]);
@@ -267,7 +268,7 @@ namespace cagey::math
      * 
      * @param scalar the amount to subtract
      */
-    template <typename U>
+    template <typename U, typename = detail::vector::EnableIfScalar<U>>
     constexpr auto operator-=(U const &scalar) noexcept -> Vector &
     {
       for (auto &&r : elements)
@@ -282,7 +283,7 @@ namespace cagey::math
      * 
      * @param scalar the amount to scale
      */
-    template <typename U>
+    template <typename U, typename = detail::vector::EnableIfScalar<U>>
     constexpr auto operator*=(U const v) noexcept -> Vector &
     {
       for (auto &&r : elements)
@@ -298,7 +299,7 @@ namespace cagey::math
      * @param v the vector to scale
      */
     template <typename U>
-    constexpr auto operator*=(Vector<U, Size> const &v) noexcept -> Vector &
+    constexpr auto operator*=(Vector<U, Size, Space> const &v) noexcept -> Vector &
     {
       elements[0] *= static_cast<T>(v.elements[0]);
       elements[1] *= static_cast<T>(v.elements[1]);
@@ -311,7 +312,7 @@ namespace cagey::math
      * 
      * @param scalar the amount to use in the division
      */
-    template <typename U>
+    template <typename U, typename = detail::vector::EnableIfScalar<U>>
     constexpr auto operator/=(U const v) noexcept -> Vector &
     {
       for (auto &&r : elements)
@@ -327,7 +328,7 @@ namespace cagey::math
      * @param v the vector to divide with
      */
     template <typename U>
-    constexpr auto operator/=(Vector<U, Size> const &v) noexcept -> Vector &
+    constexpr auto operator/=(Vector<U, Size, Space> const &v) noexcept -> Vector &
     {
       elements[0] /= static_cast<T>(v.elements[0]);
       elements[1] /= static_cast<T>(v.elements[1]);
@@ -360,19 +361,21 @@ namespace cagey::math
     /**
      * @brief Increase each element of a copy of this vector
      */
-    constexpr auto operator++(int) noexcept -> Vector &
+    constexpr auto operator++(int) noexcept -> Vector
     {
-      Vector res = Vector(*this)++ * this;
-      return *res;
+      Vector res{*this};
+      ++*this;
+      return res;
     }
 
     /**
      * @brief Decrease each element of a copy of this vector
      */
-    constexpr auto operator--(int) noexcept -> Vector &
+    constexpr auto operator--(int) noexcept -> Vector
     {
-      Vector res = Vector(*this)-- * this;
-      return *res;
+      Vector res{*this};
+      --*this;
+      return res;
     }
 
     ///@}
@@ -464,4 +467,10 @@ namespace cagey::math
     };
   };
 
+#if defined(CAGEY_MATH_EXTERN_TEMPLATES)
+  // instantiated once in the cagey_math library, see src/Instantiations.cc
+  extern template class Vector<float, 3>;
+  extern template class Vector<std::int32_t, 3>;
+#endif
+
 } //namespace cagey::math
\ No newline at end of file
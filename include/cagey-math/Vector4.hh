@@ -40,14 +40,15 @@ namespace cagey::math
   /**
    * @brief An 4-Element Vector.
    * @tparam T the type of elements of this vector
+   * @tparam Space a tag for the coordinate space of this vector, void when untagged
    */
-  template <typename T>
-  class Vector<T, 4>
+  template <typename T, typename Space>
+  class Vector<T, 4, Space>
   {
   public:
     /// The number of elements in this Point
     const static std::size_t Size = 4;
-    using Type = Vector<T, Size>;                                       ///< The vector type
+    using Type = Vector<T, Size, Space>;                                ///< The vector type
     using ElementType = T;                                              ///< The underlying value type
     using Reference = ElementType &;                                    ///< The vector element reference type
     using ConstReference = ElementType const &;                         ///< The vector element const reference type
@@ -95,7 +96,7 @@ namespace cagey::math
     /// Explicit onstructors
     //==========================================================================
 
-    explicit constexpr Vector(T const v) noexcept : elements{v, v, v} {}
+    explicit constexpr Vector(T const v) noexcept : elements{v, v, v, v} {}
 
     constexpr Vector(T const x, T const y, T const z, T const w) noexcept
         : elements{x, y, z, w} {}
@@ -108,14 +109,14 @@ namespace cagey::math
         : elements{v[0], v[1], v[2], w} {}
 
     template <typename U>
-    explicit constexpr Vector(Vector<U, Size> const &v) noexcept
+    explicit constexpr Vector(Vector<U, Size, Space> const &v) noexcept
         : elements{static_cast<T>(v.elements[0]),
                    static_cast<T>(v.elements[1]),
                    static_cast<T>(v.elements[2]),
                    static_cast<T>(v.elements[3])} {}
 
     template <std::size_t VN, typename = std::enable_if_t<(VN > 4)>>
-    explicit constexpr Vector(Vector<T, VN> const &v) noexcept
+    explicit constexpr Vector(Vector<T, VN, Space> const &v) noexcept
         : elements{v.elements[0], v.elements[1], v.elements[2], v.elements[3]} {}
 
     //==========================================================================
@@ -143,14 +144,14 @@ namespace cagey::math
      * 
      * @param v src vectror
      */
-    constexpr auto operator=(Vector<T, Size> const &v) noexcept -> Vector &
+    constexpr auto operator=(Vector<T, Size, Space> const &v) noexcept -> Vector &
     {
       elements = v.elements;
       return *this;
     }
 
     template <typename U>
-    constexpr auto operator+=(Vector<U, Size> const &v) noexcept -> Vector &
+    constexpr auto operator+=(Vector<U, Size, Space> const &v) noexcept -> Vector &
     {
       elements[0] += static_cast<T>(v.elements[0]);
       elements[1] += static_cast<T>(v.elements[1]);
@@ -159,7 +160,7 @@ namespace cagey::math
       return *this;
     }
 
-    template <typename U>
+    template <typename U, typename = detail::vector::EnableIfScalar<U>>
     constexpr auto operator+=(U const &scalar) noexcept -> Vector &
     {
       for (auto &&r : elements)
@@ -170,7 +171,7 @@ namespace cagey::math
     }
 
     template <typename U>
-    constexpr auto operator-=(Vector<U, Size> const &v) noexcept -> Vector &
+    constexpr auto operator-=(Vector<U, Size, Space> const &v) noexcept -> Vector &
     {
       elements[0] -= static_cast<T>(v.elements[0]);
       elements[1] -= static_cast<T>(v.elements[1]);
@@ -179,7 +180,7 @@ namespace cagey::math
       return *this;
     }
 
-    template <typename U>
+    template <typename U, typename = detail::vector::EnableIfScalar<U>>
     constexpr auto operator-=(U const &scalar) noexcept -> Vector &
     {
       for (auto &&r : elements)
@@ -189,7 +190,7 @@ namespace cagey::math
       return *this;
     }
 
-    template <typename U>
+    template <typename U, typename = detail::vector::EnableIfScalar<U>>
     constexpr auto operator*=(U const v) noexcept -> Vector &
     {
       for (auto &&r : elements)
@@ -200,7 +201,7 @@ namespace cagey::math
     }
 
     template <typename U>
-    constexpr auto operator*=(Vector<U, Size> const &v) noexcept -> Vector &
+    constexpr auto operator*=(Vector<U, Size, Space> const &v) noexcept -> Vector &
     {
       elements[0] *= static_cast<T>(v.elements[0]);
       elements[1] *= static_cast<T>(v.elements[1]);
@@ -209,7 +210,7 @@ namespace cagey::math
       return *this;
     }
 
-    template <typename U>
+    template <typename U, typename = detail::vector::EnableIfScalar<U>>
     constexpr auto operator/=(U const v) noexcept -> Vector &
     {
       for (auto &&r : elements)
@@ -220,7 +221,7 @@ namespace cagey::math
     }
 
     template <typename U>
-    constexpr auto operator/=(Vector<U, Size> const &v) noexcept -> Vector &
+    constexpr auto operator/=(Vector<U, Size, Space> const &v) noexcept -> Vector &
     {
       elements[0] /= static_cast<T>(v.elements[0]);
       elements[1] /= static_cast<T>(v.elements[1]);
@@ -247,16 +248,18 @@ namespace cagey::math
       return *this;
     }
 
-    constexpr auto operator++(int) noexcept -> Vector &
+    constexpr auto operator++(int) noexcept -> Vector
     {
-      Vector res = Vector(*this)++ * this;
-      return *res;
+      Vector res{*this};
+      ++*this;
+      return res;
     }
 
-    constexpr auto operator--(int) noexcept -> Vector &
+    constexpr auto operator--(int) noexcept -> Vector
     {
-      Vector res = Vector(*this)-- * this;
-      return *res;
+      Vector res{*this};
+      --*this;
+      return res;
     }
 
     //==========================================================================
@@ -283,6 +286,42 @@ namespace cagey::math
       return xyz();
     }
 
+    //==========================================================================
+    /// @name Iterators
+    //==========================================================================
+
+    /**
+     * @brief returns iterator to the beginning
+     */
+    constexpr auto begin() noexcept -> typename Vector::Iterator
+    {
+      return elements.begin();
+    }
+
+    /**
+     * @brief returns iterator to the beginning
+     */
+    constexpr auto begin() const noexcept -> typename Vector::ConstIterator
+    {
+      return elements.begin();
+    }
+
+    /**
+     * @brief returns iterator to the end
+     */
+    constexpr auto end() noexcept -> typename Vector::Iterator
+    {
+      return elements.end();
+    }
+
+    /**
+     * @brief returns iterator to the end
+     */
+    constexpr auto end() const noexcept -> typename Vector::ConstIterator
+    {
+      return elements.end();
+    }
+
     //==========================================================================
     /// elements Members
     //==========================================================================
@@ -311,4 +350,10 @@ namespace cagey::math
     };
   };
 
+#if defined(CAGEY_MATH_EXTERN_TEMPLATES)
+  // instantiated once in the cagey_math library, see src/Instantiations.cc
+  extern template class Vector<float, 4>;
+  extern template class Vector<std::int32_t, 4>;
+#endif
+
 } //namespace cagey::math
\ No newline at end of file
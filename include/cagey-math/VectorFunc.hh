@@ -41,6 +41,8 @@ namespace cagey::math
    * Computes the dot product of lhs and rhs.
    *
    * @tparam T The type of the components of lhs
+   * @tparam U The type of the components of rhs, the same as T unless they
+   * are physical quantities
    * @tparam N The number of component of vec
    *
    * @param lhs A Vector
@@ -48,12 +50,16 @@ namespace cagey::math
    *
    * @return The dot product of lhs and rhs
    */
-  template <typename T, std::size_t N>
-  inline constexpr auto dot(Vector<T, N> const &lhs,
-                            Vector<T, N> const &rhs) noexcept -> T
+  template <typename T, typename U, std::size_t N, typename Space,
+            typename = std::enable_if_t<std::is_same<T, U>::value ||
+                                        !(std::is_arithmetic<T>::value && std::is_arithmetic<U>::value)>>
+  inline constexpr auto dot(Vector<T, N, Space> const &lhs,
+                            Vector<U, N, Space> const &rhs) noexcept
+      -> detail::vector::Product<T, U>
   {
+    using R = detail::vector::Product<T, U>;
     using std::begin;
-    return detail::inner_product(begin(lhs), end(lhs), begin(rhs), T(0));
+    return detail::inner_product(begin(lhs), end(lhs), begin(rhs), R(0));
   }
 
   /**
@@ -67,10 +73,10 @@ namespace cagey::math
    *
    * @return The cross product of lhs and rhs.
    */
-  template <typename T, typename U>
-  inline constexpr auto cross(Vector<T, 3> const &lhs,
-                              Vector<U, 3> const &rhs) noexcept
-      -> Vector3<decltype(std::declval<T>() * std::declval<U>())>
+  template <typename T, typename U, typename Space>
+  inline constexpr auto cross(Vector<T, 3, Space> const &lhs,
+                              Vector<U, 3, Space> const &rhs) noexcept
+      -> Vector<decltype(std::declval<T>() * std::declval<U>()), 3, Space>
   {
     return {
         lhs[1] * rhs[2] - lhs[2] * rhs[1],
@@ -79,6 +85,65 @@ namespace cagey::math
     };
   }
 
+  /**
+   * Computes the 2D cross product of lhs and rhs, the z component of the
+   * cross product of lhs and rhs extended with z = 0.
+   *
+   * @tparam T The type of the components of lhs
+   * @tparam U The type of the components of rhs
+   *
+   * @param lhs A Vector
+   * @param rhs A Vector
+   *
+   * @return Positive if rhs is counter clockwise from lhs, negative if
+   * clockwise and zero if they are parallel
+   */
+  template <typename T, typename U, typename Space>
+  inline constexpr auto cross(Vector<T, 2, Space> const &lhs,
+                              Vector<U, 2, Space> const &rhs) noexcept
+      -> decltype(std::declval<T>() * std::declval<U>())
+  {
+    return lhs[0] * rhs[1] - lhs[1] * rhs[0];
+  }
+
+  /**
+   * Computes the component wise minimum of lhs and rhs.
+   *
+   * @tparam T The type of the components of lhs
+   * @tparam N The number of component of vec
+   *
+   * @param lhs A Vector
+   * @param rhs A Vector
+   *
+   * @return A Vector holding the smaller of each pair of components
+   */
+  template <typename T, std::size_t N, typename Space>
+  inline constexpr auto min(Vector<T, N, Space> lhs,
+                            Vector<T, N, Space> const &rhs) noexcept -> Vector<T, N, Space>
+  {
+    detail::vector::forEachIndex<N>([&](std::size_t i) { lhs[i] = rhs[i] < lhs[i] ? rhs[i] : lhs[i]; });
+    return lhs;
+  }
+
+  /**
+   * Computes the component wise maximum of lhs and rhs.
+   *
+   * @tparam T The type of the components of lhs
+   * @tparam N The number of component of vec
+   *
+   * @param lhs A Vector
+   * @param rhs A Vector
+   *
+   * @return A Vector holding the larger of each pair of components
+   */
+  template <typename T, std::size_t N, typename Space>
+  inline constexpr auto max(Vector<T, N, Space> lhs,
+                            Vector<T, N, Space> const &rhs) noexcept -> Vector<T, N, Space>
+  {
+    detail::vector::forEachIndex<N>([&](std::size_t i) { lhs[i] = lhs[i] < rhs[i] ? rhs[i] : lhs[i]; });
+    return lhs;
+  }
+
   /**
    * Computes the length of vec.
    *
@@ -88,8 +153,8 @@ namespace cagey::math
    *
    * @return The length of vec.
    */
-  template <typename T, std::size_t N>
-  inline auto length(Vector<T, N> const &vec) noexcept -> T
+  template <typename T, std::size_t N, typename Space>
+  inline auto length(Vector<T, N, Space> const &vec) noexcept -> T
   {
     using std::sqrt;
     return sqrt(lengthSquared(vec));
@@ -104,8 +169,8 @@ namespace cagey::math
    *
    * @return The length of vec.
    */
-  template <typename T, std::size_t N>
-  inline auto lengthInverted(Vector<T, N> const &vec) noexcept -> T
+  template <typename T, std::size_t N, typename Space>
+  inline auto lengthInverted(Vector<T, N, Space> const &vec) noexcept -> T
   {
     return T{1} / length(vec);
   }
@@ -119,8 +184,9 @@ namespace cagey::math
    *
    * @return The squared length of vec.
    */
-  template <typename T, std::size_t N>
-  inline constexpr auto lengthSquared(Vector<T, N> const &vec) noexcept -> T
+  template <typename T, std::size_t N, typename Space>
+  inline constexpr auto lengthSquared(Vector<T, N, Space> const &vec) noexcept
+      -> decltype(dot(vec, vec))
   {
     return dot(vec, vec);
   }
@@ -134,8 +200,8 @@ namespace cagey::math
   * @param vec The Vector to check for zero length
   * @return true if length of vec is zero
   */
-  template <typename T, std::size_t S>
-  inline auto isZeroLength(Vector<T, S> const &vec) -> bool
+  template <typename T, std::size_t S, typename Space>
+  inline auto isZeroLength(Vector<T, S, Space> const &vec) -> bool
   {
     T epsilon = std::numeric_limits<T>::epsilon();
     using std::abs;
@@ -152,12 +218,34 @@ namespace cagey::math
    * @param vec A Vector
    * @return a normalized copy of vec.
    */
-  template <typename T, std::size_t N>
-  inline auto normalize(Vector<T, N> vec) noexcept -> Vector<T, N>
+  template <typename T, std::size_t N, typename Space>
+  inline auto normalize(Vector<T, N, Space> vec) noexcept -> Vector<T, N, Space>
   {
     return vec *= lengthInverted(vec);
   }
 
+  /**
+   * Reinterprets vec as a vector in another coordinate space.  Vectors tagged
+   * with different spaces do not mix in any operator, this is the explicit
+   * escape hatch for the places that really do change space, like applying a
+   * transform or passing a vector to untagged code (To = void).
+   *
+   * @tparam To the space tag of the result
+   * @tparam T The type of the components of vec
+   * @tparam N The number of component of vec
+   * @tparam From the space tag of vec
+   *
+   * @param vec A Vector
+   * @return a copy of vec tagged with To
+   */
+  template <typename To, typename T, std::size_t N, typename From>
+  inline constexpr auto spaceCast(Vector<T, N, From> const &vec) noexcept -> Vector<T, N, To>
+  {
+    Vector<T, N, To> result;
+    detail::vector::forEachIndex<N>([&](std::size_t i) { result[i] = vec[i]; });
+    return result;
+  }
+
   /**
    * Computes if the lhs and rhs are nearlyEqual within a tolerance of epsilon.
    *
@@ -168,8 +256,8 @@ namespace cagey::math
    * @param rhs A Vector
    * @param epsilon the amount of tolerance
    */
-  template <typename T, std::size_t N>
-  auto fuzzyEquals(Vector<T, N> const &lhs, Vector<T, N> const &rhs,
+  template <typename T, std::size_t N, typename Space>
+  auto fuzzyEquals(Vector<T, N, Space> const &lhs, Vector<T, N, Space> const &rhs,
                    T const epsilon = std::numeric_limits<T>::epsilon())
       -> bool
   {
@@ -181,4 +269,11 @@ namespace cagey::math
     });
   }
 
+#if defined(CAGEY_MATH_EXTERN_TEMPLATES)
+  // instantiated once in the cagey_math library, see src/Instantiations.cc
+  extern template auto fuzzyEquals(Vector<float, 2> const &, Vector<float, 2> const &, float) -> bool;
+  extern template auto fuzzyEquals(Vector<float, 3> const &, Vector<float, 3> const &, float) -> bool;
+  extern template auto fuzzyEquals(Vector<float, 4> const &, Vector<float, 4> const &, float) -> bool;
+#endif
+
 } // namespace cagey::math
\ No newline at end of file
@@ -0,0 +1,265 @@
+//=============================================================================
+//
+// cagey-math - C++-17 Vector Math Library
+// Copyright (c) 2020 Kyle Girard <theycallmecoach@gmail.com>
+//
+// The MIT License (MIT)
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+//=============================================================================
+
+#pragma once
+
+/**
+ * @file
+ * @brief Transform of points to clip space, perspective divide and viewport mapping
+ */
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <type_traits>
+
+#if defined(__SSE2__)
+#include <emmintrin.h>
+#endif
+
+#include "cagey-math/Matrix44.hh"
+#include "cagey-math/Projection.hh"
+
+namespace cagey::math
+{
+
+  /**
+   * A viewport rectangle in window coordinates and the depth range
+   * normalized device depth is mapped into.  A negative height flips y, as
+   * Vulkan expects.
+   *
+   * @tparam T the element type
+   */
+  template <typename T>
+  struct Viewport
+  {
+    T x;               ///< left edge
+    T y;               ///< bottom edge
+    T width;           ///< width
+    T height;          ///< height
+    T minDepth = T(0); ///< window depth of the low end of the clip depth range
+    T maxDepth = T(1); ///< window depth of the high end of the clip depth range
+  };
+
+  /**
+   * Bits set for each clip plane a point lies outside of.  A triangle can be
+   * culled when the flags of its vertices have a bit in common, and needs
+   * clipping when they do not but any of them is nonzero.
+   */
+  enum ClipFlags : std::uint8_t
+  {
+    ClipLeft = 1 << 0,   ///< x < -w
+    ClipRight = 1 << 1,  ///< x > w
+    ClipBottom = 1 << 2, ///< y < -w
+    ClipTop = 1 << 3,    ///< y > w
+    ClipMinZ = 1 << 4,   ///< z below the low end of the clip depth range
+    ClipMaxZ = 1 << 5,   ///< z > w
+  };
+
+  namespace batch
+  {
+    /**
+     * @brief Read only points stored as one array per component
+     */
+    template <typename T>
+    struct Points3SoA
+    {
+      std::array<T const *, 3> components; ///< x, y and z arrays
+    };
+
+    /**
+     * @brief Writable points stored as one array per component
+     */
+    template <typename T>
+    struct Points3SoAOut
+    {
+      std::array<T *, 3> components; ///< x, y and z arrays
+    };
+
+  } // namespace batch
+
+  namespace detail::viewport
+  {
+    /// Window = ndc * scale + offset per axis
+    template <typename T>
+    struct Mapping
+    {
+      std::array<T, 3> scale;
+      std::array<T, 3> offset;
+    };
+
+    template <typename T>
+    inline constexpr auto mapping(Viewport<T> const &viewport, ClipDepth const depth) noexcept -> Mapping<T>
+    {
+      auto const depthSpan = viewport.maxDepth - viewport.minDepth;
+      auto const halfWidth = viewport.width / T(2);
+      auto const halfHeight = viewport.height / T(2);
+      if (depth == ClipDepth::ZeroToOne)
+      {
+        return {{halfWidth, halfHeight, depthSpan},
+                {viewport.x + halfWidth, viewport.y + halfHeight, viewport.minDepth}};
+      }
+      return {{halfWidth, halfHeight, depthSpan / T(2)},
+              {viewport.x + halfWidth, viewport.y + halfHeight, viewport.minDepth + depthSpan / T(2)}};
+    }
+
+    template <typename T>
+    inline auto project(Matrix<T, 4, 4> const &m, Mapping<T> const &map, bool const zeroToOne, T const px,
+                        T const py, T const pz, T *out, std::uint8_t &flags) noexcept -> void
+    {
+      auto const x = m[0][0] * px + m[1][0] * py + m[2][0] * pz + m[3][0];
+      auto const y = m[0][1] * px + m[1][1] * py + m[2][1] * pz + m[3][1];
+      auto const z = m[0][2] * px + m[1][2] * py + m[2][2] * pz + m[3][2];
+      auto const w = m[0][3] * px + m[1][3] * py + m[2][3] * pz + m[3][3];
+      auto const minZ = zeroToOne ? T(0) : -w;
+      flags = static_cast<std::uint8_t>((x < -w ? ClipLeft : 0) | (x > w ? ClipRight : 0) |
+                                        (y < -w ? ClipBottom : 0) | (y > w ? ClipTop : 0) |
+                                        (z < minZ ? ClipMinZ : 0) | (z > w ? ClipMaxZ : 0));
+      auto const invW = T(1) / w;
+      out[0] = x * invW * map.scale[0] + map.offset[0];
+      out[1] = y * invW * map.scale[1] + map.offset[1];
+      out[2] = z * invW * map.scale[2] + map.offset[2];
+    }
+
+    /// Bit i of bits moved to the low bit of byte i, byte 0 first in memory on the little endian SSE2 targets
+    constexpr auto spreadBits(unsigned int bits) noexcept -> std::uint32_t
+    {
+      std::uint32_t result = 0;
+      for (unsigned int i = 0; i < 4; ++i)
+      {
+        auto const byte = ((bits >> i) & 1u) << (8 * i);
+        result |= byte;
+      }
+      return result;
+    }
+
+    constexpr std::uint32_t SpreadBits[16] = {
+        spreadBits(0), spreadBits(1), spreadBits(2), spreadBits(3), spreadBits(4), spreadBits(5),
+        spreadBits(6), spreadBits(7), spreadBits(8), spreadBits(9), spreadBits(10), spreadBits(11),
+        spreadBits(12), spreadBits(13), spreadBits(14), spreadBits(15)};
+
+  } // namespace detail::viewport
+
+  namespace batch
+  {
+    /**
+     * Transforms points by a view projection matrix, divides by w and maps the
+     * result into the viewport in one pass.  Float input is processed four
+     * points at a time with SSE2, using a reciprocal estimate refined by one
+     * Newton-Raphson step in place of the divide (about 23 bits).
+     *
+     * Window coordinates of points behind the eye (w < 0) are meaningless, their flags
+     * always have a bit set.
+     *
+     * @param viewProjection the transform from the space of the points to clip space
+     * @param points the points, w is taken to be 1
+     * @param count the number of points
+     * @param viewport the viewport to map normalized device coordinates into
+     * @param depth the clip depth range of viewProjection
+     * @param window receives the window coordinates and depth of each point
+     * @param flags receives the ClipFlags of each point
+     */
+    template <typename T>
+    inline auto projectToViewport(Matrix<T, 4, 4> const &viewProjection, Points3SoA<T> const &points,
+                                  std::size_t const count, Viewport<T> const &viewport, ClipDepth const depth,
+                                  Points3SoAOut<T> const &window, std::uint8_t *flags) noexcept -> void
+    {
+      auto const map = detail::viewport::mapping(viewport, depth);
+      auto const zeroToOne = depth == ClipDepth::ZeroToOne;
+      auto const &[px, py, pz] = points.components;
+      auto const &[wx, wy, wz] = window.components;
+      std::size_t i = 0;
+#if defined(__SSE2__)
+      if constexpr (std::is_same<T, float>::value)
+      {
+        // one broadcast register per matrix element, rows of the transform
+        __m128 m[4][4];
+        for (std::size_t r = 0; r < 4; ++r)
+        {
+          for (std::size_t c = 0; c < 4; ++c)
+          {
+            m[r][c] = _mm_set1_ps(viewProjection[c][r]);
+          }
+        }
+        __m128 scale[3];
+        __m128 offset[3];
+        for (std::size_t a = 0; a < 3; ++a)
+        {
+          scale[a] = _mm_set1_ps(map.scale[a]);
+          offset[a] = _mm_set1_ps(map.offset[a]);
+        }
+        auto const two = _mm_set1_ps(2.0f);
+        auto const signMask = _mm_set1_ps(-0.0f);
+        auto const zero = _mm_setzero_ps();
+        auto const dot = [](__m128 const *row, __m128 x, __m128 y, __m128 z) {
+          return _mm_add_ps(_mm_add_ps(_mm_mul_ps(row[0], x), _mm_mul_ps(row[1], y)),
+                            _mm_add_ps(_mm_mul_ps(row[2], z), row[3]));
+        };
+        for (; i + 4 <= count; i += 4)
+        {
+          auto const x0 = _mm_loadu_ps(px + i);
+          auto const y0 = _mm_loadu_ps(py + i);
+          auto const z0 = _mm_loadu_ps(pz + i);
+          auto const x = dot(m[0], x0, y0, z0);
+          auto const y = dot(m[1], x0, y0, z0);
+          auto const z = dot(m[2], x0, y0, z0);
+          auto const w = dot(m[3], x0, y0, z0);
+
+          auto const negW = _mm_xor_ps(w, signMask);
+          // spread each 4 bit plane mask to one bit per byte and store the flags of 4 points at once
+          auto const spread = [](__m128 mask, unsigned int plane) {
+            return detail::viewport::SpreadBits[_mm_movemask_ps(mask)] << plane;
+          };
+          std::uint32_t const packed =
+              spread(_mm_cmplt_ps(x, negW), 0) | spread(_mm_cmpgt_ps(x, w), 1) | spread(_mm_cmplt_ps(y, negW), 2) |
+              spread(_mm_cmpgt_ps(y, w), 3) | spread(_mm_cmplt_ps(z, zeroToOne ? zero : negW), 4) |
+              spread(_mm_cmpgt_ps(z, w), 5);
+          std::memcpy(flags + i, &packed, sizeof(packed));
+
+          // r' = r * (2 - w * r)
+          auto invW = _mm_rcp_ps(w);
+          invW = _mm_mul_ps(invW, _mm_sub_ps(two, _mm_mul_ps(w, invW)));
+          _mm_storeu_ps(wx + i, _mm_add_ps(_mm_mul_ps(_mm_mul_ps(x, invW), scale[0]), offset[0]));
+          _mm_storeu_ps(wy + i, _mm_add_ps(_mm_mul_ps(_mm_mul_ps(y, invW), scale[1]), offset[1]));
+          _mm_storeu_ps(wz + i, _mm_add_ps(_mm_mul_ps(_mm_mul_ps(z, invW), scale[2]), offset[2]));
+        }
+      }
+#endif
+      for (; i < count; ++i)
+      {
+        T out[3];
+        detail::viewport::project(viewProjection, map, zeroToOne, px[i], py[i], pz[i], out, flags[i]);
+        wx[i] = out[0];
+        wy[i] = out[1];
+        wz[i] = out[2];
+      }
+    }
+
+  } // namespace batch
+
+} // namespace cagey::math
@@ -0,0 +1,406 @@
+//=============================================================================
+//
+// cagey-math - C++-17 Vector Math Library
+// Copyright (c) 2020 Kyle Girard <theycallmecoach@gmail.com>
+//
+// The MIT License (MIT)
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+//=============================================================================
+
+#pragma once
+
+/**
+ * @file
+ * @brief Sparse voxel grid and ray traversal
+ */
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <unordered_map>
+
+#include "cagey-math/Vector3.hh"
+#include "cagey-math/detail/Parallel.hh"
+
+namespace cagey::math
+{
+
+  /**
+   * @brief A sparse set of occupied voxels.
+   *
+   * Voxel v covers the unit cube [v, v + 1).  Voxels are stored in hashed
+   * bricks of 8x8x8 voxels, one bit per voxel, and bricks without any
+   * occupied voxel are not stored.  Brick coordinates must fit in 21 bits,
+   * so voxel coordinates are limited to about +/- 8 million.
+   */
+  class VoxelGrid
+  {
+  public:
+    static constexpr std::int32_t BrickShift = 3;              ///< log2 of BrickSize
+    static constexpr std::int32_t BrickSize = 1 << BrickShift; ///< The number of voxels along each edge of a brick
+
+    /**
+     * @brief The occupancy of an 8x8x8 block of voxels
+     *
+     * Each word holds one z slice, bit x + 8 * y.
+     */
+    struct Brick
+    {
+      std::array<std::uint64_t, BrickSize> bits{};
+
+      /**
+       * @brief Test a voxel given its coordinates within the brick
+       */
+      constexpr auto test(std::int32_t x, std::int32_t y, std::int32_t z) const noexcept -> bool
+      {
+        return (bits[z] >> (x + BrickSize * y)) & 1u;
+      }
+    };
+
+    /**
+     * @brief The brick containing the given voxel
+     */
+    static constexpr auto brickCoord(Vector3i const &voxel) noexcept -> Vector3i
+    {
+      return {voxel[0] >> BrickShift, voxel[1] >> BrickShift, voxel[2] >> BrickShift};
+    }
+
+    /**
+     * @brief Mark a voxel as occupied or empty
+     *
+     * @param voxel the voxel to change
+     * @param occupied the new state of the voxel
+     */
+    auto set(Vector3i const &voxel, bool const occupied = true) -> void
+    {
+      auto const k = key(brickCoord(voxel));
+      auto const word = voxel[2] & (BrickSize - 1);
+      auto const bit = std::uint64_t{1} << ((voxel[0] & (BrickSize - 1)) + BrickSize * (voxel[1] & (BrickSize - 1)));
+      if (occupied)
+      {
+        bricks[k].bits[word] |= bit;
+        return;
+      }
+
+      auto it = bricks.find(k);
+      if (it == bricks.end())
+      {
+        return;
+      }
+      it->second.bits[word] &= ~bit;
+      for (auto w : it->second.bits)
+      {
+        if (w != 0)
+        {
+          return;
+        }
+      }
+      bricks.erase(it);
+    }
+
+    /**
+     * @brief Test if the given voxel is occupied
+     */
+    auto test(Vector3i const &voxel) const -> bool
+    {
+      auto const *b = findBrick(brickCoord(voxel));
+      return b && b->test(voxel[0] & (BrickSize - 1), voxel[1] & (BrickSize - 1), voxel[2] & (BrickSize - 1));
+    }
+
+    /**
+     * @brief Find the brick with the given brick coordinates
+     *
+     * @return the brick or nullptr if the brick has no occupied voxels
+     */
+    auto findBrick(Vector3i const &brick) const -> Brick const *
+    {
+      auto it = bricks.find(key(brick));
+      return it == bricks.end() ? nullptr : &it->second;
+    }
+
+    /**
+     * @brief The number of bricks holding at least one occupied voxel
+     */
+    auto brickCount() const noexcept -> std::size_t
+    {
+      return bricks.size();
+    }
+
+    /**
+     * @brief Remove all voxels
+     */
+    auto clear() noexcept -> void
+    {
+      bricks.clear();
+    }
+
+  private:
+    static constexpr auto key(Vector3i const &brick) noexcept -> std::uint64_t
+    {
+      constexpr std::uint64_t Mask = (std::uint64_t{1} << 21) - 1;
+      return (static_cast<std::uint64_t>(brick[0]) & Mask) |
+             (static_cast<std::uint64_t>(brick[1]) & Mask) << 21 |
+             (static_cast<std::uint64_t>(brick[2]) & Mask) << 42;
+    }
+
+    struct KeyHash
+    {
+      auto operator()(std::uint64_t k) const noexcept -> std::size_t
+      {
+        k ^= k >> 33;
+        k *= 0xff51afd7ed558ccdull;
+        k ^= k >> 33;
+        return static_cast<std::size_t>(k);
+      }
+    };
+
+    std::unordered_map<std::uint64_t, Brick, KeyHash> bricks;
+  };
+
+  /**
+   * @brief A ray to cast through a VoxelGrid
+   *
+   * Distances are measured in multiples of direction, which does not need to
+   * be normalized.
+   */
+  struct VoxelRay
+  {
+    Vector3f origin;    ///< start of the ray
+    Vector3f direction; ///< direction of the ray
+    float maxDistance;  ///< the ray ends at origin + maxDistance * direction, must be finite
+  };
+
+  /**
+   * @brief The result of casting a VoxelRay
+   */
+  struct VoxelHit
+  {
+    bool hit;       ///< true if an occupied voxel was found
+    Vector3i voxel; ///< the first occupied voxel along the ray
+    float distance; ///< the distance at which the ray enters voxel
+  };
+
+  /// The number of rays traversed together by the packet version of castRays
+  constexpr std::size_t VoxelPacketSize = 8;
+
+  namespace detail
+  {
+    /**
+     * Looks up voxels along a ray, only hashing when the ray enters a new brick.
+     */
+    class BrickCache
+    {
+    public:
+      explicit BrickCache(VoxelGrid const &g) noexcept : grid{&g} {}
+
+      auto test(std::int32_t x, std::int32_t y, std::int32_t z) -> bool
+      {
+        constexpr auto Shift = VoxelGrid::BrickShift;
+        constexpr auto Mask = VoxelGrid::BrickSize - 1;
+        if (!valid || (x >> Shift) != bx || (y >> Shift) != by || (z >> Shift) != bz)
+        {
+          bx = x >> Shift;
+          by = y >> Shift;
+          bz = z >> Shift;
+          brick = grid->findBrick({bx, by, bz});
+          valid = true;
+        }
+        return brick && brick->test(x & Mask, y & Mask, z & Mask);
+      }
+
+    private:
+      VoxelGrid const *grid;
+      VoxelGrid::Brick const *brick = nullptr;
+      std::int32_t bx = 0;
+      std::int32_t by = 0;
+      std::int32_t bz = 0;
+      bool valid = false;
+    };
+
+    /**
+     * Amanatides-Woo setup for one axis of a ray.
+     */
+    inline auto setupAxis(float const origin, float const direction, std::int32_t &voxel,
+                          std::int32_t &step, float &tMax, float &tDelta) noexcept -> void
+    {
+      constexpr auto Inf = std::numeric_limits<float>::infinity();
+      auto const cell = std::floor(origin);
+      voxel = static_cast<std::int32_t>(cell);
+      if (direction > 0.0f)
+      {
+        step = 1;
+        tDelta = 1.0f / direction;
+        tMax = (cell + 1.0f - origin) * tDelta;
+      }
+      else if (direction < 0.0f)
+      {
+        step = -1;
+        tDelta = -1.0f / direction;
+        tMax = (origin - cell) * tDelta;
+      }
+      else
+      {
+        step = 0;
+        tDelta = Inf;
+        tMax = Inf;
+      }
+    }
+  } // namespace detail
+
+  /**
+   * Walk a ray through the grid one voxel at a time using the Amanatides-Woo
+   * algorithm and return the first occupied voxel.
+   *
+   * @param grid the grid to search
+   * @param ray the ray to cast
+   * @return the first occupied voxel within ray.maxDistance, if any
+   */
+  inline auto castRay(VoxelGrid const &grid, VoxelRay const &ray) -> VoxelHit
+  {
+    std::int32_t voxel[3];
+    std::int32_t step[3];
+    float tMax[3];
+    float tDelta[3];
+    for (std::size_t i = 0; i < 3; ++i)
+    {
+      detail::setupAxis(ray.origin[i], ray.direction[i], voxel[i], step[i], tMax[i], tDelta[i]);
+    }
+
+    detail::BrickCache cache{grid};
+    float t = 0.0f;
+    while (t <= ray.maxDistance)
+    {
+      if (cache.test(voxel[0], voxel[1], voxel[2]))
+      {
+        return {true, {voxel[0], voxel[1], voxel[2]}, t};
+      }
+      auto const axis = tMax[0] < tMax[1] ? (tMax[0] < tMax[2] ? 0 : 2) : (tMax[1] < tMax[2] ? 1 : 2);
+      t = tMax[axis];
+      voxel[axis] += step[axis];
+      tMax[axis] += tDelta[axis];
+    }
+    return {false, {voxel[0], voxel[1], voxel[2]}, ray.maxDistance};
+  }
+
+  /**
+   * Cast a packet of VoxelPacketSize rays.
+   *
+   * The rays are stepped in lockstep with their state held in structure of
+   * arrays form, so the step for all lanes compiles to a handful of SIMD
+   * compares and blends.  Coherent rays also share brick lookups in the cache.
+   *
+   * @param grid the grid to search
+   * @param rays the rays to cast
+   * @return the result for each ray
+   */
+  inline auto castRays(VoxelGrid const &grid, std::array<VoxelRay, VoxelPacketSize> const &rays)
+      -> std::array<VoxelHit, VoxelPacketSize>
+  {
+    constexpr auto Lanes = VoxelPacketSize;
+    std::array<std::int32_t, Lanes> vx, vy, vz, sx, sy, sz;
+    std::array<float, Lanes> mx, my, mz, dx, dy, dz, t{};
+    std::array<VoxelHit, Lanes> hits{};
+    std::array<bool, Lanes> active{};
+    for (std::size_t l = 0; l < Lanes; ++l)
+    {
+      detail::setupAxis(rays[l].origin[0], rays[l].direction[0], vx[l], sx[l], mx[l], dx[l]);
+      detail::setupAxis(rays[l].origin[1], rays[l].direction[1], vy[l], sy[l], my[l], dy[l]);
+      detail::setupAxis(rays[l].origin[2], rays[l].direction[2], vz[l], sz[l], mz[l], dz[l]);
+      active[l] = true;
+    }
+
+    detail::BrickCache cache{grid};
+    std::size_t remaining = Lanes;
+    while (remaining > 0)
+    {
+      for (std::size_t l = 0; l < Lanes; ++l)
+      {
+        if (!active[l])
+        {
+          continue;
+        }
+        if (t[l] > rays[l].maxDistance)
+        {
+          hits[l] = {false, {vx[l], vy[l], vz[l]}, rays[l].maxDistance};
+          active[l] = false;
+          --remaining;
+        }
+        else if (cache.test(vx[l], vy[l], vz[l]))
+        {
+          hits[l] = {true, {vx[l], vy[l], vz[l]}, t[l]};
+          active[l] = false;
+          --remaining;
+        }
+      }
+
+      // finished lanes keep stepping, their results are already recorded
+      for (std::size_t l = 0; l < Lanes; ++l)
+      {
+        bool const stepX = mx[l] < my[l] && mx[l] < mz[l];
+        bool const stepY = !stepX && my[l] < mz[l];
+        bool const stepZ = !stepX && !stepY;
+        t[l] = stepX ? mx[l] : (stepY ? my[l] : mz[l]);
+        vx[l] += stepX ? sx[l] : 0;
+        vy[l] += stepY ? sy[l] : 0;
+        vz[l] += stepZ ? sz[l] : 0;
+        mx[l] += stepX ? dx[l] : 0.0f;
+        my[l] += stepY ? dy[l] : 0.0f;
+        mz[l] += stepZ ? dz[l] : 0.0f;
+      }
+    }
+    return hits;
+  }
+
+  /**
+   * Cast count rays, writing the result of rays[i] to hits[i].
+   *
+   * Rays are split between threads and cast in packets of VoxelPacketSize,
+   * so neighbouring rays should be spatially coherent.  The grid must not be
+   * modified during the call.
+   *
+   * @param grid the grid to search
+   * @param rays the rays to cast
+   * @param hits receives the results
+   * @param count the number of rays
+   * @param threads the number of threads to use, 0 uses one per hardware thread
+   */
+  inline auto castRays(VoxelGrid const &grid, VoxelRay const *rays, VoxelHit *hits,
+                       std::size_t const count, unsigned int const threads = 0) -> void
+  {
+    detail::parallelFor(count, threads, VoxelPacketSize, [&](std::size_t begin, std::size_t end) {
+      std::array<VoxelRay, VoxelPacketSize> packet;
+      for (; begin + VoxelPacketSize <= end; begin += VoxelPacketSize)
+      {
+        std::copy(rays + begin, rays + begin + VoxelPacketSize, packet.begin());
+        auto const result = castRays(grid, packet);
+        std::copy(result.begin(), result.end(), hits + begin);
+      }
+      for (; begin < end; ++begin)
+      {
+        hits[begin] = castRay(grid, rays[begin]);
+      }
+    });
+  }
+
+} // namespace cagey::math
@@ -26,6 +26,15 @@
 //=============================================================================
 
 #pragma once
+
+#include <array>
+#include <cstddef>
+#include <type_traits>
+#include <utility>
+
+#include "cagey-math/Math.hh"
+#include "cagey-math/detail/vec_type.hh"
+
 namespace cagey::math::detail
 {
 
@@ -44,22 +53,111 @@ namespace cagey::math::detail
   namespace vector
   {
 
-    template <typename T, std::size_t N, std::size_t... I>
-    inline constexpr auto operatorUnaryMinus(const Vector<T, N> &v,
+    template <typename U>
+    struct IsVector : std::false_type
+    {
+    };
+
+    template <typename T, std::size_t N, typename S>
+    struct IsVector<Vector<T, N, S>> : std::true_type
+    {
+    };
+
+    /// Restricts scalar overloads so that vectors of another space do not match them
+    template <typename U>
+    using EnableIfScalar = std::enable_if_t<!IsVector<U>::value>;
+
+    /// The element type of a product, numbers keep their own type instead of
+    /// being promoted so that small integer vectors stay small
+    template <typename T, typename U>
+    using Product = std::conditional_t<std::is_arithmetic<T>::value && std::is_same<T, U>::value, T,
+                                       decltype(std::declval<T>() * std::declval<U>())>;
+
+    /// Restricts the mixed element overloads to element types that differ,
+    /// like a physical quantity and a number, leaving plain numbers to the
+    /// exact overloads
+    template <typename T, typename U>
+    using EnableIfMixed = std::enable_if_t<is_vec_type<U>::value && !std::is_same<T, U>::value &&
+                                           !(std::is_arithmetic<T>::value && std::is_arithmetic<U>::value)>;
+
+    /// Vectors with at least this many elements are processed in chunks
+    inline constexpr std::size_t ChunkThreshold = 8;
+
+    /// The number of elements in each chunk, sized to a 128 bit register of floats
+    inline constexpr std::size_t ChunkSize = 4;
+
+    template <typename Op, std::size_t... I>
+    inline constexpr auto unrolled(std::size_t const offset, Op &op,
+                                   std::index_sequence<I...>) noexcept -> void
+    {
+      (op(offset + I), ...);
+    }
+
+    /**
+     * Call op with each index in [0, N).
+     *
+     * Small vectors are fully unrolled.  Larger vectors are walked in unrolled
+     * chunks of ChunkSize elements so that each chunk maps onto a single SIMD
+     * operation without the code size of unrolling the whole vector.
+     */
+    template <std::size_t N, typename Op>
+    inline constexpr auto forEachIndex(Op &&op) noexcept -> void
+    {
+      if constexpr (N < ChunkThreshold)
+      {
+        unrolled(0, op, std::make_index_sequence<N>());
+      }
+      else
+      {
+        constexpr std::size_t Chunked = N - N % ChunkSize;
+        for (std::size_t i = 0; i < Chunked; i += ChunkSize)
+        {
+          unrolled(i, op, std::make_index_sequence<ChunkSize>());
+        }
+        unrolled(Chunked, op, std::make_index_sequence<N % ChunkSize>());
+      }
+    }
+
+    template <typename T, typename U, std::size_t N, typename S, std::size_t... I>
+    inline constexpr auto convert(Vector<U, N, S> const &v,
+                                  std::index_sequence<I...>) noexcept
+        -> std::array<T, N>
+    {
+      return {static_cast<T>(v[I])...};
+    }
+
+    template <typename T, std::size_t N, typename S, std::size_t... I>
+    inline constexpr auto operatorUnaryMinus(const Vector<T, N, S> &v,
                                              std::index_sequence<I...>) noexcept
-        -> Vector<decltype(-std::declval<T>()), N>
+        -> Vector<decltype(-std::declval<T>()), N, S>
     {
       return {-v[I]...};
     }
 
-    template <typename T, typename U, std::size_t N, std::size_t... I>
-    inline constexpr auto operatorDivision(U const &lhs, Vector<T, N> const &rhs,
+    template <typename T, typename U, std::size_t N, typename S, std::size_t... I>
+    inline constexpr auto operatorDivision(U const &lhs, Vector<T, N, S> const &rhs,
                                            std::index_sequence<I...>) noexcept
-        -> Vector<decltype(std::declval<T>() / std::declval<U>()), N>
+        -> Vector<decltype(std::declval<T>() / std::declval<U>()), N, S>
     {
       return {lhs / rhs[I]...};
     }
 
+    template <typename T, typename U, std::size_t N, typename S, std::size_t... I>
+    inline constexpr auto operatorMixedProduct(Vector<T, N, S> const &lhs, U const &rhs,
+                                               std::index_sequence<I...>) noexcept
+        -> Vector<decltype(std::declval<T>() * std::declval<U>()), N, S>
+    {
+      return {lhs[I] * rhs...};
+    }
+
+    template <typename T, typename U, std::size_t N, typename S, std::size_t... I>
+    inline constexpr auto operatorMixedQuotient(Vector<T, N, S> const &lhs, U const &rhs,
+                                                std::index_sequence<I...>) noexcept
+        -> Vector<decltype(std::declval<T>() / std::declval<U>()), N, S>
+    {
+      return {lhs[I] / rhs...};
+    }
+
   } //namespace vector
 
 } // namespace cagey::math::detail
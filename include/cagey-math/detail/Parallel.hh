@@ -0,0 +1,105 @@
+//=============================================================================
+//
+// cagey-math - C++-17 Vector Math Library
+// Copyright (c) 2020 Kyle Girard <theycallmecoach@gmail.com>
+//
+// The MIT License (MIT)
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+//=============================================================================
+
+#pragma once
+
+#include <algorithm>
+#include <cstddef>
+#include <thread>
+#include <vector>
+
+namespace cagey::math::detail
+{
+
+  /**
+   * The length of the ranges parallelFor splits [0, count) into.  Range i
+   * starts at i * chunk, so begin / chunk numbers the ranges in order.
+   *
+   * @param count the number of items
+   * @param threads the number of threads to use, 0 uses one per hardware thread
+   * @param grain range boundaries are multiples of grain
+   * @return the range length, at least count when a single range is used
+   */
+  inline auto parallelChunk(std::size_t const count, unsigned int threads, std::size_t const grain) -> std::size_t
+  {
+    if (threads == 0)
+    {
+      threads = std::max(1u, std::thread::hardware_concurrency());
+    }
+    auto const granules = (count + grain - 1) / grain;
+    auto const workers = std::min<std::size_t>(threads, granules);
+    if (workers <= 1)
+    {
+      return std::max<std::size_t>(count, 1);
+    }
+    return (granules + workers - 1) / workers * grain;
+  }
+
+  /**
+   * The number of ranges parallelFor splits [0, count) into, never less
+   * than one since fn is called even when count is zero.
+   */
+  inline auto parallelRanges(std::size_t const count, std::size_t const chunk) noexcept -> std::size_t
+  {
+    return std::max<std::size_t>((count + chunk - 1) / chunk, 1);
+  }
+
+  /**
+   * Split [0, count) into one contiguous range per thread and call
+   * fn(begin, end) for each range.  The calling thread handles the first
+   * range.
+   *
+   * @param count the number of items
+   * @param threads the number of threads to use, 0 uses one per hardware thread
+   * @param grain range boundaries are multiples of grain
+   * @param fn callable taking (std::size_t begin, std::size_t end)
+   */
+  template <typename Fn>
+  inline auto parallelFor(std::size_t const count, unsigned int const threads,
+                          std::size_t const grain, Fn const &fn) -> void
+  {
+    auto const chunk = parallelChunk(count, threads, grain);
+    if (chunk >= count)
+    {
+      fn(std::size_t{0}, count);
+      return;
+    }
+
+    std::vector<std::thread> pool;
+    pool.reserve(parallelRanges(count, chunk) - 1);
+    for (std::size_t begin = chunk; begin < count; begin += chunk)
+    {
+      pool.emplace_back([&fn, begin, end = std::min(begin + chunk, count)]() { fn(begin, end); });
+    }
+    fn(std::size_t{0}, chunk);
+    for (auto &&t : pool)
+    {
+      t.join();
+    }
+  }
+
+} // namespace cagey::math::detail
@@ -32,7 +32,10 @@
  * @brief N-Dimensional Vector class template
  */
 
+#include <array>
+#include <cassert>
 #include <cmath>
+#include <utility>
 
 #include "cagey-math/Math.hh"
 #include "cagey-math/detail/MetaUtil.hh"
@@ -49,44 +52,314 @@ namespace cagey::math
    * 
    * @tparam T the type of elements of this vector
    * @tparam N the number of elements of this vector
+   * @tparam Space a tag for the coordinate space of this vector, void when untagged
    */
-  template <typename T, std::size_t N>
+  template <typename T, std::size_t N, typename Space>
   class Vector
   {
   public:
     /// The number of elements in this Point
     const static std::size_t Size = N;
-    using Type = Vector<T, Size>;                                       ///< The vector type
+    using Type = Vector<T, Size, Space>;                                ///< The vector type
     using ElementType = T;                                              ///< The underlying value type
     using Reference = ElementType &;                                    ///< The vector element reference type
     using ConstReference = ElementType const &;                         ///< The vector element const reference type
     using Iterator = typename std::array<T, Size>::iterator;            ///< The vector element iterator type
     using ConstIterator = typename std::array<T, Size>::const_iterator; ///< The vector element const iterator type
 
+    //===========================================================================
+    // Static Member Functions
+    //===========================================================================
+
+    /**
+     * @brief Return a vector with all elements set to zero.
+     *
+     * @return N element zero vector.
+     */
+    static constexpr auto zero() noexcept -> Vector { return Vector{T(0)}; }
+
+    //==========================================================================
+    /// @name Implicit Constructors
+    //==========================================================================
+    ///@{
+
+    /**
+     * @brief Construct a vector, elements are initialized to zero.
+     */
+    constexpr Vector() noexcept = default;
+
+    /**
+     * @brief Construct a vector which is a copy of the given vector.
+     */
+    constexpr Vector(Vector const &v) noexcept = default;
+
+    /**
+     * @brief Default move constructor
+     */
+    constexpr Vector(Vector &&) noexcept = default;
+
+    ///@}
+    //==========================================================================
+    /// @name Explicit Constructors
+    //==========================================================================
+    ///@{
+
+    /**
+     * @brief Construct a vector with all elements set to the given value.
+     *
+     * @param v the initial value for all elements
+     */
+    template <typename Indices = std::make_index_sequence<Size>>
+    explicit constexpr Vector(T const v) noexcept : Vector(Indices(), v) {}
+
+    /**
+     * @brief Construct a vector using the given scalars, one per element.
+     *
+     * @tparam U the types of the given scalars
+     * @param v the elements
+     */
+    template <typename... U,
+              typename = std::enable_if_t<(sizeof...(U) == Size && Size > 1)>>
+    constexpr Vector(U const... v) noexcept : elements{static_cast<T>(v)...} {}
+
+    ///@}
+    //==========================================================================
+    /// @name Explicit Conversion Constructors
+    //==========================================================================
+    ///@{
+
+    /**
+     * @brief Create a vector using another vector for initial values with type conversion
+     *
+     * @tparam U The type of the passed vector elements
+     * @param v the source vector
+     */
+    template <typename U, typename Indices = std::make_index_sequence<Size>>
+    explicit constexpr Vector(Vector<U, Size, Space> const &v) noexcept
+        : elements(detail::vector::convert<T>(v, Indices())) {}
+
+    ///@}
+    //==========================================================================
+    /// @name Component Access
+    //==========================================================================
+    ///@{
+
+    /**
+     * @brief Index operator.  Only 0 to N - 1 are valid indexes.
+     *
+     * @param i index into elements
+     */
+    constexpr auto operator[](std::size_t i) noexcept -> Reference
+    {
+      assert(i < Size);
+      return elements[i];
+    }
+
+    /**
+     * @brief Index operator.  Only 0 to N - 1 are valid indexes.
+     *
+     * @param i index into elements
+     */
+    constexpr auto operator[](std::size_t i) const noexcept -> ConstReference
+    {
+      assert(i < Size);
+      return elements[i];
+    }
+
+    ///@}
+    //==========================================================================
+    /// @name Unary Operators
+    //==========================================================================
+    ///@{
+
+    /**
+     * @brief CopyAssignment operator
+     *
+     * @param v src vectror
+     */
+    constexpr auto operator=(Vector<T, Size, Space> const &v) noexcept -> Vector &
+    {
+      elements = v.elements;
+      return *this;
+    }
+
+    /**
+     * @brief Add and assign a vector componentwise
+     *
+     * Values of the given vector are converted using static_cast
+     *
+     * @tparam U type of the source vector
+     * @param v a vector
+     */
+    template <typename U>
+    constexpr auto operator+=(Vector<U, Size, Space> const &v) noexcept -> Vector &
+    {
+      detail::vector::forEachIndex<Size>([&](std::size_t i) { elements[i] += static_cast<T>(v.elements[i]); });
+      return *this;
+    }
+
+    /**
+     * @brief Add the given scalar to each component of this vector
+     *
+     * @param scalar the amount to add to each element of this vector
+     */
+    template <typename U, typename = detail::vector::EnableIfScalar<U>>
+    constexpr auto operator+=(U const &scalar) noexcept -> Vector &
+    {
+      detail::vector::forEachIndex<Size>([&](std::size_t i) { elements[i] += static_cast<T>(scalar); });
+      return *this;
+    }
+
+    /**
+     * @brief Subtract and assign a vector componentwise
+     *
+     * @param v the vector
+     */
+    template <typename U>
+    constexpr auto operator-=(Vector<U, Size, Space> const &v) noexcept -> Vector &
+    {
+      detail::vector::forEachIndex<Size>([&](std::size_t i) { elements[i] -= static_cast<T>(v.elements[i]); });
+      return *this;
+    }
+
+    /**
+     * @brief Subtract the given scalar from each component
+     *
+     * @param scalar the amount to subtract
+     */
+    template <typename U, typename = detail::vector::EnableIfScalar<U>>
+    constexpr auto operator-=(U const &scalar) noexcept -> Vector &
+    {
+      detail::vector::forEachIndex<Size>([&](std::size_t i) { elements[i] -= static_cast<T>(scalar); });
+      return *this;
+    }
+
+    /**
+     * @brief Multiply this vector by the given scalar
+     *
+     * @param scalar the amount to scale
+     */
+    template <typename U, typename = detail::vector::EnableIfScalar<U>>
+    constexpr auto operator*=(U const &scalar) noexcept -> Vector &
+    {
+      detail::vector::forEachIndex<Size>([&](std::size_t i) { elements[i] *= static_cast<T>(scalar); });
+      return *this;
+    }
+
+    /**
+     * @brief Multiply with the given vector componentwise
+     *
+     * @param v the vector to scale
+     */
+    template <typename U>
+    constexpr auto operator*=(Vector<U, Size, Space> const &v) noexcept -> Vector &
+    {
+      detail::vector::forEachIndex<Size>([&](std::size_t i) { elements[i] *= static_cast<T>(v.elements[i]); });
+      return *this;
+    }
+
+    /**
+     * @brief Divide each element with the given scalar
+     *
+     * @param scalar the amount to use in the division
+     */
+    template <typename U, typename = detail::vector::EnableIfScalar<U>>
+    constexpr auto operator/=(U const &scalar) noexcept -> Vector &
+    {
+      detail::vector::forEachIndex<Size>([&](std::size_t i) { elements[i] /= static_cast<T>(scalar); });
+      return *this;
+    }
+
+    /**
+     * @brief Divide each element with the given vector componentwise
+     *
+     * @param v the vector to divide with
+     */
+    template <typename U>
+    constexpr auto operator/=(Vector<U, Size, Space> const &v) noexcept -> Vector &
+    {
+      detail::vector::forEachIndex<Size>([&](std::size_t i) { elements[i] /= static_cast<T>(v.elements[i]); });
+      return *this;
+    }
+
+    /**
+     * @brief Increase each element of this vector
+     */
+    constexpr auto operator++() noexcept -> Vector &
+    {
+      detail::vector::forEachIndex<Size>([&](std::size_t i) { ++elements[i]; });
+      return *this;
+    }
+
+    /**
+     * @brief Decrease each element of this vector
+     */
+    constexpr auto operator--() noexcept -> Vector &
+    {
+      detail::vector::forEachIndex<Size>([&](std::size_t i) { --elements[i]; });
+      return *this;
+    }
+
+    /**
+     * @brief Increase each element of this vector, returning the previous value
+     */
+    constexpr auto operator++(int) noexcept -> Vector
+    {
+      Vector res{*this};
+      ++*this;
+      return res;
+    }
+
+    /**
+     * @brief Decrease each element of this vector, returning the previous value
+     */
+    constexpr auto operator--(int) noexcept -> Vector
+    {
+      Vector res{*this};
+      --*this;
+      return res;
+    }
+
+    ///@}
     //==========================================================================
     /// @name Iterators
     //==========================================================================
+    ///@{
 
+    /**
+     * @brief returns iterator to the beginning
+     */
     constexpr auto begin() noexcept -> typename Vector::Iterator
     {
       return elements.begin();
     }
 
+    /**
+     * @brief returns iterator to the beginning
+     */
     constexpr auto begin() const noexcept -> typename Vector::ConstIterator
     {
       return elements.begin();
     }
 
+    /**
+     * @brief returns iterator to the end
+     */
     constexpr auto end() noexcept -> typename Vector::Iterator
     {
       return elements.end();
     }
 
+    /**
+     * @brief returns iterator to the end
+     */
     constexpr auto end() const noexcept -> typename Vector::ConstIterator
     {
       return elements.end();
     }
 
+    ///@}
+
     /**
      * Anonymous union to allow access to members using different names
      */
@@ -95,13 +368,23 @@ namespace cagey::math
       std::enable_if_t<is_vec_type<T>::value, std::array<T, N>> elements; /// elements as an std::array
       T rawElements[N];                                                   /// elements as native array
     };
+
+  private:
+    /**
+     * Construct all elements using the value of 'v'
+     *
+     * @param v A value for all elements
+     */
+    template <std::size_t... I>
+    constexpr Vector(std::index_sequence<I...>, T const v) noexcept
+        : elements{detail::repeat(v, I)...} {}
   }; // Vector
 
   /**
    * Overload std::begin()
    */
-  template <typename T, std::size_t N>
-  inline constexpr auto begin(Vector<T, N> const &v) -> typename Vector<T, N>::ConstIterator
+  template <typename T, std::size_t N, typename S>
+  inline constexpr auto begin(Vector<T, N, S> const &v) -> typename Vector<T, N, S>::ConstIterator
   {
     return v.begin();
   }
@@ -109,8 +392,8 @@ namespace cagey::math
   /**
    * Overload std::begin()
    */
-  template <typename T, std::size_t N>
-  inline constexpr auto begin(Vector<T, N> &v) -> typename Vector<T, N>::Iterator
+  template <typename T, std::size_t N, typename S>
+  inline constexpr auto begin(Vector<T, N, S> &v) -> typename Vector<T, N, S>::Iterator
   {
     return v.begin();
   }
@@ -118,8 +401,8 @@ namespace cagey::math
   /**
    * Overload std::end()
    */
-  template <typename T, std::size_t N>
-  inline constexpr auto end(Vector<T, N> const &v) -> decltype(&v.rawElements[0])
+  template <typename T, std::size_t N, typename S>
+  inline constexpr auto end(Vector<T, N, S> const &v) -> decltype(&v.rawElements[0])
   {
     return v.end();
   }
@@ -127,8 +410,8 @@ namespace cagey::math
   /**
    * Overload std::end()
    */
-  template <typename T, std::size_t N>
-  inline constexpr auto end(Vector<T, N> &v) -> decltype(&v.rawElements[0])
+  template <typename T, std::size_t N, typename S>
+  inline constexpr auto end(Vector<T, N, S> &v) -> decltype(&v.rawElements[0])
   {
     return v.end();
   }
@@ -147,9 +430,9 @@ namespace cagey::math
    * @param rhs the right-hand operand
    * @return the component wise sum of lhs and rhs
    */
-  template <typename T, std::size_t N>
-  inline constexpr auto operator+(Vector<T, N> lhs,
-                                  Vector<T, N> const &rhs) noexcept
+  template <typename T, std::size_t N, typename S>
+  inline constexpr auto operator+(Vector<T, N, S> lhs,
+                                  Vector<T, N, S> const &rhs) noexcept
   {
     return lhs += rhs;
   }
@@ -164,9 +447,9 @@ namespace cagey::math
    * @param rhs the right-hand operand
    * @return the component wise difference of lhs and rhs
    */
-  template <typename T, std::size_t N>
-  inline constexpr auto operator-(Vector<T, N> lhs,
-                                  Vector<T, N> const &rhs) noexcept
+  template <typename T, std::size_t N, typename S>
+  inline constexpr auto operator-(Vector<T, N, S> lhs,
+                                  Vector<T, N, S> const &rhs) noexcept
   {
     return lhs -= rhs;
   }
@@ -181,9 +464,9 @@ namespace cagey::math
    * @param rhs the right-hand operand
    * @return the product of lhs and each component of rhs
    */
-  template <typename T, std::size_t N>
+  template <typename T, std::size_t N, typename S>
   inline constexpr auto operator*(T const lhs,
-                                  Vector<T, N> rhs) noexcept -> Vector<T, N>
+                                  Vector<T, N, S> rhs) noexcept -> Vector<T, N, S>
   {
     return rhs *= lhs;
   }
@@ -198,13 +481,47 @@ namespace cagey::math
    * @param rhs the right-hand operand
    * @return the product of lhs and each component of rhs
    */
-  template <typename T, std::size_t N>
-  inline constexpr auto operator*(Vector<T, N> lhs,
-                                  T const rhs) noexcept -> Vector<T, N>
+  template <typename T, std::size_t N, typename S>
+  inline constexpr auto operator*(Vector<T, N, S> lhs,
+                                  T const rhs) noexcept -> Vector<T, N, S>
   {
     return lhs *= rhs;
   }
 
+  /**
+   * Compute the component wise product of rhs and lhs.
+   *
+   * @tparam T The component type of the rhs and lhs
+   * @tparam N The number of components in rhs
+   *
+   * @param lhs the left-hand operand
+   * @param rhs the right-hand operand
+   * @return the component wise product of lhs and rhs
+   */
+  template <typename T, std::size_t N, typename S>
+  inline constexpr auto operator*(Vector<T, N, S> lhs,
+                                  Vector<T, N, S> const &rhs) noexcept -> Vector<T, N, S>
+  {
+    return lhs *= rhs;
+  }
+
+  /**
+   * Compute the component wise quotients of rhs and lhs.
+   *
+   * @tparam T The component type of the rhs and lhs
+   * @tparam N The number of components in rhs
+   *
+   * @param lhs the left-hand operand
+   * @param rhs the right-hand operand
+   * @return the component wise quotients of lhs and rhs
+   */
+  template <typename T, std::size_t N, typename S>
+  inline constexpr auto operator/(Vector<T, N, S> lhs,
+                                  Vector<T, N, S> const &rhs) noexcept -> Vector<T, N, S>
+  {
+    return lhs /= rhs;
+  }
+
   /**
    * Compute the component wise quotients of rhs and lhs.
    *
@@ -215,10 +532,10 @@ namespace cagey::math
    * @param rhs the right-hand operand
    * @return the quotients of lhs and each component of rhs
    */
-  template <typename T, std::size_t N,
+  template <typename T, std::size_t N, typename S,
             typename Indices = std::make_index_sequence<N>>
   inline constexpr auto operator/(
-      T const lhs, Vector<T, N> const &rhs) noexcept -> Vector<T, N>
+      T const lhs, Vector<T, N, S> const &rhs) noexcept -> Vector<T, N, S>
   {
     return detail::vector::operatorDivision(lhs, rhs, Indices());
   }
@@ -233,13 +550,73 @@ namespace cagey::math
    * @param rhs the right-hand operand
    * @return the quotients of lhs and each component of rhs
    */
-  template <typename T, std::size_t N>
-  inline constexpr auto operator/(Vector<T, N> lhs,
-                                  T const rhs) noexcept -> Vector<T, N>
+  template <typename T, std::size_t N, typename S>
+  inline constexpr auto operator/(Vector<T, N, S> lhs,
+                                  T const rhs) noexcept -> Vector<T, N, S>
   {
     return lhs /= rhs;
   }
 
+  /**
+   * Compute the product of each component of lhs and a scalar of another
+   * element type, like a vector of velocities and a time.
+   *
+   * @tparam T The component type of the lhs
+   * @tparam N The number of components of the lhs
+   * @tparam U The type of the rhs
+   *
+   * @param lhs the left-hand operand
+   * @param rhs the right-hand operand
+   * @return a vector of the products, of the element type of T * U
+   */
+  template <typename T, std::size_t N, typename S, typename U,
+            typename = detail::vector::EnableIfMixed<T, U>>
+  inline constexpr auto operator*(Vector<T, N, S> const &lhs, U const &rhs) noexcept
+      -> Vector<decltype(std::declval<T>() * std::declval<U>()), N, S>
+  {
+    return detail::vector::operatorMixedProduct(lhs, rhs, std::make_index_sequence<N>());
+  }
+
+  /**
+   * Compute the product of a scalar of another element type and each
+   * component of rhs.
+   *
+   * @tparam U The type of the lhs
+   * @tparam T The component type of the rhs
+   * @tparam N The number of components of the rhs
+   *
+   * @param lhs the left-hand operand
+   * @param rhs the right-hand operand
+   * @return a vector of the products, of the element type of T * U
+   */
+  template <typename U, typename T, std::size_t N, typename S,
+            typename = detail::vector::EnableIfMixed<T, U>>
+  inline constexpr auto operator*(U const &lhs, Vector<T, N, S> const &rhs) noexcept
+      -> Vector<decltype(std::declval<T>() * std::declval<U>()), N, S>
+  {
+    return detail::vector::operatorMixedProduct(rhs, lhs, std::make_index_sequence<N>());
+  }
+
+  /**
+   * Compute the quotient of each component of lhs and a scalar of another
+   * element type, like a vector of lengths and a time.
+   *
+   * @tparam T The component type of the lhs
+   * @tparam N The number of components of the lhs
+   * @tparam U The type of the rhs
+   *
+   * @param lhs the left-hand operand
+   * @param rhs the right-hand operand
+   * @return a vector of the quotients, of the element type of T / U
+   */
+  template <typename T, std::size_t N, typename S, typename U,
+            typename = detail::vector::EnableIfMixed<T, U>>
+  inline constexpr auto operator/(Vector<T, N, S> const &lhs, U const &rhs) noexcept
+      -> Vector<decltype(std::declval<T>() / std::declval<U>()), N, S>
+  {
+    return detail::vector::operatorMixedQuotient(lhs, rhs, std::make_index_sequence<N>());
+  }
+
   /**
    * Determines if two Vectors are equal.
    *
@@ -250,9 +627,9 @@ namespace cagey::math
    * @param rhs the right-hand operand
    * @return true if lhs and rhs are equal
    */
-  template <typename T, std::size_t N>
-  inline auto operator==(Vector<T, N> const &lhs,
-                         Vector<T, N> const &rhs) noexcept -> bool
+  template <typename T, std::size_t N, typename S>
+  inline auto operator==(Vector<T, N, S> const &lhs,
+                         Vector<T, N, S> const &rhs) noexcept -> bool
   {
     using std::begin;
     using std::end;
@@ -269,9 +646,9 @@ namespace cagey::math
    * @param rhs the right-hand operand
    * @return true if lhs and rhs are not equal
    */
-  template <typename T, std::size_t N>
-  inline constexpr auto operator!=(Vector<T, N> const &lhs,
-                                   Vector<T, N> const &rhs) noexcept -> bool
+  template <typename T, std::size_t N, typename S>
+  inline constexpr auto operator!=(Vector<T, N, S> const &lhs,
+                                   Vector<T, N, S> const &rhs) noexcept -> bool
   {
     return !(lhs == rhs);
   }
@@ -291,10 +668,10 @@ namespace cagey::math
    * @param v A Vector.
    * @return The negation of each component of v
    */
-  template <typename T, std::size_t N,
+  template <typename T, std::size_t N, typename S,
             typename Indices = std::make_index_sequence<N>>
   inline constexpr auto operator-(
-      Vector<T, N> const &v) noexcept -> Vector<T, N>
+      Vector<T, N, S> const &v) noexcept -> Vector<T, N, S>
   {
     return detail::vector::operatorUnaryMinus(v, Indices());
   }
@@ -0,0 +1,70 @@
+//=============================================================================
+//
+// cagey-math - C++-17 Vector Math Library
+// Copyright (c) 2020 Kyle Girard <theycallmecoach@gmail.com>
+//
+// The MIT License (MIT)
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+//=============================================================================
+
+/**
+ * @file
+ * @brief The cagey.math named module
+ *
+ * Exports everything declared by the Vector, Matrix, VectorFunc, MatrixFunc
+ * and Constants headers so that importers pay for parsing them once.  Built
+ * when the modules meson option is enabled.
+ *
+ * The headers are included inside an export block rather than re-exported
+ * with using-declarations from the global module fragment, which GCC 12
+ * does not support.  The entities are therefore attached to this module, and
+ * a translation unit must either import cagey.math or include these headers,
+ * never both.  For the same reason the module is built without
+ * CAGEY_MATH_EXTERN_TEMPLATES.
+ */
+
+module;
+
+// every standard header the wrapped headers use, so that their own includes
+// are no-ops inside the module purview
+#include <algorithm>
+#include <array>
+#include <cassert>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <iterator>
+#include <limits>
+#include <type_traits>
+#include <utility>
+
+export module cagey.math;
+
+export
+{
+#include "cagey-math/Constants.hh"
+#include "cagey-math/MatrixFunc.hh"
+#include "cagey-math/Vector2.hh"
+#include "cagey-math/Vector3.hh"
+#include "cagey-math/Vector4.hh"
+#include "cagey-math/VectorFunc.hh"
+}
@@ -0,0 +1,82 @@
+//=============================================================================
+//
+// cagey-math - C++-17 Vector Math Library
+// Copyright (c) 2020 Kyle Girard <theycallmecoach@gmail.com>
+//
+// The MIT License (MIT)
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+//=============================================================================
+
+/**
+ * @file
+ * @brief Explicit instantiations of the common aliases from Math.hh
+ *
+ * Translation units built with CAGEY_MATH_EXTERN_TEMPLATES see matching
+ * extern template declarations and link against these instead of
+ * instantiating them again.
+ */
+
+#include "cagey-math/MatrixFunc.hh"
+#include "cagey-math/Vector2.hh"
+#include "cagey-math/Vector3.hh"
+#include "cagey-math/Vector4.hh"
+#include "cagey-math/VectorFunc.hh"
+
+namespace cagey::math
+{
+  template class Vector<float, 2>;
+  template class Vector<float, 3>;
+  template class Vector<float, 4>;
+  template class Vector<std::int32_t, 2>;
+  template class Vector<std::int32_t, 3>;
+  template class Vector<std::int32_t, 4>;
+
+  template class Matrix<float, 2, 2>;
+  template class Matrix<double, 2, 2>;
+  template class Matrix<float, 3, 3>;
+  template class Matrix<double, 3, 3>;
+  template class Matrix<float, 4, 4>;
+  template class Matrix<double, 4, 4>;
+
+  template auto fuzzyEquals(Vector<float, 2> const &, Vector<float, 2> const &, float) -> bool;
+  template auto fuzzyEquals(Vector<float, 3> const &, Vector<float, 3> const &, float) -> bool;
+  template auto fuzzyEquals(Vector<float, 4> const &, Vector<float, 4> const &, float) -> bool;
+
+  template auto determinant(Matrix<float, 2, 2> const &) -> float;
+  template auto transpose(Matrix<float, 2, 2> const &) -> Matrix<float, 2, 2>;
+  template auto inverse(Matrix<float, 2, 2> const &) -> Matrix<float, 2, 2>;
+  template auto determinant(Matrix<float, 3, 3> const &) -> float;
+  template auto transpose(Matrix<float, 3, 3> const &) -> Matrix<float, 3, 3>;
+  template auto inverse(Matrix<float, 3, 3> const &) -> Matrix<float, 3, 3>;
+  template auto determinant(Matrix<float, 4, 4> const &) -> float;
+  template auto transpose(Matrix<float, 4, 4> const &) -> Matrix<float, 4, 4>;
+  template auto inverse(Matrix<float, 4, 4> const &) -> Matrix<float, 4, 4>;
+  template auto determinant(Matrix<double, 2, 2> const &) -> double;
+  template auto transpose(Matrix<double, 2, 2> const &) -> Matrix<double, 2, 2>;
+  template auto inverse(Matrix<double, 2, 2> const &) -> Matrix<double, 2, 2>;
+  template auto determinant(Matrix<double, 3, 3> const &) -> double;
+  template auto transpose(Matrix<double, 3, 3> const &) -> Matrix<double, 3, 3>;
+  template auto inverse(Matrix<double, 3, 3> const &) -> Matrix<double, 3, 3>;
+  template auto determinant(Matrix<double, 4, 4> const &) -> double;
+  template auto transpose(Matrix<double, 4, 4> const &) -> Matrix<double, 4, 4>;
+  template auto inverse(Matrix<double, 4, 4> const &) -> Matrix<double, 4, 4>;
+
+} // namespace cagey::math
@@ -0,0 +1,156 @@
+#include "gtest/gtest.h"
+#include <cagey-math/CommonFunc.hh>
+#include <cagey-math/Vector2.hh>
+#include <cagey-math/Vector4.hh>
+#include <cmath>
+#include <limits>
+#include <vector>
+
+using namespace cagey::math;
+
+static_assert(floor(-1.5f) == -2.0f && ceil(-1.5f) == -1.0f, "scalar functions are constexpr");
+static_assert(fract(2.25) == 0.25 && mod(-1, 3) == 2 && mod(-7.0, 4.0) == 1.0, "mod rounds the quotient down");
+static_assert(smoothstep(0.0f, 1.0f, 0.5f) == 0.5f && step(1, 0) == 0, "smoothstep and step");
+
+TEST(CommonFuncTest, ScalarTest)
+{
+  float const inf = std::numeric_limits<float>::infinity();
+  for (float x : {-2.5f, -1.0f, -0.75f, -0.0f, 0.0f, 0.25f, 1.0f, 3.5f, 16777215.0f, -8388609.5f, 1e30f, inf, -inf})
+  {
+    ASSERT_EQ(floor(x), std::floor(x)) << x;
+    ASSERT_EQ(ceil(x), std::ceil(x)) << x;
+    ASSERT_EQ(std::signbit(floor(x)), std::signbit(std::floor(x))) << x;
+    ASSERT_EQ(std::signbit(ceil(x)), std::signbit(std::ceil(x))) << x;
+  }
+  ASSERT_TRUE(std::isnan(floor(std::numeric_limits<float>::quiet_NaN())));
+  ASSERT_EQ(abs(-3), 3);
+  ASSERT_FALSE(std::signbit(abs(-0.0)));
+  ASSERT_EQ(sign(-4.0), -1.0);
+  ASSERT_EQ(sign(0.0f), 0.0f);
+  ASSERT_EQ(mod(7, -3), -2);
+  ASSERT_EQ(clamp(5, 0, 3), 3);
+  ASSERT_EQ(mix(2.0, 6.0, 1.0), 6.0);
+  ASSERT_EQ(mix(2.0, 6.0, 0.25), 3.0);
+}
+
+TEST(CommonFuncTest, VectorTest)
+{
+  constexpr Vector3f v{-1.25f, 0.5f, 2.75f};
+  constexpr auto f = floor(v);
+  static_assert(f[0] == -2.0f && f[1] == 0.0f && f[2] == 2.0f);
+  ASSERT_EQ(ceil(v), (Vector3f{-1.0f, 1.0f, 3.0f}));
+  ASSERT_EQ(fract(v), (Vector3f{0.75f, 0.5f, 0.75f}));
+  ASSERT_EQ(abs(v), (Vector3f{1.25f, 0.5f, 2.75f}));
+  ASSERT_EQ(sign(v), (Vector3f{-1.0f, 1.0f, 1.0f}));
+  ASSERT_EQ(mod(v, 2.0f), (Vector3f{0.75f, 0.5f, 0.75f}));
+  ASSERT_EQ(mod(Vector3i{-5, 5, 6}, Vector3i{3, 3, -4}), (Vector3i{1, 2, -2}));
+  ASSERT_EQ(clamp(v, 0.0f, 1.0f), (Vector3f{0.0f, 0.5f, 1.0f}));
+  ASSERT_EQ(clamp(v, Vector3f{-1.0f, 1.0f, 0.0f}, Vector3f{0.0f, 2.0f, 2.0f}), (Vector3f{-1.0f, 1.0f, 2.0f}));
+  ASSERT_EQ(min(v, 0.0f), (Vector3f{-1.25f, 0.0f, 0.0f}));
+  ASSERT_EQ(max(v, 0.0f), (Vector3f{0.0f, 0.5f, 2.75f}));
+  ASSERT_EQ(mix(Vector2d{0.0, 10.0}, Vector2d{4.0, 20.0}, 0.5), (Vector2d{2.0, 15.0}));
+  ASSERT_EQ(mix(Vector2d{0.0, 10.0}, Vector2d{4.0, 20.0}, Vector2d{0.0, 1.0}), (Vector2d{0.0, 20.0}));
+  ASSERT_EQ(step(0.5f, v), (Vector3f{0.0f, 1.0f, 1.0f}));
+  ASSERT_EQ(step(Vector3f{-2.0f, 1.0f, 3.0f}, v), (Vector3f{1.0f, 0.0f, 0.0f}));
+  ASSERT_EQ(smoothstep(0.0f, 1.0f, v), (Vector3f{0.0f, 0.5f, 1.0f}));
+  ASSERT_EQ(smoothstep(Vector4f(0.0f), Vector4f(2.0f), Vector4f{-1.0f, 0.5f, 1.0f, 3.0f}),
+            (Vector4f{0.0f, 0.15625f, 0.5f, 1.0f}));
+}
+
+namespace
+{
+  // Every batch function must agree bit for bit with the single vector one
+  template <typename T, std::size_t N>
+  auto checkBatch() -> void
+  {
+    constexpr std::size_t count = 37;
+    std::vector<Vector<T, N>> a(count);
+    std::vector<Vector<T, N>> b(count);
+    std::vector<Vector<T, N>> c(count);
+    std::vector<Vector<T, N>> out(count);
+    for (std::size_t v = 0; v < count; ++v)
+    {
+      for (std::size_t i = 0; i < N; ++i)
+      {
+        auto const k = double(v * N + i);
+        a[v][i] = T(std::sin(k) * 9.0);
+        b[v][i] = T(std::cos(k * 0.7) * 5.0 + (std::cos(k * 0.7) < 0 ? -1.0 : 1.0));
+        c[v][i] = T(std::fabs(std::sin(k * 1.3)));
+      }
+    }
+    auto check = [&](auto const &expected) {
+      for (std::size_t v = 0; v < count; ++v)
+      {
+        ASSERT_EQ(out[v], expected(v)) << v;
+      }
+    };
+    batch::abs(a.data(), out.data(), count);
+    check([&](std::size_t v) { return abs(a[v]); });
+    batch::sign(a.data(), out.data(), count);
+    check([&](std::size_t v) { return sign(a[v]); });
+    batch::floor(a.data(), out.data(), count);
+    check([&](std::size_t v) { return floor(a[v]); });
+    batch::ceil(a.data(), out.data(), count);
+    check([&](std::size_t v) { return ceil(a[v]); });
+    batch::fract(a.data(), out.data(), count);
+    check([&](std::size_t v) { return fract(a[v]); });
+    batch::mod(a.data(), b.data(), out.data(), count);
+    check([&](std::size_t v) { return mod(a[v], b[v]); });
+    batch::mod(a.data(), T(3), out.data(), count);
+    check([&](std::size_t v) { return mod(a[v], T(3)); });
+    batch::min(a.data(), b.data(), out.data(), count);
+    check([&](std::size_t v) { return min(a[v], b[v]); });
+    batch::max(a.data(), b.data(), out.data(), count);
+    check([&](std::size_t v) { return max(a[v], b[v]); });
+    batch::clamp(a.data(), T(-2), T(4), out.data(), count);
+    check([&](std::size_t v) { return clamp(a[v], T(-2), T(4)); });
+    batch::clamp(a.data(), b.data(), c.data(), out.data(), count);
+    check([&](std::size_t v) { return clamp(a[v], b[v], c[v]); });
+    batch::mix(a.data(), b.data(), c.data(), out.data(), count);
+    check([&](std::size_t v) { return mix(a[v], b[v], c[v]); });
+    batch::mix(a.data(), b.data(), T(0.25), out.data(), count);
+    check([&](std::size_t v) { return mix(a[v], b[v], T(0.25)); });
+    batch::step(a.data(), b.data(), out.data(), count);
+    check([&](std::size_t v) { return step(a[v], b[v]); });
+    batch::step(T(0), a.data(), out.data(), count);
+    check([&](std::size_t v) { return step(T(0), a[v]); });
+    batch::smoothstep(T(-3), T(3), a.data(), out.data(), count);
+    check([&](std::size_t v) { return smoothstep(T(-3), T(3), a[v]); });
+    batch::smoothstep(b.data(), c.data(), a.data(), out.data(), count);
+    check([&](std::size_t v) { return smoothstep(b[v], c[v], a[v]); });
+  }
+} // namespace
+
+TEST(CommonFuncTest, BatchTest)
+{
+  checkBatch<float, 4>();
+  checkBatch<float, 3>();
+  checkBatch<double, 2>();
+}
+
+TEST(CommonFuncTest, BatchIntegerTest)
+{
+  std::vector<Vector3i> const x{{-5, 5, 0}, {7, -7, 3}};
+  std::vector<Vector3i> out(2);
+  batch::mod(x.data(), 3, out.data(), 2);
+  ASSERT_EQ(out[0], (Vector3i{1, 2, 0}));
+  ASSERT_EQ(out[1], (Vector3i{1, 2, 0}));
+  batch::abs(x.data(), out.data(), 2);
+  ASSERT_EQ(out[1], (Vector3i{7, 7, 3}));
+  batch::clamp(x.data(), -1, 4, out.data(), 2);
+  ASSERT_EQ(out[0], (Vector3i{-1, 4, 0}));
+}
+
+TEST(CommonFuncTest, BatchTaggedTest)
+{
+  struct World;
+  using WorldVector = Vector<float, 2, World>;
+  std::vector<WorldVector> const x{{-1.5f, 0.25f}, {2.75f, -3.0f}};
+  std::vector<WorldVector> out(2);
+  batch::floor(x.data(), out.data(), 2);
+  ASSERT_EQ(out[0], (WorldVector{-2.0f, 0.0f}));
+  batch::clamp(x.data(), -1.0f, 1.0f, out.data(), 2);
+  ASSERT_EQ(out[1], (WorldVector{1.0f, -1.0f}));
+  batch::smoothstep(0.0f, 1.0f, x.data(), out.data(), 2);
+  ASSERT_EQ(out[0], (WorldVector{0.0f, smoothstep(0.0f, 1.0f, 0.25f)}));
+}
@@ -0,0 +1,113 @@
+#include "gtest/gtest.h"
+#include <cagey-math/ConvexHull.hh>
+#include <random>
+#include <vector>
+
+using namespace cagey::math;
+
+namespace
+{
+  auto randomPoints2(std::size_t count) -> std::vector<Vector2d>
+  {
+    std::mt19937 gen{7};
+    std::uniform_real_distribution<double> dist{-1.0, 1.0};
+    std::vector<Vector2d> points(count);
+    for (auto &p : points)
+    {
+      p = {dist(gen), dist(gen)};
+    }
+    return points;
+  }
+
+  auto randomPoints3(std::size_t count) -> std::vector<Vector3d>
+  {
+    std::mt19937 gen{11};
+    std::normal_distribution<double> dist{0.0, 1.0};
+    std::vector<Vector3d> points(count);
+    for (auto &p : points)
+    {
+      p = {dist(gen), dist(gen), dist(gen)};
+    }
+    return points;
+  }
+
+  auto checkHull(std::vector<Vector2d> const &points, std::vector<Vector2d> const &hull) -> void
+  {
+    ASSERT_GE(hull.size(), 3u);
+    for (std::size_t i = 0; i < hull.size(); ++i)
+    {
+      auto const &a = hull[i];
+      auto const edge = hull[(i + 1) % hull.size()] - a;
+      ASSERT_GT(cross(edge, hull[(i + 2) % hull.size()] - a), 0.0);
+      for (auto const &p : points)
+      {
+        ASSERT_GE(cross(edge, p - a), -1e-12);
+      }
+    }
+  }
+
+  auto checkHull(std::vector<Vector3d> const &points, ConvexHull<double> const &hull) -> void
+  {
+    // closed triangle mesh of genus 0
+    ASSERT_EQ(hull.faces.size(), 2 * hull.vertices.size() - 4);
+    for (auto const &f : hull.faces)
+    {
+      auto const &a = hull.vertices[f[0]];
+      auto const n = cross(hull.vertices[f[1]] - a, hull.vertices[f[2]] - a);
+      for (auto const &p : points)
+      {
+        ASSERT_LE(dot(n, p - a), 1e-9);
+      }
+    }
+  }
+} // namespace
+
+TEST(ConvexHullTest, Square2Test)
+{
+  std::vector<Vector2d> points{{0.0, 0.0}, {0.5, 0.0}, {1.0, 0.0}, {1.0, 1.0}, {0.5, 0.5},
+                               {0.0, 1.0}, {0.0, 0.5}, {1.0, 1.0}, {0.2, 0.7}};
+  auto const hull = convexHull(points.data(), points.size());
+  ASSERT_EQ(hull, (std::vector<Vector2d>{{0.0, 0.0}, {1.0, 0.0}, {1.0, 1.0}, {0.0, 1.0}}));
+
+  std::vector<Vector2d> const line{{0.0, 0.0}, {1.0, 1.0}, {2.0, 2.0}};
+  ASSERT_EQ(convexHull(line.data(), line.size()).size(), 2u);
+  ASSERT_TRUE(convexHull(line.data(), 0).empty());
+}
+
+TEST(ConvexHullTest, Random2Test)
+{
+  auto const points = randomPoints2(100000);
+  auto const hull = convexHull(points.data(), points.size());
+  checkHull(points, hull);
+  ASSERT_EQ(convexHull(points.data(), points.size(), 4), hull);
+}
+
+TEST(ConvexHullTest, Cube3Test)
+{
+  std::vector<Vector3d> points;
+  for (int i = 0; i < 8; ++i)
+  {
+    points.push_back({double(i & 1), double((i >> 1) & 1), double((i >> 2) & 1)});
+  }
+  points.push_back({0.5, 0.5, 0.5});
+  points.push_back({0.5, 0.5, 0.0});
+  points.push_back({0.2, 0.9, 0.4});
+  auto const hull = convexHull(points.data(), points.size());
+  ASSERT_EQ(hull.vertices.size(), 8u);
+  ASSERT_EQ(hull.faces.size(), 12u);
+  checkHull(points, hull);
+
+  std::vector<Vector3d> const flat{{0.0, 0.0, 0.0}, {1.0, 0.0, 0.0}, {0.0, 1.0, 0.0}, {1.0, 1.0, 0.0}};
+  ASSERT_TRUE(convexHull(flat.data(), flat.size()).faces.empty());
+}
+
+TEST(ConvexHullTest, Random3Test)
+{
+  auto const points = randomPoints3(100000);
+  auto const hull = convexHull(points.data(), points.size());
+  checkHull(points, hull);
+
+  auto const parallel = convexHull(points.data(), points.size(), 4);
+  checkHull(points, parallel);
+  ASSERT_EQ(parallel.vertices.size(), hull.vertices.size());
+}
@@ -0,0 +1,110 @@
+#include "gtest/gtest.h"
+#include <cagey-math/ConvexHull.hh>
+#include <cagey-math/Delaunay.hh>
+#include <random>
+#include <vector>
+
+using namespace cagey::math;
+
+namespace
+{
+  auto checkTriangulation(std::vector<Vector2d> const &points, Triangulation const &mesh) -> void
+  {
+    ASSERT_EQ(mesh.triangles.size() % 3, 0u);
+    ASSERT_EQ(mesh.halfedges.size(), mesh.triangles.size());
+    for (std::uint32_t e = 0; e < mesh.triangles.size(); ++e)
+    {
+      if (e % 3 == 0)
+      {
+        ASSERT_GT(orient2d(points[mesh.triangles[e]], points[mesh.triangles[e + 1]], points[mesh.triangles[e + 2]]),
+                  0.0);
+      }
+      auto const twin = mesh.halfedges[e];
+      if (twin == Triangulation::NoEdge)
+      {
+        continue;
+      }
+      ASSERT_EQ(mesh.halfedges[twin], e);
+      ASSERT_EQ(mesh.triangles[twin], mesh.triangles[Triangulation::next(e)]);
+      ASSERT_EQ(mesh.triangles[Triangulation::next(twin)], mesh.triangles[e]);
+      // the vertex opposite the shared edge is not inside the circumcircle
+      auto const opposite = mesh.triangles[Triangulation::prev(twin)];
+      ASSERT_LE(inCircle(points[mesh.triangles[e]], points[mesh.triangles[Triangulation::next(e)]],
+                         points[mesh.triangles[Triangulation::prev(e)]], points[opposite]),
+                0.0);
+    }
+  }
+
+  auto area(std::vector<Vector2d> const &points, Triangulation const &mesh) -> double
+  {
+    auto sum = 0.0;
+    for (std::size_t e = 0; e < mesh.triangles.size(); e += 3)
+    {
+      auto const &a = points[mesh.triangles[e]];
+      sum += cross(points[mesh.triangles[e + 1]] - a, points[mesh.triangles[e + 2]] - a) / 2.0;
+    }
+    return sum;
+  }
+} // namespace
+
+TEST(DelaunayTest, SquareTest)
+{
+  std::vector<Vector2d> const points{{0.0, 0.0}, {1.0, 0.0}, {1.0, 1.0}, {0.0, 1.0}, {0.5, 0.5}};
+  auto const mesh = delaunay(points.data(), points.size());
+  ASSERT_EQ(mesh.triangles.size(), 12u);
+  checkTriangulation(points, mesh);
+  ASSERT_DOUBLE_EQ(area(points, mesh), 1.0);
+}
+
+TEST(DelaunayTest, DegenerateTest)
+{
+  std::vector<Vector2d> const line{{0.0, 0.0}, {1.0, 1.0}, {2.0, 2.0}, {1.0, 1.0}};
+  ASSERT_TRUE(delaunay(line.data(), line.size()).triangles.empty());
+  ASSERT_TRUE(delaunay(line.data(), 2).triangles.empty());
+
+  // collinear points inserted before and after the first triangle, and duplicates
+  std::vector<Vector2d> const points{{0.0, 0.0}, {1.0, 0.0}, {2.0, 0.0}, {3.0, 0.0}, {1.0, 0.0},
+                                     {1.5, 1.0}, {-1.0, 0.0}, {4.0, 0.0}, {1.5, 1.0}};
+  auto const mesh = delaunay(points.data(), points.size());
+  checkTriangulation(points, mesh);
+  ASSERT_EQ(mesh.triangles.size(), 3u * 5u);
+  ASSERT_DOUBLE_EQ(area(points, mesh), 2.5);
+}
+
+TEST(DelaunayTest, GridTest)
+{
+  // cocircular and collinear everywhere
+  std::vector<Vector2d> points;
+  for (int y = 0; y < 20; ++y)
+  {
+    for (int x = 0; x < 30; ++x)
+    {
+      points.push_back({x * 0.1, y * 0.3});
+    }
+  }
+  auto const mesh = delaunay(points.data(), points.size());
+  checkTriangulation(points, mesh);
+  ASSERT_EQ(mesh.triangles.size(), 3u * 2u * 29u * 19u);
+  ASSERT_NEAR(area(points, mesh), 2.9 * 5.7, 1e-9);
+}
+
+TEST(DelaunayTest, RandomTest)
+{
+  std::mt19937 gen{17};
+  std::uniform_real_distribution<double> dist{-10.0, 10.0};
+  std::vector<Vector2d> points(20000);
+  for (auto &p : points)
+  {
+    p = {dist(gen), dist(gen)};
+  }
+  auto const mesh = delaunay(points.data(), points.size());
+  checkTriangulation(points, mesh);
+
+  // Euler: 2n - 2 - h triangles for points in general position
+  auto const hull = convexHull(points.data(), points.size());
+  ASSERT_EQ(mesh.triangles.size() / 3, 2 * points.size() - 2 - hull.size());
+
+  auto const parallel = delaunay(points.data(), points.size(), 4);
+  ASSERT_EQ(parallel.triangles, mesh.triangles);
+  ASSERT_EQ(parallel.halfedges, mesh.halfedges);
+}
@@ -0,0 +1,133 @@
+#include "gtest/gtest.h"
+#include <cagey-math/DoubleDouble.hh>
+#include <cagey-math/Matrix33.hh>
+#include <cagey-math/MatrixFunc.hh>
+#include <cagey-math/Vector3.hh>
+#include <cagey-math/VectorFunc.hh>
+#include <cmath>
+#include <type_traits>
+#include <vector>
+
+using namespace cagey::math;
+
+namespace
+{
+  static_assert(std::is_trivial<DoubleDouble>::value, "DoubleDouble is trivial");
+  static_assert(sizeof(Vector<DoubleDouble, 3>) == sizeof(double[6]), "DoubleDouble vectors are tightly packed");
+
+  using Vector3dd = Vector<DoubleDouble, 3>;
+
+  /// |a - b| relative to |b|, in double
+  auto relativeError(DoubleDouble const &a, DoubleDouble const &b) -> double
+  {
+    DoubleDouble const d = a - b;
+    return std::fabs(d.high()) / std::fabs(b.high());
+  }
+} // namespace
+
+TEST(DoubleDoubleTest, ExactTransformationsTest)
+{
+  DoubleDouble const s = exactSum(1.0, 1e-20);
+  ASSERT_EQ(s.high(), 1.0);
+  ASSERT_EQ(s.low(), 1e-20);
+
+  double const a = 1.0 + std::ldexp(1.0, -30);
+  DoubleDouble const p = exactProduct(a, a);
+  ASSERT_EQ(p.high(), 1.0 + std::ldexp(1.0, -29));
+  ASSERT_EQ(p.low(), std::ldexp(1.0, -60));
+  ASSERT_EQ(double(p), p.high());
+}
+
+TEST(DoubleDoubleTest, ArithmeticTest)
+{
+  DoubleDouble const tiny = std::ldexp(1.0, -80);
+  ASSERT_EQ((DoubleDouble{1.0} + tiny) - 1.0, tiny);
+
+  DoubleDouble const third = DoubleDouble{1.0} / 3.0;
+  ASSERT_LT(relativeError(third * 3.0, 1.0), 1e-31);
+  ASSERT_LT(relativeError(third * DoubleDouble{3.0}, 1.0), 1e-31);
+  ASSERT_NE(third.low(), 0.0);
+
+  DoubleDouble const root = sqrt(DoubleDouble{2.0});
+  ASSERT_LT(relativeError(root * root, 2.0), 1e-31);
+  ASSERT_EQ(sqrt(DoubleDouble{0.0}), 0.0);
+  ASSERT_TRUE(std::isnan(sqrt(DoubleDouble{-1.0}).high()));
+
+  DoubleDouble x = 0.0;
+  for (int i = 0; i < 100000; ++i)
+  {
+    x += 0.1;
+  }
+  // the sum of 100000 doubles nearest 0.1, which is not quite 10000
+  ASSERT_LT(relativeError(x, DoubleDouble{10000.0} + 100000.0 * (DoubleDouble{0.1} - DoubleDouble{1.0} / 10.0)),
+            1e-28);
+
+  ASSERT_LT(third, DoubleDouble(1.0 / 3.0, 2e-17));
+  ASSERT_GT(-third, -DoubleDouble(1.0 / 3.0, 2e-17));
+  ASSERT_EQ(abs(-third), third);
+  ASSERT_LE(third, third);
+  ASSERT_GE(third, third);
+}
+
+TEST(DoubleDoubleTest, VectorTest)
+{
+  Vector3dd const a{1e16, 1.0, -1e16};
+  Vector3dd const one{1.0, 1.0, 1.0};
+  ASSERT_EQ(dot(a, one), 1.0);
+  ASSERT_NE(dot(Vector3d{1e16, 1.0, -1e16}, Vector3d{1.0, 1.0, 1.0}), 1.0);
+
+  Vector3dd const x{1.0, 0.0, 0.0};
+  Vector3dd const y{0.0, 1.0, 0.0};
+  ASSERT_EQ(cross(x, y), (Vector3dd{0.0, 0.0, 1.0}));
+  ASSERT_EQ(x * 2.0 + y, (Vector3dd{2.0, 1.0, 0.0}));
+  ASSERT_LT(relativeError(length(Vector3dd{1.0, 1.0, 0.0}), sqrt(DoubleDouble{2.0})), 1e-31);
+
+  Matrix<DoubleDouble, 3, 3> const m{2.0, 0.0, 0.0, 0.0, 3.0, 0.0, 0.0, 0.0, DoubleDouble{1.0} / 3.0};
+  auto const r = m * Vector3dd{1.0, 1.0, 3.0};
+  ASSERT_EQ(r[0], 2.0);
+  ASSERT_LT(relativeError(r[2], 1.0), 1e-31);
+}
+
+TEST(DoubleDoubleTest, BatchTest)
+{
+  constexpr std::size_t count = 9;
+  std::vector<DoubleDouble> a(count);
+  std::vector<DoubleDouble> b(count);
+  std::vector<DoubleDouble> out(count);
+  for (std::size_t i = 0; i < count; ++i)
+  {
+    a[i] = DoubleDouble{1.0} / double(i + 3);
+    b[i] = sqrt(DoubleDouble{double(i + 2)}) * (i % 2 ? -1.0 : 1.0);
+  }
+  batch::add(a.data(), b.data(), out.data(), count);
+  for (std::size_t i = 0; i < count; ++i)
+  {
+    ASSERT_LT(relativeError(out[i], a[i] + b[i]), 1e-31);
+  }
+  batch::subtract(a.data(), b.data(), out.data(), count);
+  for (std::size_t i = 0; i < count; ++i)
+  {
+    ASSERT_LT(relativeError(out[i], a[i] - b[i]), 1e-31);
+  }
+  batch::multiply(a.data(), b.data(), out.data(), count);
+  for (std::size_t i = 0; i < count; ++i)
+  {
+    ASSERT_LT(relativeError(out[i], a[i] * b[i]), 1e-31);
+  }
+  batch::divide(a.data(), b.data(), out.data(), count);
+  for (std::size_t i = 0; i < count; ++i)
+  {
+    ASSERT_LT(relativeError(out[i], a[i] / b[i]), 1e-31);
+  }
+  batch::multiplyAdd(a.data(), b.data(), 0.1, out.data(), count);
+  for (std::size_t i = 0; i < count; ++i)
+  {
+    ASSERT_LT(relativeError(out[i], a[i] + b[i] * 0.1), 1e-31);
+  }
+
+  // a step of positions held in vectors
+  std::vector<Vector3dd> positions(3, Vector3dd{1e11, 0.0, 0.0});
+  std::vector<Vector3dd> const velocities(3, Vector3dd{1e-6, 3e4, 0.0});
+  batch::multiplyAdd(&positions[0][0], &velocities[0][0], 60.0, &positions[0][0], 3 * 3);
+  ASSERT_EQ(positions[2], (Vector3dd{DoubleDouble{1e11} + DoubleDouble{1e-6} * 60.0, 1.8e6, 0.0}));
+}
@@ -0,0 +1,133 @@
+#include "gtest/gtest.h"
+#include <cagey-math/Dual.hh>
+#include <cagey-math/MatrixFunc.hh>
+#include <cagey-math/Vector3.hh>
+#include <cagey-math/VectorFunc.hh>
+#include <cmath>
+#include <type_traits>
+
+using namespace cagey::math;
+
+namespace
+{
+  using Dual3f = Dual<float, 3>;
+  using Dual3d = Dual<double, 3>;
+
+  static_assert(std::is_trivial<Dual3f>::value, "dual numbers are trivial");
+  static_assert(sizeof(Dual3f) == sizeof(float[4]), "derivatives are stored contiguously");
+
+  // a function written once against generic vector code
+  template <typename T>
+  auto spin(Vector<T, 3> const &x) -> Vector<T, 3>
+  {
+    Vector<T, 3> const axis{T(0.0f), T(0.6f), T(0.8f)};
+    return normalize(cross(axis, x)) * length(x) + x * dot(axis, x);
+  }
+
+  // central differences of spin, for comparison
+  auto finiteJacobian(Vector3d const &x) -> Matrix33d
+  {
+    Matrix33d result{};
+    double const h = 1e-6;
+    for (std::size_t col = 0; col < 3; ++col)
+    {
+      Vector3d lo = x;
+      Vector3d hi = x;
+      lo[col] -= h;
+      hi[col] += h;
+      auto const d = (spin(hi) - spin(lo)) / (2 * h);
+      for (std::size_t row = 0; row < 3; ++row)
+      {
+        result[col][row] = d[row];
+      }
+    }
+    return result;
+  }
+} // namespace
+
+TEST(DualTest, ScalarRulesTest)
+{
+  auto const x = Dual<double, 2>::variable(2.0, 0);
+  auto const y = Dual<double, 2>::variable(3.0, 1);
+
+  auto const f = x * y + x / y - 2.0 * x;
+  ASSERT_DOUBLE_EQ(f.value(), 6.0 + 2.0 / 3.0 - 4.0);
+  ASSERT_DOUBLE_EQ(f.derivative(0), 3.0 + 1.0 / 3.0 - 2.0);
+  ASSERT_DOUBLE_EQ(f.derivative(1), 2.0 - 2.0 / 9.0);
+
+  auto const g = sin(x) * exp(y) + sqrt(x) - log(y);
+  ASSERT_DOUBLE_EQ(g.derivative(0), std::cos(2.0) * std::exp(3.0) + 0.5 / std::sqrt(2.0));
+  ASSERT_DOUBLE_EQ(g.derivative(1), std::sin(2.0) * std::exp(3.0) - 1.0 / 3.0);
+
+  auto const a = atan2(y, x);
+  ASSERT_DOUBLE_EQ(a.derivative(0), -3.0 / 13.0);
+  ASSERT_DOUBLE_EQ(a.derivative(1), 2.0 / 13.0);
+  ASSERT_DOUBLE_EQ(pow(x, 3.0).derivative(0), 12.0);
+  ASSERT_DOUBLE_EQ(abs(-x).derivative(0), 1.0);
+}
+
+TEST(DualTest, PowAtZeroTest)
+{
+  auto const x = Dual<double, 1>::variable(0.0, 0);
+  ASSERT_EQ(pow(x, 0.5).value(), 0.0);
+  ASSERT_EQ(pow(x, 2.0).value(), 0.0);
+  ASSERT_EQ(pow(x, 2.0).derivative(0), 0.0);
+  ASSERT_EQ(pow(x, 0.0).value(), 1.0);
+  ASSERT_EQ(pow(x, 0.0).derivative(0), 0.0);
+}
+
+TEST(DualTest, VectorFunctionsTest)
+{
+  auto const x = variables(Vector3d{1.0, 2.0, 2.0});
+  ASSERT_TRUE((std::is_same<decltype(x), Vector<Dual3d, 3> const>::value));
+
+  auto const len = length(x);
+  ASSERT_DOUBLE_EQ(len.value(), 3.0);
+  for (std::size_t k = 0; k < 3; ++k)
+  {
+    ASSERT_DOUBLE_EQ(len.derivative(k), x[k].value() / 3.0);
+  }
+
+  // the Jacobian of normalize is (I - n n^T) / |x|
+  auto const j = jacobian(normalize(x));
+  Vector3d const n{1.0 / 3.0, 2.0 / 3.0, 2.0 / 3.0};
+  for (std::size_t col = 0; col < 3; ++col)
+  {
+    for (std::size_t row = 0; row < 3; ++row)
+    {
+      double const expected = ((row == col ? 1.0 : 0.0) - n[row] * n[col]) / 3.0;
+      ASSERT_NEAR(j[col][row], expected, 1e-15);
+    }
+  }
+  ASSERT_TRUE(fuzzyEquals(values(normalize(x)), n, 1e-15));
+}
+
+TEST(DualTest, MatrixProductTest)
+{
+  Matrix<Dual3d, 3, 3> const m{2.0, 0.0, 1.0, 0.0, 3.0, 0.0, 4.0, 0.0, 5.0};
+  auto const j = jacobian(m * variables(Vector3d{1.0, -1.0, 2.0}));
+  ASSERT_TRUE(fuzzyEquals(j[0], Vector3d{2.0, 0.0, 1.0}));
+  ASSERT_TRUE(fuzzyEquals(j[1], Vector3d{0.0, 3.0, 0.0}));
+  ASSERT_TRUE(fuzzyEquals(j[2], Vector3d{4.0, 0.0, 5.0}));
+}
+
+TEST(DualTest, MatchesFiniteDifferencesTest)
+{
+  Vector3d const x{0.3, -1.2, 0.7};
+  auto const exact = jacobian(spin(variables(x)));
+  auto const approx = finiteJacobian(x);
+  for (std::size_t col = 0; col < 3; ++col)
+  {
+    ASSERT_TRUE(fuzzyEquals(exact[col], approx[col], 1e-8));
+  }
+
+  // the float version agrees with the double one
+  auto const single = jacobian(spin(variables(Vector3f{0.3f, -1.2f, 0.7f})));
+  for (std::size_t col = 0; col < 3; ++col)
+  {
+    for (std::size_t row = 0; row < 3; ++row)
+    {
+      ASSERT_NEAR(single[col][row], exact[col][row], 1e-5);
+    }
+  }
+}
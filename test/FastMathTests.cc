@@ -0,0 +1,186 @@
+#include "gtest/gtest.h"
+#include <cagey-math/FastMath.hh>
+#include <cagey-math/Vector3.hh>
+#include <cagey-math/Vector4.hh>
+#include <cmath>
+#include <limits>
+#include <vector>
+
+using namespace cagey::math;
+
+namespace
+{
+  constexpr float Inf = std::numeric_limits<float>::infinity();
+  constexpr float NaN = std::numeric_limits<float>::quiet_NaN();
+
+  auto sweep(float const lo, float const hi, std::size_t const count = 100003) -> std::vector<float>
+  {
+    std::vector<float> result(count);
+    for (std::size_t i = 0; i < count; ++i)
+    {
+      result[i] = float(lo + (double(hi) - lo) * double(i) / double(count - 1));
+    }
+    return result;
+  }
+
+  /// largest error of out against f(in) in ulps of the float result
+  template <typename F>
+  auto maxUlps(std::vector<float> const &in, std::vector<float> const &out, F const &f) -> double
+  {
+    double worst = 0.0;
+    for (std::size_t i = 0; i < in.size(); ++i)
+    {
+      double const exact = f(double(in[i]));
+      double const ulp = std::nextafter(float(std::fabs(exact)), Inf) - float(std::fabs(exact));
+      worst = std::max(worst, std::fabs(out[i] - exact) / ulp);
+    }
+    return worst;
+  }
+
+  /// largest relative error of out against f(in)
+  template <typename F>
+  auto maxRelative(std::vector<float> const &in, std::vector<float> const &out, F const &f) -> double
+  {
+    double worst = 0.0;
+    for (std::size_t i = 0; i < in.size(); ++i)
+    {
+      double const exact = f(double(in[i]));
+      worst = std::max(worst, std::fabs(out[i] - exact) / std::fabs(exact));
+    }
+    return worst;
+  }
+
+  /// largest absolute error of out against f(in)
+  template <typename F>
+  auto maxAbsolute(std::vector<float> const &in, std::vector<float> const &out, F const &f) -> double
+  {
+    double worst = 0.0;
+    for (std::size_t i = 0; i < in.size(); ++i)
+    {
+      worst = std::max(worst, std::fabs(out[i] - f(double(in[i]))));
+    }
+    return worst;
+  }
+
+  auto exact_exp = [](double x) { return std::exp(x); };
+  auto exact_exp2 = [](double x) { return std::exp2(x); };
+  auto exact_log = [](double x) { return std::log(x); };
+} // namespace
+
+TEST(FastMathTest, ExpTest)
+{
+  auto const in = sweep(-87.0f, 88.0f);
+  std::vector<float> out(in.size());
+  batch::exp(in.data(), out.data(), in.size());
+  ASSERT_LE(maxUlps(in, out, exact_exp), 2.0);
+  batch::exp<Accuracy::Medium>(in.data(), out.data(), in.size());
+  ASSERT_LE(maxRelative(in, out, exact_exp), 1e-4);
+  batch::exp<Accuracy::Low>(in.data(), out.data(), in.size());
+  ASSERT_LE(maxRelative(in, out, exact_exp), 1e-2);
+}
+
+TEST(FastMathTest, Exp2Test)
+{
+  auto const in = sweep(-126.0f, 127.0f);
+  std::vector<float> out(in.size());
+  batch::exp2(in.data(), out.data(), in.size());
+  ASSERT_LE(maxUlps(in, out, exact_exp2), 2.0);
+  batch::exp2<Accuracy::Medium>(in.data(), out.data(), in.size());
+  ASSERT_LE(maxRelative(in, out, exact_exp2), 1e-4);
+  batch::exp2<Accuracy::Low>(in.data(), out.data(), in.size());
+  ASSERT_LE(maxRelative(in, out, exact_exp2), 1e-2);
+
+  float const whole[] = {-10.0f, -1.0f, 0.0f, 1.0f, 10.0f};
+  float powers[5];
+  batch::exp2<Accuracy::Low>(whole, powers, 5);
+  ASSERT_FLOAT_EQ(powers[0], 1.0f / 1024.0f);
+  ASSERT_FLOAT_EQ(powers[2], 1.0f);
+  ASSERT_FLOAT_EQ(powers[4], 1024.0f);
+}
+
+TEST(FastMathTest, LogTest)
+{
+  auto const in = sweep(1e-30f, 1e4f);
+  auto const near = sweep(0.5f, 2.0f);
+  std::vector<float> out(in.size());
+  batch::log(in.data(), out.data(), in.size());
+  ASSERT_LE(maxAbsolute(in, out, exact_log), 1e-6);
+  batch::log(near.data(), out.data(), near.size());
+  ASSERT_LE(maxUlps(near, out, exact_log), 2.0);
+  batch::log<Accuracy::Medium>(in.data(), out.data(), in.size());
+  ASSERT_LE(maxAbsolute(in, out, exact_log), 1e-4);
+  batch::log<Accuracy::Low>(in.data(), out.data(), in.size());
+  ASSERT_LE(maxAbsolute(in, out, exact_log), 1e-2);
+
+  float const denormal = std::numeric_limits<float>::denorm_min() * 1000.0f;
+  float result;
+  batch::log(&denormal, &result, 1);
+  ASSERT_NEAR(result, std::log(double(denormal)), 1e-5);
+}
+
+TEST(FastMathTest, PowTest)
+{
+  auto const in = sweep(0.001f, 1.0f, 1003);
+  std::vector<float> out(in.size());
+  batch::pow(in.data(), 2.2f, out.data(), in.size());
+  // y log2(x) reaches 22 here, its rounding alone is 22 * 2^-24 relative
+  ASSERT_LE(maxRelative(in, out, [](double x) { return std::pow(x, double(2.2f)); }), 2e-6);
+  batch::pow<Accuracy::Medium>(in.data(), 1.0f / 2.2f, out.data(), in.size());
+  ASSERT_LE(maxRelative(in, out, [](double x) { return std::pow(x, double(1.0f / 2.2f)); }), 1e-4);
+  batch::pow<Accuracy::Low>(in.data(), 2.2f, out.data(), in.size());
+  ASSERT_LE(maxRelative(in, out, [](double x) { return std::pow(x, double(2.2f)); }), 1e-2);
+
+  float const x[] = {2.0f, 3.0f, 0.0f, 0.0f, 5.0f};
+  float const y[] = {10.0f, 0.5f, 2.0f, 0.0f, -1.0f};
+  float r[5];
+  batch::pow(x, y, r, 5);
+  ASSERT_NEAR(r[0], 1024.0f, 1e-3f);
+  ASSERT_FLOAT_EQ(r[1], std::sqrt(3.0f));
+  ASSERT_EQ(r[2], 0.0f);
+  ASSERT_EQ(r[3], 1.0f);
+  ASSERT_FLOAT_EQ(r[4], 0.2f);
+}
+
+TEST(FastMathTest, SpecialValuesTest)
+{
+  float const in[] = {NaN, Inf, -Inf, 0.0f, -1.0f, 200.0f, -200.0f};
+  float e[7];
+  float l[7];
+  batch::exp(in, e, 7);
+  batch::log(in, l, 7);
+  ASSERT_TRUE(std::isnan(e[0]));
+  ASSERT_EQ(e[1], Inf);
+  ASSERT_EQ(e[2], 0.0f);
+  ASSERT_EQ(e[3], 1.0f);
+  ASSERT_EQ(e[5], Inf);
+  ASSERT_EQ(e[6], 0.0f);
+  ASSERT_TRUE(std::isnan(l[0]));
+  ASSERT_EQ(l[1], Inf);
+  ASSERT_TRUE(std::isnan(l[2]));
+  ASSERT_EQ(l[3], -Inf);
+  ASSERT_TRUE(std::isnan(l[4]));
+
+  float tiny;
+  float const x = -140.0f;
+  batch::exp2(&x, &tiny, 1);
+  ASSERT_EQ(tiny, std::exp2(-140.0f));
+}
+
+TEST(FastMathTest, VectorTest)
+{
+  Vector3f const v{0.5f, 1.0f, 2.0f};
+  auto const e = exp(v);
+  auto const l = log(e);
+  ASSERT_TRUE(fuzzyEquals(l, v, 1e-6f));
+  ASSERT_FLOAT_EQ(e.x, std::exp(0.5f));
+  ASSERT_TRUE(fuzzyEquals(exp2<Accuracy::Low>(v), Vector3f{std::sqrt(2.0f), 2.0f, 4.0f}, 1e-2f));
+
+  Vector4f const c{0.25f, 0.5f, 0.75f, 1.0f};
+  auto const linear = pow<Accuracy::Medium>(c, 2.2f);
+  ASSERT_NEAR(linear.y, std::pow(0.5f, 2.2f), 1e-4f);
+  ASSERT_FLOAT_EQ(linear.w, 1.0f);
+  ASSERT_TRUE(fuzzyEquals(pow(c, Vector4f{2.0f, 2.0f, 2.0f, 2.0f}), Vector4f{0.0625f, 0.25f, 0.5625f, 1.0f}, 1e-6f));
+
+  Vector3d const d{0.5, 1.0, 2.0};
+  ASSERT_TRUE(fuzzyEquals(log(exp(d)), d, 1e-15));
+}
@@ -0,0 +1,121 @@
+#include "gtest/gtest.h"
+#include <cagey-math/Geometry.hh>
+#include <vector>
+
+using namespace cagey::math;
+
+TEST(GeometryTest, PlaneTest)
+{
+  constexpr auto plane = Plane<double>::fromPointNormal({0.0, 0.0, 1.0}, {5.0, 5.0, 2.0});
+  static_assert(signedDistance(plane, Vector3d{1.0, 2.0, 5.0}) == 3.0);
+  ASSERT_DOUBLE_EQ(signedDistance(plane, Vector3d{1.0, 2.0, -1.0}), -3.0);
+  ASSERT_EQ(closestPoint(plane, Vector3d{1.0, 2.0, 5.0}), (Vector3d{1.0, 2.0, 2.0}));
+
+  auto const p = Plane<double>::fromPoints({0.0, 0.0, 1.0}, {1.0, 0.0, 1.0}, {0.0, 1.0, 1.0});
+  ASSERT_TRUE(fuzzyEquals(p.normal, Vector3d{0.0, 0.0, 1.0}));
+  ASSERT_DOUBLE_EQ(p.offset, 1.0);
+}
+
+TEST(GeometryTest, SphereTest)
+{
+  Sphere<double> const sphere{{1.0, 1.0, 1.0}, 2.0};
+  ASSERT_DOUBLE_EQ(signedDistance(sphere, Vector3d{1.0, 1.0, 5.0}), 2.0);
+  ASSERT_DOUBLE_EQ(signedDistance(sphere, Vector3d{1.0, 1.0, 1.0}), -2.0);
+  ASSERT_EQ(closestPoint(sphere, Vector3d{1.0, 1.0, 5.0}), (Vector3d{1.0, 1.0, 3.0}));
+  ASSERT_EQ(closestPoint(sphere, Vector3d{1.0, 1.0, 1.0}), (Vector3d{3.0, 1.0, 1.0}));
+}
+
+TEST(GeometryTest, LineTest)
+{
+  constexpr Line<double> line{{0.0, 1.0, 0.0}, {2.0, 0.0, 0.0}};
+  static_assert(project(line, Vector3d{4.0, 3.0, 0.0}) == 2.0);
+  ASSERT_EQ(closestPoint(line, Vector3d{-4.0, 3.0, 0.0}), (Vector3d{-4.0, 1.0, 0.0}));
+  ASSERT_DOUBLE_EQ(distance(line, Vector3d{7.0, 4.0, 4.0}), 5.0);
+}
+
+TEST(GeometryTest, SegmentTest)
+{
+  constexpr Segment<double> segment{{0.0, 0.0, 0.0}, {4.0, 0.0, 0.0}};
+  static_assert(project(segment, Vector3d{1.0, 3.0, 0.0}) == 0.25);
+  ASSERT_DOUBLE_EQ(project(segment, Vector3d{-1.0, 3.0, 0.0}), 0.0);
+  ASSERT_DOUBLE_EQ(project(segment, Vector3d{9.0, 3.0, 0.0}), 1.0);
+  ASSERT_EQ(closestPoint(segment, Vector3d{9.0, 3.0, 0.0}), (Vector3d{4.0, 0.0, 0.0}));
+  ASSERT_DOUBLE_EQ(distance(segment, Vector3d{7.0, 4.0, 0.0}), 5.0);
+  ASSERT_DOUBLE_EQ(distance(segment, Vector3d{2.0, 0.0, 2.0}), 2.0);
+
+  constexpr Segment<double> point{{1.0, 1.0, 1.0}, {1.0, 1.0, 1.0}};
+  ASSERT_DOUBLE_EQ(distance(point, Vector3d{1.0, 1.0, 3.0}), 2.0);
+}
+
+namespace
+{
+  struct SoA
+  {
+    std::vector<float> x, y, z;
+
+    explicit SoA(std::size_t count) : x(count), y(count), z(count) {}
+
+    auto in() const -> batch::PointsSoA<float> { return {x.data(), y.data(), z.data()}; }
+    auto out() -> batch::PointsSoAOut<float> { return {x.data(), y.data(), z.data()}; }
+    auto operator[](std::size_t i) const -> Vector3f { return {x[i], y[i], z[i]}; }
+  };
+
+  auto makePoints(std::size_t count) -> SoA
+  {
+    SoA points{count};
+    for (std::size_t i = 0; i < count; ++i)
+    {
+      auto const f = static_cast<float>(i);
+      points.x[i] = std::sin(f) * 5.0f;
+      points.y[i] = std::cos(f * 0.7f) * 5.0f;
+      points.z[i] = std::sin(f * 1.3f) * 5.0f;
+    }
+    points.x[0] = points.y[0] = points.z[0] = 1.0f; // sphere center
+    return points;
+  }
+
+  template <typename Shape>
+  auto checkBatch(Shape const &shape) -> void
+  {
+    constexpr std::size_t count = 67;
+    auto const p = makePoints(count);
+    SoA closest{count};
+    std::vector<float> values(count);
+
+    batch::closestPoint(shape, p.in(), closest.out(), count);
+    for (std::size_t i = 0; i < count; ++i)
+    {
+      ASSERT_TRUE(fuzzyEquals(closest[i], closestPoint(shape, p[i]), 1e-5f));
+    }
+
+    if constexpr (std::is_same<Shape, Plane<float>>::value || std::is_same<Shape, Sphere<float>>::value)
+    {
+      batch::signedDistance(shape, p.in(), values.data(), count);
+      for (std::size_t i = 0; i < count; ++i)
+      {
+        ASSERT_NEAR(values[i], signedDistance(shape, p[i]), 1e-5f);
+      }
+    }
+    else
+    {
+      batch::distance(shape, p.in(), values.data(), count);
+      for (std::size_t i = 0; i < count; ++i)
+      {
+        ASSERT_NEAR(values[i], distance(shape, p[i]), 1e-5f);
+      }
+      batch::project(shape, p.in(), values.data(), count);
+      for (std::size_t i = 0; i < count; ++i)
+      {
+        ASSERT_NEAR(values[i], project(shape, p[i]), 1e-5f);
+      }
+    }
+  }
+} // namespace
+
+TEST(GeometryTest, BatchTest)
+{
+  checkBatch(Plane<float>::fromPointNormal(normalize(Vector3f{1.0f, 2.0f, 3.0f}), {0.5f, 0.0f, 1.0f}));
+  checkBatch(Sphere<float>{{1.0f, 1.0f, 1.0f}, 2.5f});
+  checkBatch(Line<float>{{1.0f, -1.0f, 0.5f}, {0.3f, 2.0f, -1.0f}});
+  checkBatch(Segment<float>{{1.0f, -1.0f, 0.5f}, {2.0f, 3.0f, -1.0f}});
+}
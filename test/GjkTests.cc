@@ -0,0 +1,86 @@
+#include "gtest/gtest.h"
+#include <cagey-math/Gjk.hh>
+
+using namespace cagey::math;
+
+TEST(GjkTest, SphereSphereTest)
+{
+  Sphere<double> const a{{0.0, 0.0, 0.0}, 1.0};
+  Sphere<double> const b{{4.0, 0.0, 0.0}, 1.0};
+  GjkCache<double> cache{};
+  auto const r = gjk<double>(supportFunction(a), supportFunction(b), cache);
+  ASSERT_FALSE(r.intersecting);
+  ASSERT_NEAR(r.distance, 2.0, 1e-6);
+  ASSERT_NEAR(r.pointA[0], 1.0, 1e-6);
+  ASSERT_NEAR(r.pointB[0], 3.0, 1e-6);
+
+  Sphere<double> const c{{1.5, 0.0, 0.0}, 1.0};
+  GjkCache<double> cold{};
+  auto const hit = gjk<double>(supportFunction(a), supportFunction(c), cold);
+  ASSERT_TRUE(hit.intersecting);
+  ASSERT_EQ(hit.distance, 0.0);
+
+  auto const p = epa(supportFunction(a), supportFunction(c), hit);
+  ASSERT_TRUE(p.valid);
+  ASSERT_NEAR(p.depth, 0.5, 1e-2);
+  ASSERT_NEAR(p.normal[0], 1.0, 1e-2);
+}
+
+TEST(GjkTest, BoxBoxTest)
+{
+  Box<double> const a{{0.0, 0.0, 0.0}, {1.0, 1.0, 1.0}};
+  Box<double> const b{{3.0, 0.5, 0.0}, {1.0, 1.0, 1.0}};
+  GjkCache<double> cache{};
+  auto const r = gjk<double>(supportFunction(a), supportFunction(b), cache);
+  ASSERT_FALSE(r.intersecting);
+  ASSERT_NEAR(r.distance, 1.0, 1e-9);
+
+  Box<double> const c{{1.5, 0.2, 0.1}, {1.0, 1.0, 1.0}};
+  GjkCache<double> cold{};
+  auto const hit = gjk<double>(supportFunction(a), supportFunction(c), cold);
+  ASSERT_TRUE(hit.intersecting);
+  auto const p = epa(supportFunction(a), supportFunction(c), hit);
+  ASSERT_TRUE(p.valid);
+  ASSERT_NEAR(p.depth, 0.5, 1e-9);
+  ASSERT_TRUE(fuzzyEquals(p.normal, Vector3d{1.0, 0.0, 0.0}));
+}
+
+TEST(GjkTest, CapsuleSphereTest)
+{
+  Capsule<float> const capsule{{{0.0f, -2.0f, 0.0f}, {0.0f, 2.0f, 0.0f}}, 0.5f};
+  Sphere<float> const sphere{{3.0f, 1.0f, 0.0f}, 1.0f};
+  GjkCache<float> cache{};
+  auto const r = gjk<float>(supportFunction(capsule), supportFunction(sphere), cache);
+  ASSERT_FALSE(r.intersecting);
+  ASSERT_NEAR(r.distance, 1.5f, 1e-3f);
+}
+
+TEST(GjkTest, ConvexPointsTest)
+{
+  Vector3d const points[] = {{0.0, 0.0, 0.0}, {1.0, 0.0, 0.0}, {0.0, 1.0, 0.0}, {0.0, 0.0, 1.0}};
+  ConvexPoints<double> const tetrahedron{points, 4};
+  Sphere<double> const sphere{{1.0, 1.0, 1.0}, 0.1};
+  GjkCache<double> cache{};
+  auto const r = gjk<double>(supportFunction(tetrahedron), supportFunction(sphere), cache);
+  ASSERT_FALSE(r.intersecting);
+  // distance from (1,1,1) to the plane x + y + z = 1 minus the radius
+  ASSERT_NEAR(r.distance, 2.0 / std::sqrt(3.0) - 0.1, 1e-6);
+  ASSERT_NEAR(r.pointA[0] + r.pointA[1] + r.pointA[2], 1.0, 1e-6);
+}
+
+TEST(GjkTest, WarmStartTest)
+{
+  Box<double> const a{{0.0, 0.0, 0.0}, {1.0, 1.0, 1.0}};
+  Box<double> b{{3.0, 2.5, 1.5}, {1.0, 1.0, 1.0}};
+  GjkCache<double> cache{};
+  auto const first = gjk<double>(supportFunction(a), supportFunction(b), cache);
+  ASSERT_GT(cache.count, 0u);
+
+  b.center += Vector3d{0.01, 0.0, 0.0};
+  GjkCache<double> cold{};
+  auto const coldResult = gjk<double>(supportFunction(a), supportFunction(b), cold);
+  auto const warmResult = gjk<double>(supportFunction(a), supportFunction(b), cache);
+  ASSERT_NEAR(coldResult.distance, warmResult.distance, 1e-9);
+  ASSERT_LT(warmResult.iterations, first.iterations);
+  ASSERT_LE(warmResult.iterations, coldResult.iterations);
+}
@@ -0,0 +1,177 @@
+#include "gtest/gtest.h"
+#include <cagey-math/IntVectorFunc.hh>
+#include <cstdint>
+#include <type_traits>
+#include <vector>
+
+using namespace cagey::math;
+
+using Vector4ub = Vector<std::uint8_t, 4>;
+
+TEST(IntVectorFuncTest, AddSaturatedTest)
+{
+  constexpr Vector3i a{2147483600, -2147483600, 5};
+  constexpr auto r = addSaturated(a, Vector3i{100, -100, 6});
+  ASSERT_EQ(r, (Vector3i{2147483647, -2147483647 - 1, 11}));
+
+  constexpr auto s = addSaturated(Vector<std::int64_t, 2>{INT64_MAX - 1, 1}, Vector<std::int64_t, 2>{5, 2});
+  ASSERT_EQ(s, (Vector<std::int64_t, 2>{INT64_MAX, 3}));
+}
+
+TEST(IntVectorFuncTest, SubSaturatedTest)
+{
+  ASSERT_EQ(subSaturated(Vector3u{5, 10, 0}, Vector3u{6, 3, 1}), (Vector3u{0, 7, 0}));
+  ASSERT_EQ(subSaturated(Vector2i{-2147483600, 2147483600}, Vector2i{100, -100}),
+            (Vector2i{-2147483647 - 1, 2147483647}));
+}
+
+TEST(IntVectorFuncTest, PackedByteSaturatedTest)
+{
+  constexpr Vector4ub a{250, 10, 128, 0};
+  constexpr Vector4ub b{10, 20, 128, 0};
+  static_assert(addSaturated(a, b)[0] == 255);
+  ASSERT_EQ(addSaturated(a, b), (Vector4ub{255, 30, 255, 0}));
+  ASSERT_EQ(subSaturated(b, a), (Vector4ub{0, 10, 0, 0}));
+
+  // the packed path must agree with the per component path
+  for (int x = 0; x < 256; x += 3)
+  {
+    for (int y = 0; y < 256; y += 5)
+    {
+      Vector4ub const l{std::uint8_t(x), std::uint8_t(y), std::uint8_t(255 - x), std::uint8_t(y / 2)};
+      Vector4ub const r{std::uint8_t(y), std::uint8_t(x), std::uint8_t(x / 3), std::uint8_t(255 - y)};
+      ASSERT_EQ(addSaturated(l, r), (addSaturated<std::uint8_t, 4>(l, r)));
+      ASSERT_EQ(subSaturated(l, r), (subSaturated<std::uint8_t, 4>(l, r)));
+    }
+  }
+}
+
+TEST(IntVectorFuncTest, MinMaxTest)
+{
+  constexpr Vector3i a{1, -5, 7};
+  constexpr Vector3i b{2, -6, 7};
+  ASSERT_EQ(min(a, b), (Vector3i{1, -6, 7}));
+  ASSERT_EQ(max(a, b), (Vector3i{2, -5, 7}));
+}
+
+TEST(IntVectorFuncTest, ShiftTest)
+{
+  ASSERT_EQ(shiftLeft(Vector3i{1, -1, 3}, 2), (Vector3i{4, -4, 12}));
+  ASSERT_EQ(shiftRight(Vector3i{16, -16, 3}, 2), (Vector3i{4, -4, 0}));
+  ASSERT_EQ(shiftLeft(Vector4ub{0x81, 1, 2, 3}, 1), (Vector4ub{0x02, 2, 4, 6}));
+}
+
+TEST(IntVectorFuncTest, CompareMaskTest)
+{
+  constexpr Vector4i a{1, 2, 3, 4};
+  constexpr Vector4i b{1, 3, 2, 4};
+  static_assert(equalMask(a, b) == 0b1001u);
+  ASSERT_EQ(lessMask(a, b), 0b0010u);
+  ASSERT_EQ(greaterMask(a, b), 0b0100u);
+}
+
+namespace
+{
+  template <typename T, std::size_t N>
+  auto makeVectors(std::size_t count, int seed) -> std::vector<Vector<T, N>>
+  {
+    std::vector<Vector<T, N>> result(count);
+    for (std::size_t v = 0; v < count; ++v)
+    {
+      for (std::size_t i = 0; i < N; ++i)
+      {
+        result[v][i] = static_cast<T>((v * 37 + i * 101 + seed) * 2654435761u >> 7);
+      }
+    }
+    return result;
+  }
+
+  template <typename T, std::size_t N>
+  auto checkBatch() -> void
+  {
+    constexpr std::size_t count = 37; // leaves a scalar tail after the SIMD loop
+    auto const a = makeVectors<T, N>(count, 1);
+    auto const b = makeVectors<T, N>(count, 2);
+    std::vector<Vector<T, N>> out(count);
+    std::vector<std::uint32_t> masks(count);
+
+    batch::addSaturated(a.data(), b.data(), out.data(), count);
+    for (std::size_t i = 0; i < count; ++i)
+    {
+      ASSERT_EQ(out[i], (addSaturated<T, N>(a[i], b[i])));
+    }
+    batch::subSaturated(a.data(), b.data(), out.data(), count);
+    for (std::size_t i = 0; i < count; ++i)
+    {
+      ASSERT_EQ(out[i], (subSaturated<T, N>(a[i], b[i])));
+    }
+    batch::min(a.data(), b.data(), out.data(), count);
+    for (std::size_t i = 0; i < count; ++i)
+    {
+      ASSERT_EQ(out[i], min(a[i], b[i]));
+    }
+    batch::max(a.data(), b.data(), out.data(), count);
+    for (std::size_t i = 0; i < count; ++i)
+    {
+      ASSERT_EQ(out[i], max(a[i], b[i]));
+    }
+    batch::mulLo(a.data(), b.data(), out.data(), count);
+    for (std::size_t i = 0; i < count; ++i)
+    {
+      for (std::size_t c = 0; c < N; ++c)
+      {
+        ASSERT_EQ(out[i][c], static_cast<T>(static_cast<std::uint64_t>(a[i][c]) * static_cast<std::uint64_t>(b[i][c])));
+      }
+    }
+    batch::shiftLeft(a.data(), 3, out.data(), count);
+    for (std::size_t i = 0; i < count; ++i)
+    {
+      ASSERT_EQ(out[i], shiftLeft(a[i], 3));
+    }
+    batch::shiftRight(a.data(), 3, out.data(), count);
+    for (std::size_t i = 0; i < count; ++i)
+    {
+      ASSERT_EQ(out[i], shiftRight(a[i], 3));
+    }
+    batch::lessMask(a.data(), b.data(), masks.data(), count);
+    for (std::size_t i = 0; i < count; ++i)
+    {
+      ASSERT_EQ(masks[i], lessMask(a[i], b[i]));
+    }
+    batch::equalMask(a.data(), a.data(), masks.data(), count);
+    for (std::size_t i = 0; i < count; ++i)
+    {
+      ASSERT_EQ(masks[i], (1u << N) - 1);
+    }
+  }
+} // namespace
+
+TEST(IntVectorFuncTest, BatchTest)
+{
+  checkBatch<std::uint8_t, 4>();
+  checkBatch<std::int8_t, 3>();
+  checkBatch<std::int16_t, 2>();
+  checkBatch<std::uint16_t, 4>();
+  checkBatch<std::int32_t, 3>();
+  checkBatch<std::uint32_t, 2>();
+  checkBatch<std::int64_t, 4>();
+}
+
+TEST(IntVectorFuncTest, TaggedVectorTest)
+{
+  struct Screen;
+  using ScreenVector = Vector<std::uint8_t, 4, Screen>;
+  constexpr ScreenVector a{250, 10, 128, 0};
+  constexpr ScreenVector b{10, 20, 128, 0};
+  static_assert(std::is_same<decltype(addSaturated(a, b)), ScreenVector>::value);
+  static_assert(std::is_same<decltype(shiftRight(a, 1)), ScreenVector>::value);
+  ASSERT_EQ(addSaturated(a, b), (ScreenVector{255, 30, 255, 0}));
+  ASSERT_EQ(lessMask(a, b), 0b0010u);
+
+  std::vector<ScreenVector> const lhs{a, b};
+  std::vector<ScreenVector> const rhs{b, a};
+  std::vector<ScreenVector> out(2);
+  batch::subSaturated(lhs.data(), rhs.data(), out.data(), out.size());
+  ASSERT_EQ(out[0], (ScreenVector{240, 0, 0, 0}));
+  ASSERT_EQ(out[1], (ScreenVector{0, 10, 0, 0}));
+}
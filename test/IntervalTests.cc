@@ -0,0 +1,98 @@
+#include "gtest/gtest.h"
+#include <cagey-math/Interval.hh>
+#include <cagey-math/Matrix33.hh>
+#include <cagey-math/Vector3.hh>
+#include <cagey-math/VectorFunc.hh>
+#include <cmath>
+#include <limits>
+#include <random>
+#include <type_traits>
+
+using namespace cagey::math;
+
+namespace
+{
+  using Intervalf = Interval<float>;
+
+  static_assert(std::is_trivial<Intervalf>::value, "intervals are trivial");
+  static_assert(sizeof(Vector<Intervalf, 3>) == sizeof(float[6]), "interval vectors are tightly packed");
+
+  auto encloses(Intervalf const &i, double const v) -> bool
+  {
+    return i.lower() <= v && v <= i.upper();
+  }
+} // namespace
+
+TEST(IntervalTest, ArithmeticEnclosesTest)
+{
+  Intervalf const a{0.1f};
+  Intervalf const b{0.2f};
+  double const exact = double(0.1f) + double(0.2f);
+  ASSERT_TRUE(encloses(a + b, exact));
+  ASSERT_LT((a + b).lower(), (a + b).upper());
+  ASSERT_TRUE(encloses(a - b, double(0.1f) - double(0.2f)));
+  ASSERT_TRUE(encloses(a * b, double(0.1f) * double(0.2f)));
+  ASSERT_TRUE(encloses(a / b, double(0.1f) / double(0.2f)));
+  ASSERT_TRUE(encloses(sqrt(b), std::sqrt(double(0.2f))));
+
+  Intervalf const c{-2.0f, 3.0f};
+  Intervalf const d{-1.0f, 4.0f};
+  auto const p = c * d;
+  ASSERT_LE(p.lower(), -8.0f);
+  ASSERT_GE(p.upper(), 12.0f);
+  ASSERT_TRUE(p.contains(-8.0f) && p.contains(12.0f));
+  ASSERT_EQ(-c, (Intervalf{-3.0f, 2.0f}));
+}
+
+TEST(IntervalTest, DivisionByZeroTest)
+{
+  auto const q = Intervalf{1.0f, 2.0f} / Intervalf{-1.0f, 1.0f};
+  ASSERT_EQ(q.lower(), -std::numeric_limits<float>::infinity());
+  ASSERT_EQ(q.upper(), std::numeric_limits<float>::infinity());
+}
+
+TEST(IntervalTest, SquareIsTightTest)
+{
+  Intervalf const a{-2.0f, 3.0f};
+  ASSERT_EQ(square(a).lower(), 0.0f);
+  ASSERT_LT((a * a).lower(), 0.0f);
+  ASSERT_EQ(abs(a), (Intervalf{0.0f, 3.0f}));
+  ASSERT_EQ(hull(a, Intervalf{5.0f}), (Intervalf{-2.0f, 5.0f}));
+  ASSERT_FALSE(intersects(a, Intervalf{4.0f, 5.0f}));
+}
+
+TEST(IntervalTest, VectorBoundsTest)
+{
+  std::mt19937 gen{7};
+  std::uniform_real_distribution<float> dist{-10.0f, 10.0f};
+  for (int i = 0; i < 1000; ++i)
+  {
+    Vector3f const a{dist(gen), dist(gen), dist(gen)};
+    Vector3f const b{dist(gen), dist(gen), dist(gen)};
+    Vector<Intervalf, 3> const ia{a.x, a.y, a.z};
+    Vector<Intervalf, 3> const ib{b.x, b.y, b.z};
+
+    double const exactDot = double(a.x) * b.x + double(a.y) * b.y + double(a.z) * b.z;
+    ASSERT_TRUE(encloses(dot(ia, ib), exactDot));
+
+    auto const c = cross(ia, ib);
+    ASSERT_TRUE(encloses(c.x, double(a.y) * b.z - double(a.z) * b.y));
+    ASSERT_TRUE(encloses(c.y, double(a.z) * b.x - double(a.x) * b.z));
+    ASSERT_TRUE(encloses(c.z, double(a.x) * b.y - double(a.y) * b.x));
+
+    auto const s = ia * 0.1f + ib;
+    ASSERT_TRUE(encloses(s.x, double(a.x) * double(0.1f) + b.x));
+  }
+}
+
+TEST(IntervalTest, MatrixBoundsTest)
+{
+  Matrix<Intervalf, 3, 3> const m{Intervalf{1.0f, 1.5f}, 0.0f, 0.0f, 0.0f, 2.0f, 0.0f, 0.0f, 0.0f, 0.1f};
+  Vector<Intervalf, 3> const v{1.0f, Intervalf{-1.0f, 1.0f}, 3.0f};
+  auto const r = m * v;
+  ASSERT_LE(r.x.lower(), 1.0f);
+  ASSERT_GE(r.x.upper(), 1.5f);
+  ASSERT_LE(r.y.lower(), -2.0f);
+  ASSERT_GE(r.y.upper(), 2.0f);
+  ASSERT_TRUE(encloses(r.z, double(0.1f) * 3.0));
+}
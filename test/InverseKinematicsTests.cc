@@ -0,0 +1,109 @@
+#include "gtest/gtest.h"
+#include <cagey-math/InverseKinematics.hh>
+#include <array>
+#include <vector>
+
+using namespace cagey::math;
+
+namespace
+{
+  constexpr std::size_t JointCount = 5;
+
+  // a straight chain along x with unit bones
+  auto straightChain() -> std::array<Vector3d, JointCount>
+  {
+    std::array<Vector3d, JointCount> positions;
+    for (std::size_t i = 0; i < JointCount; ++i)
+    {
+      positions[i] = Vector3d{double(i), 0.0, 0.0};
+    }
+    return positions;
+  }
+
+  auto identities() -> std::array<Matrix33d, JointCount>
+  {
+    std::array<Matrix33d, JointCount> rotations;
+    rotations.fill(Matrix33d::identity());
+    return rotations;
+  }
+
+  // bone lengths are kept and each orientation still carries its bone from +x
+  auto checkChain(std::array<Vector3d, JointCount> const &positions,
+                  std::array<Matrix33d, JointCount> const &rotations) -> void
+  {
+    ASSERT_TRUE(fuzzyEquals(positions[0], Vector3d{0.0, 0.0, 0.0}, 1e-12));
+    for (std::size_t i = 0; i + 1 < JointCount; ++i)
+    {
+      auto const bone = positions[i + 1] - positions[i];
+      ASSERT_NEAR(length(bone), 1.0, 1e-9);
+      ASSERT_TRUE(fuzzyEquals(rotations[i] * Vector3d{1.0, 0.0, 0.0}, bone, 1e-6));
+      ASSERT_NEAR(determinant(rotations[i]), 1.0, 1e-9);
+    }
+    ASSERT_TRUE(fuzzyEquals(rotations[JointCount - 1] * Vector3d{1.0, 0.0, 0.0},
+                            positions[JointCount - 1] - positions[JointCount - 2], 1e-6));
+  }
+
+  using SolverFn = IkResult<double> (*)(Vector3d *, Matrix33d *, std::size_t, Vector3d const &,
+                                        IkOptions<double> const &);
+
+  auto reach(SolverFn solve, IkOptions<double> const &options) -> void
+  {
+    auto positions = straightChain();
+    auto rotations = identities();
+    Vector3d const target{1.5, 2.0, 1.0};
+    auto const result = solve(positions.data(), rotations.data(), JointCount, target, options);
+    ASSERT_TRUE(result.reached);
+    ASSERT_LE(result.distance, options.tolerance);
+    ASSERT_LT(length(positions[JointCount - 1] - target), options.tolerance);
+    checkChain(positions, rotations);
+  }
+} // namespace
+
+TEST(InverseKinematicsTest, FabrikTest)
+{
+  reach(&fabrik<double>, {});
+}
+
+TEST(InverseKinematicsTest, CcdTest)
+{
+  reach(&ccd<double>, {64, 1e-3, 0.1});
+}
+
+TEST(InverseKinematicsTest, DampedLeastSquaresTest)
+{
+  reach(&dampedLeastSquares<double>, {64, 1e-3, 0.1});
+}
+
+TEST(InverseKinematicsTest, OutOfReachTest)
+{
+  auto positions = straightChain();
+  Vector3d const target{0.0, 10.0, 0.0};
+  auto const result = fabrik(positions.data(), static_cast<Matrix33d *>(nullptr), JointCount, target);
+  ASSERT_FALSE(result.reached);
+  ASSERT_NEAR(result.distance, 6.0, 1e-6);
+  ASSERT_TRUE(fuzzyEquals(positions[JointCount - 1], Vector3d{0.0, 4.0, 0.0}, 1e-6));
+}
+
+TEST(InverseKinematicsTest, BatchTest)
+{
+  std::size_t const count = 100;
+  std::vector<std::array<Vector3d, JointCount>> positions(count, straightChain());
+  std::vector<std::array<Matrix33d, JointCount>> rotations(count, identities());
+  std::vector<IkChain<double>> chains;
+  for (std::size_t i = 0; i < count; ++i)
+  {
+    double const a = 0.05 * double(i);
+    chains.push_back({positions[i].data(), rotations[i].data(), JointCount, Vector3d{2.0 * std::cos(a), 2.0 * std::sin(a), 1.0}});
+  }
+
+  for (auto solver : {IkSolver::Fabrik, IkSolver::Ccd, IkSolver::DampedLeastSquares})
+  {
+    std::vector<IkResult<double>> results(count);
+    batch::inverseKinematics(solver, chains.data(), results.data(), count, IkOptions<double>{64, 1e-3, 0.1}, 4);
+    for (std::size_t i = 0; i < count; ++i)
+    {
+      ASSERT_TRUE(results[i].reached);
+      checkChain(positions[i], rotations[i]);
+    }
+  }
+}
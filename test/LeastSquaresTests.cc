@@ -0,0 +1,123 @@
+#include "gtest/gtest.h"
+#include <cagey-math/LeastSquares.hh>
+#include <cmath>
+#include <random>
+#include <vector>
+
+using namespace cagey::math;
+
+namespace
+{
+  constexpr std::size_t PointCount = 16;
+
+  // points on the circle centred at (cx, cy) with radius r, with noise
+  auto circlePoints(double cx, double cy, double r, double noise, unsigned seed) -> std::array<Vector2d, PointCount>
+  {
+    std::mt19937 gen{seed};
+    std::uniform_real_distribution<double> jitter{-noise, noise};
+    std::array<Vector2d, PointCount> points;
+    for (std::size_t i = 0; i < PointCount; ++i)
+    {
+      double const a = 0.3 + 4.0 * double(i) / PointCount; // an arc, not the whole circle
+      points[i] = Vector2d{cx + (r + jitter(gen)) * std::cos(a), cy + (r + jitter(gen)) * std::sin(a)};
+    }
+    return points;
+  }
+
+  // parameters are (cx, cy, r)
+  struct CircleResiduals
+  {
+    std::array<Vector2d, PointCount> const &points;
+
+    template <typename X>
+    auto operator()(Vector<X, 3> const &p) const -> Vector<X, PointCount>
+    {
+      Vector<X, PointCount> r;
+      for (std::size_t i = 0; i < PointCount; ++i)
+      {
+        Vector<X, 2> const d{X(points[i].x) - p[0], X(points[i].y) - p[1]};
+        r[i] = length(d) - p[2];
+      }
+      return r;
+    }
+  };
+} // namespace
+
+TEST(LeastSquaresTest, LinearProblemTest)
+{
+  // fit y = a x + b, Gauss-Newton solves a linear problem in one step
+  auto const line = [](auto const &p) {
+    using X = std::decay_t<decltype(p[0])>;
+    return Vector<X, 3>{p[0] * 1.0 + p[1] - 3.0, p[0] * 2.0 + p[1] - 5.0, p[0] * 3.0 + p[1] - 7.0};
+  };
+  auto const result = gaussNewton(line, Vector2d{0.0, 0.0});
+  ASSERT_TRUE(result.converged);
+  ASSERT_LE(result.iterations, 3u);
+  ASSERT_NEAR(result.parameters[0], 2.0, 1e-12);
+  ASSERT_NEAR(result.parameters[1], 1.0, 1e-12);
+  ASSERT_NEAR(result.cost, 0.0, 1e-20);
+}
+
+TEST(LeastSquaresTest, RosenbrockTest)
+{
+  auto const rosenbrock = [](auto const &p) {
+    using X = std::decay_t<decltype(p[0])>;
+    return Vector<X, 2>{(p[1] - p[0] * p[0]) * 10.0, X(1.0) - p[0]};
+  };
+  auto const result = levenbergMarquardt(rosenbrock, Vector2d{-1.2, 1.0});
+  ASSERT_TRUE(result.converged);
+  ASSERT_NEAR(result.parameters[0], 1.0, 1e-6);
+  ASSERT_NEAR(result.parameters[1], 1.0, 1e-6);
+}
+
+TEST(LeastSquaresTest, CircleFitTest)
+{
+  auto const points = circlePoints(2.0, -1.0, 3.0, 0.0, 1);
+  auto const result = levenbergMarquardt(CircleResiduals{points}, Vector3d{0.0, 0.0, 1.0});
+  ASSERT_TRUE(result.converged);
+  ASSERT_NEAR(result.parameters[0], 2.0, 1e-8);
+  ASSERT_NEAR(result.parameters[1], -1.0, 1e-8);
+  ASSERT_NEAR(result.parameters[2], 3.0, 1e-8);
+
+  auto const single = levenbergMarquardt(CircleResiduals{points}, Vector3f{0.0f, 0.0f, 1.0f});
+  ASSERT_TRUE(single.converged);
+  ASSERT_NEAR(single.parameters[2], 3.0f, 1e-4f);
+}
+
+TEST(LeastSquaresTest, SingularTest)
+{
+  // the second parameter does not change the residuals
+  auto const flat = [](auto const &p) {
+    using X = std::decay_t<decltype(p[0])>;
+    return Vector<X, 2>{p[0] - 1.0, p[0] + 1.0 + p[1] * 0.0};
+  };
+  auto const gn = gaussNewton(flat, Vector2d{5.0, 5.0});
+  ASSERT_FALSE(gn.converged);
+  auto const lm = levenbergMarquardt(flat, Vector2d{5.0, 5.0});
+  ASSERT_NEAR(lm.parameters[0], 0.0, 1e-6);
+  ASSERT_NEAR(lm.cost, 1.0, 1e-9);
+}
+
+TEST(LeastSquaresTest, BatchTest)
+{
+  std::size_t const count = 300;
+  std::vector<std::array<Vector2d, PointCount>> data;
+  std::vector<Vector3d> initial;
+  for (std::size_t i = 0; i < count; ++i)
+  {
+    data.push_back(circlePoints(double(i % 7), -double(i % 5), 1.0 + double(i % 3), 0.01, unsigned(i)));
+    initial.push_back(Vector3d{double(i % 7) + 0.5, -double(i % 5) - 0.5, 1.0});
+  }
+  auto const residuals = [&data](std::size_t problem, auto const &p) { return CircleResiduals{data[problem]}(p); };
+
+  std::vector<LeastSquaresResult<double, 3>> serial(count);
+  std::vector<LeastSquaresResult<double, 3>> threaded(count);
+  batch::levenbergMarquardt(residuals, initial.data(), serial.data(), count);
+  batch::levenbergMarquardt(residuals, initial.data(), threaded.data(), count, {}, 4);
+  for (std::size_t i = 0; i < count; ++i)
+  {
+    ASSERT_TRUE(serial[i].converged);
+    ASSERT_NEAR(serial[i].parameters[2], 1.0 + double(i % 3), 0.02);
+    ASSERT_EQ(serial[i].parameters, threaded[i].parameters);
+  }
+}
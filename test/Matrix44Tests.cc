@@ -0,0 +1,51 @@
+#include "gtest/gtest.h"
+#include <cagey-math/Matrix44.hh>
+#include <cagey-math/MatrixFunc.hh>
+#include <cmath>
+
+using namespace cagey::math;
+
+TEST(Matrix44Test, Matrix44SizeTest)
+{
+  ASSERT_EQ(sizeof(Matrix44f), sizeof(float[16]));
+  ASSERT_EQ(sizeof(Matrix44d), sizeof(double[16]));
+  ASSERT_EQ(sizeof(Matrix44i), sizeof(int[16]));
+}
+
+TEST(Matrix44Test, ElementConstructorTest)
+{
+  Matrix44i m{0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15};
+  for (std::size_t c = 0; c < 4; ++c)
+  {
+    for (std::size_t r = 0; r < 4; ++r)
+    {
+      ASSERT_EQ(m[c][r], static_cast<int>(4 * c + r));
+    }
+  }
+  ASSERT_EQ(transpose(m)[1][2], 9);
+}
+
+TEST(Matrix44Test, IdentityProductTest)
+{
+  Matrix44d m{2, 0, 1, 0, 0, 3, 0, 1, 1, 0, 4, 0, 5, 6, 7, 1};
+  auto const p = m * Matrix44d::identity();
+  for (std::size_t c = 0; c < 4; ++c)
+  {
+    ASSERT_TRUE(fuzzyEquals(p[c], m[c]));
+  }
+  auto const v = m * Vector4d{1, 0, 0, 1};
+  ASSERT_TRUE(fuzzyEquals(v, Vector4d{7, 6, 8, 1}));
+}
+
+TEST(Matrix44Test, InverseTest)
+{
+  Matrix44d m{2, -1, 0, 3, 1, 4, 2, 0, 0, 1, 3, -2, 1, 0, 1, 5};
+  ASSERT_NEAR(determinant(m), determinant(transpose(m)), 1e-12);
+  auto const p = m * inverse(m);
+  auto const identity = Matrix44d::identity();
+  for (std::size_t c = 0; c < 4; ++c)
+  {
+    ASSERT_TRUE(fuzzyEquals(p[c], identity[c], 1e-13));
+  }
+  ASSERT_NEAR(determinant(Matrix44d{2, 0, 0, 0, 0, 3, 0, 0, 0, 0, 4, 0, 9, 9, 9, 1}), 24.0, 1e-15);
+}
@@ -0,0 +1,167 @@
+#include "gtest/gtest.h"
+#include <cagey-math/MatrixExp.hh>
+#include <cmath>
+#include <random>
+#include <vector>
+
+using namespace cagey::math;
+
+namespace
+{
+  template <typename T, std::size_t N>
+  auto maxDifference(Matrix<T, N, N> const &lhs, Matrix<T, N, N> const &rhs) -> T
+  {
+    T result{0};
+    for (std::size_t c = 0; c < N; ++c)
+    {
+      for (std::size_t r = 0; r < N; ++r)
+      {
+        result = std::max(result, std::abs(lhs[c][r] - rhs[c][r]));
+      }
+    }
+    return result;
+  }
+
+  auto randomAxis(std::mt19937 &gen) -> Vector<double, 3>
+  {
+    std::normal_distribution<double> dist;
+    return normalize(Vector<double, 3>{dist(gen), dist(gen), dist(gen)});
+  }
+
+  auto twistMatrix(Twist<double> const &twist) -> Matrix<double, 4, 4>
+  {
+    auto const &w = twist.angular;
+    auto const &v = twist.linear;
+    return Matrix<double, 4, 4>{0, w[2], -w[1], 0,
+                                -w[2], 0, w[0], 0,
+                                w[1], -w[0], 0, 0,
+                                v[0], v[1], v[2], 0};
+  }
+} // namespace
+
+TEST(MatrixExpTest, ExpRotationQuarterTurnTest)
+{
+  auto const r = expRotation(Vector<double, 3>{0, 0, std::acos(-1.0) / 2});
+  ASSERT_TRUE(fuzzyEquals(r * Vector<double, 3>::xAxis(), Vector<double, 3>::yAxis(), 1e-15));
+  ASSERT_TRUE(fuzzyEquals(r * Vector<double, 3>::zAxis(), Vector<double, 3>::zAxis(), 1e-15));
+  ASSERT_NEAR(determinant(r), 1.0, 1e-15);
+}
+
+TEST(MatrixExpTest, RotationRoundTripTest)
+{
+  auto const pi = std::acos(-1.0);
+  std::mt19937 gen{7};
+  std::uniform_real_distribution<double> angles{0.0, pi};
+  std::vector<double> testAngles{0.0, 1e-12, 1e-6, 1e-3, 0.5, pi / 2, 3.0, pi - 1e-6, pi - 1e-10, pi};
+  for (int i = 0; i < 200; ++i)
+  {
+    testAngles.push_back(angles(gen));
+  }
+  for (auto angle : testAngles)
+  {
+    auto const omega = randomAxis(gen) * angle;
+    auto const r = expRotation(omega);
+    ASSERT_LT(maxDifference(transpose(r) * r, Matrix<double, 3, 3>::identity()), 1e-14);
+    auto const back = logRotation(r);
+    if (angle > pi - 1e-9)
+    {
+      // at pi the axis sign is ambiguous
+      ASSERT_TRUE(fuzzyEquals(back, omega, 1e-7) || fuzzyEquals(back, -omega, 1e-7)) << angle;
+    }
+    else
+    {
+      ASSERT_TRUE(fuzzyEquals(back, omega, 1e-7)) << angle;
+    }
+    ASSERT_LT(maxDifference(expRotation(back), r), 1e-12) << angle;
+  }
+}
+
+TEST(MatrixExpTest, SmallAngleFloatTest)
+{
+  auto const omega = Vector<float, 3>{1e-4f, -2e-4f, 3e-5f};
+  auto const back = logRotation(expRotation(omega));
+  ASSERT_TRUE(fuzzyEquals(back, omega, 1e-9f));
+}
+
+TEST(MatrixExpTest, RigidRoundTripTest)
+{
+  std::mt19937 gen{11};
+  std::uniform_real_distribution<double> dist{-3.0, 3.0};
+  for (double angle : {0.0, 1e-9, 1e-4, 0.7, 2.0, 3.1})
+  {
+    auto const twist = Twist<double>{randomAxis(gen) * angle, {dist(gen), dist(gen), dist(gen)}};
+    auto const transform = expRigid(twist);
+    ASSERT_LT(maxDifference(transform, exp(twistMatrix(twist))), 1e-12) << angle;
+    auto const back = logRigid(transform);
+    ASSERT_TRUE(fuzzyEquals(back.angular, twist.angular, 1e-10)) << angle;
+    ASSERT_TRUE(fuzzyEquals(back.linear, twist.linear, 1e-9)) << angle;
+  }
+}
+
+TEST(MatrixExpTest, PadeMatchesRodriguesTest)
+{
+  std::mt19937 gen{3};
+  for (double angle : {0.1, 1.0, 3.0, 20.0})
+  {
+    auto const omega = randomAxis(gen) * angle;
+    auto const skew = Matrix<double, 3, 3>{0, omega[2], -omega[1],
+                                           -omega[2], 0, omega[0],
+                                           omega[1], -omega[0], 0};
+    ASSERT_LT(maxDifference(exp(skew), expRotation(omega)), 1e-12 * std::max(1.0, angle)) << angle;
+  }
+}
+
+TEST(MatrixExpTest, PadeDiagonalAndNilpotentTest)
+{
+  auto const e = exp(Matrix<double, 2, 2>{-3.0, 0.0, 0.0, 5.0});
+  ASSERT_NEAR(e[0][0], std::exp(-3.0), 1e-15);
+  ASSERT_NEAR(e[1][1] / std::exp(5.0), 1.0, 1e-14);
+  ASSERT_DOUBLE_EQ(e[0][1], 0.0);
+  ASSERT_DOUBLE_EQ(e[1][0], 0.0);
+
+  // exp of a nilpotent matrix is a finite sum
+  Matrix<double, 4, 4> n{0.0};
+  n[1][0] = 2.0;
+  n[2][1] = 3.0;
+  auto expected = Matrix<double, 4, 4>::identity();
+  expected[1][0] = 2.0;
+  expected[2][1] = 3.0;
+  expected[2][0] = 3.0;
+  ASSERT_LT(maxDifference(exp(n), expected), 1e-14);
+}
+
+TEST(MatrixExpTest, BatchTest)
+{
+  std::mt19937 gen{5};
+  std::uniform_real_distribution<double> dist{-2.0, 2.0};
+  std::vector<Twist<double>> twists(64);
+  for (auto &t : twists)
+  {
+    t = {{dist(gen), dist(gen), dist(gen)}, {dist(gen), dist(gen), dist(gen)}};
+  }
+  std::vector<Matrix<double, 4, 4>> transforms(twists.size());
+  std::vector<Twist<double>> back(twists.size());
+  batch::expRigid(twists.data(), twists.size(), transforms.data());
+  batch::logRigid(transforms.data(), transforms.size(), back.data());
+
+  std::vector<Vector<double, 3>> omegas(twists.size());
+  std::vector<Matrix<double, 3, 3>> rotations(twists.size());
+  std::vector<Matrix<double, 4, 4>> generators(twists.size());
+  std::vector<Matrix<double, 4, 4>> padeTransforms(twists.size());
+  for (std::size_t i = 0; i < twists.size(); ++i)
+  {
+    omegas[i] = twists[i].angular;
+    generators[i] = twistMatrix(twists[i]);
+  }
+  batch::expRotation(omegas.data(), omegas.size(), rotations.data());
+  batch::logRotation(rotations.data(), rotations.size(), omegas.data());
+  batch::exp(generators.data(), generators.size(), padeTransforms.data());
+  for (std::size_t i = 0; i < twists.size(); ++i)
+  {
+    ASSERT_EQ(maxDifference(transforms[i], expRigid(twists[i])), 0.0);
+    ASSERT_LT(maxDifference(padeTransforms[i], transforms[i]), 1e-12);
+    ASSERT_TRUE(fuzzyEquals(back[i].angular, twists[i].angular, 1e-10));
+    ASSERT_TRUE(fuzzyEquals(back[i].linear, twists[i].linear, 1e-9));
+    ASSERT_TRUE(fuzzyEquals(omegas[i], twists[i].angular, 1e-10));
+  }
+}
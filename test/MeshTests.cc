@@ -0,0 +1,117 @@
+#include "gtest/gtest.h"
+#include <cagey-math/Mesh.hh>
+#include <vector>
+
+using namespace cagey::math;
+
+namespace
+{
+  struct Octahedron
+  {
+    std::vector<Vector3d> positions{{1.0, 0.0, 0.0}, {-1.0, 0.0, 0.0}, {0.0, 1.0, 0.0},
+                                    {0.0, -1.0, 0.0}, {0.0, 0.0, 1.0}, {0.0, 0.0, -1.0}};
+    std::vector<std::uint32_t> indices{0, 2, 4, 2, 1, 4, 1, 3, 4, 3, 0, 4, 2, 0, 5, 1, 2, 5, 3, 1, 5, 0, 3, 5};
+  };
+
+  struct Grid
+  {
+    std::vector<Vector3f> positions;
+    std::vector<Vector3f> normals;
+    std::vector<Vector2f> uvs;
+    std::vector<std::uint32_t> indices;
+
+    Grid(std::uint32_t size, float uScale)
+    {
+      for (std::uint32_t y = 0; y < size; ++y)
+      {
+        for (std::uint32_t x = 0; x < size; ++x)
+        {
+          positions.push_back({float(x), float(y), 0.0f});
+          normals.push_back({0.0f, 0.0f, 1.0f});
+          uvs.push_back({uScale * float(x), float(y)});
+        }
+      }
+      for (std::uint32_t y = 0; y + 1 < size; ++y)
+      {
+        for (std::uint32_t x = 0; x + 1 < size; ++x)
+        {
+          auto const v = y * size + x;
+          indices.insert(indices.end(), {v, v + 1, v + size + 1, v, v + size + 1, v + size});
+        }
+      }
+    }
+
+    auto triangleCount() const -> std::size_t { return indices.size() / 3; }
+  };
+} // namespace
+
+TEST(MeshTest, NormalsTest)
+{
+  Octahedron const mesh;
+  std::vector<Vector3d> faces(8);
+  batch::faceNormals(mesh.positions.data(), mesh.indices.data(), 8, faces.data());
+  ASSERT_TRUE(fuzzyEquals(faces[0], normalize(Vector3d{1.0, 1.0, 1.0}), 1e-12));
+  ASSERT_TRUE(fuzzyEquals(faces[7], normalize(Vector3d{1.0, -1.0, -1.0}), 1e-12));
+
+  std::vector<Vector3d> normals(6);
+  batch::vertexNormals(mesh.positions.data(), 6, mesh.indices.data(), 8, normals.data());
+  for (std::size_t v = 0; v < 6; ++v)
+  {
+    ASSERT_TRUE(fuzzyEquals(normals[v], mesh.positions[v], 1e-12));
+  }
+}
+
+TEST(MeshTest, AreaVolumeTest)
+{
+  Octahedron const mesh;
+  ASSERT_NEAR(batch::surfaceArea(mesh.positions.data(), mesh.indices.data(), 8), 4.0 * std::sqrt(3.0), 1e-12);
+  ASSERT_NEAR(batch::volume(mesh.positions.data(), mesh.indices.data(), 8), 4.0 / 3.0, 1e-12);
+
+  Grid const grid{101, 1.0f};
+  ASSERT_NEAR(batch::surfaceArea(grid.positions.data(), grid.indices.data(), grid.triangleCount(), 4), 10000.0f, 1e-1f);
+}
+
+TEST(MeshTest, TangentsTest)
+{
+  for (auto const uScale : {1.0f, -1.0f})
+  {
+    Grid const grid{101, uScale};
+    std::vector<Vector4f> tangents(grid.positions.size());
+    batch::tangents(grid.positions.data(), grid.normals.data(), grid.uvs.data(), grid.positions.size(),
+                    grid.indices.data(), grid.triangleCount(), tangents.data(), 4);
+    for (auto const &t : tangents)
+    {
+      ASSERT_TRUE(fuzzyEquals(t, Vector4f{uScale, 0.0f, 0.0f, uScale}, 1e-5f));
+    }
+  }
+}
+
+TEST(MeshTest, ThreadsTest)
+{
+  Grid grid{101, 1.0f};
+  for (std::size_t i = 0; i < grid.positions.size(); ++i)
+  {
+    grid.positions[i][2] = std::sin(grid.positions[i][0] * 0.3f) * std::cos(grid.positions[i][1] * 0.2f);
+  }
+  std::vector<Vector3f> serial(grid.positions.size());
+  std::vector<Vector3f> parallel(grid.positions.size());
+  batch::vertexNormals(grid.positions.data(), grid.positions.size(), grid.indices.data(), grid.triangleCount(),
+                       serial.data(), 1);
+  batch::vertexNormals(grid.positions.data(), grid.positions.size(), grid.indices.data(), grid.triangleCount(),
+                       parallel.data(), 4);
+  for (std::size_t i = 0; i < serial.size(); ++i)
+  {
+    ASSERT_TRUE(fuzzyEquals(serial[i], parallel[i], 1e-5f));
+  }
+
+  // partial results are combined in range order, so repeated runs agree exactly
+  auto const area = batch::surfaceArea(grid.positions.data(), grid.indices.data(), grid.triangleCount(), 4);
+  for (int run = 0; run < 8; ++run)
+  {
+    std::vector<Vector3f> again(grid.positions.size());
+    batch::vertexNormals(grid.positions.data(), grid.positions.size(), grid.indices.data(), grid.triangleCount(),
+                         again.data(), 4);
+    ASSERT_TRUE(again == parallel);
+    ASSERT_EQ(batch::surfaceArea(grid.positions.data(), grid.indices.data(), grid.triangleCount(), 4), area);
+  }
+}
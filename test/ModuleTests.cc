@@ -0,0 +1,36 @@
+// Plain executable rather than gtest, mixing the gtest headers with the
+// module import trips GCC 12 module bugs.  Returns non zero on failure.
+
+import cagey.math;
+
+using namespace cagey::math;
+
+namespace
+{
+  auto near(double const lhs, double const rhs, double const epsilon) -> bool
+  {
+    return lhs - rhs <= epsilon && rhs - lhs <= epsilon;
+  }
+
+  auto vectorTest() -> bool
+  {
+    Vector3f const a{1.0f, 2.0f, 3.0f};
+    Vector3f const b{4.0f, 5.0f, 6.0f};
+    return dot(a, b) == 32.0f && fuzzyEquals(cross(a, b), Vector3f{-3.0f, 6.0f, -3.0f}) &&
+           a + b == Vector3f{5.0f, 7.0f, 9.0f} && near(length(normalize(b)), 1.0, 1e-6);
+  }
+
+  auto matrixTest() -> bool
+  {
+    auto m = Matrix33d::identity();
+    m[0][1] = 2.0;
+    auto const v = inverse(m) * Vector3d{1.0, 2.0, 3.0};
+    return fuzzyEquals(v, Vector3d{1.0, 0.0, 3.0}) && determinant(transpose(m)) == 1.0 &&
+           near(constants::pi<double> * constants::radToDeg<double>, 180.0, 1e-12);
+  }
+} // namespace
+
+auto main() -> int
+{
+  return (vectorTest() ? 0 : 1) | (matrixTest() ? 0 : 2);
+}
@@ -0,0 +1,244 @@
+#include "gtest/gtest.h"
+#include <cagey-math/Predicates.hh>
+#include <cstdint>
+#include <random>
+#include <vector>
+
+using namespace cagey::math;
+
+namespace
+{
+  using Int = __int128;
+
+  auto sign(double v) -> int { return (v > 0.0) - (v < 0.0); }
+  auto sign(Int v) -> int { return (v > 0) - (v < 0); }
+  auto toInt(double v) -> Int { return static_cast<Int>(static_cast<std::int64_t>(v)); }
+
+  // exact references for integer valued coordinates
+  auto orient2dInt(Vector2d const &a, Vector2d const &b, Vector2d const &c) -> Int
+  {
+    return (toInt(a[0]) - toInt(c[0])) * (toInt(b[1]) - toInt(c[1])) -
+           (toInt(a[1]) - toInt(c[1])) * (toInt(b[0]) - toInt(c[0]));
+  }
+
+  auto det3(Int const m[3][3]) -> Int
+  {
+    return m[0][0] * (m[1][1] * m[2][2] - m[2][1] * m[1][2]) - m[0][1] * (m[1][0] * m[2][2] - m[2][0] * m[1][2]) +
+           m[0][2] * (m[1][0] * m[2][1] - m[2][0] * m[1][1]);
+  }
+
+  auto orient3dInt(Vector3d const &a, Vector3d const &b, Vector3d const &c, Vector3d const &d) -> Int
+  {
+    Int m[3][3];
+    Vector3d const *rows[] = {&a, &b, &c};
+    for (int i = 0; i < 3; ++i)
+    {
+      for (int j = 0; j < 3; ++j)
+      {
+        m[i][j] = toInt((*rows[i])[j]) - toInt(d[j]);
+      }
+    }
+    return det3(m);
+  }
+
+  auto inCircleInt(Vector2d const &a, Vector2d const &b, Vector2d const &c, Vector2d const &d) -> Int
+  {
+    Int m[3][3];
+    Vector2d const *rows[] = {&a, &b, &c};
+    for (int i = 0; i < 3; ++i)
+    {
+      auto const x = toInt((*rows[i])[0]) - toInt(d[0]);
+      auto const y = toInt((*rows[i])[1]) - toInt(d[1]);
+      m[i][0] = x;
+      m[i][1] = y;
+      m[i][2] = x * x + y * y;
+    }
+    return det3(m);
+  }
+
+  auto inSphereInt(Vector3d const &a, Vector3d const &b, Vector3d const &c, Vector3d const &d,
+                   Vector3d const &e) -> Int
+  {
+    Int m[4][4];
+    Vector3d const *rows[] = {&a, &b, &c, &d};
+    for (int i = 0; i < 4; ++i)
+    {
+      m[i][3] = 0;
+      for (int j = 0; j < 3; ++j)
+      {
+        m[i][j] = toInt((*rows[i])[j]) - toInt(e[j]);
+        m[i][3] += m[i][j] * m[i][j];
+      }
+    }
+    Int det = 0;
+    for (int k = 0; k < 4; ++k)
+    {
+      Int minor[3][3];
+      for (int i = 1; i < 4; ++i)
+      {
+        for (int j = 0, col = 0; j < 4; ++j)
+        {
+          if (j != k)
+          {
+            minor[i - 1][col++] = m[i][j];
+          }
+        }
+      }
+      det += (k % 2 == 0 ? 1 : -1) * m[0][k] * det3(minor);
+    }
+    return det;
+  }
+} // namespace
+
+TEST(PredicatesTest, Orient2dNearlyCollinearTest)
+{
+  // the classic failure case of the naive formula, the sign is sign(j - i)
+  Vector2d const q{12.0, 12.0};
+  Vector2d const r{24.0, 24.0};
+  auto const ulp = std::ldexp(1.0, -53);
+  for (int i = 0; i < 32; ++i)
+  {
+    for (int j = 0; j < 32; ++j)
+    {
+      Vector2d const p{0.5 + i * ulp, 0.5 + j * ulp};
+      ASSERT_EQ(sign(orient2d(p, q, r)), (j > i) - (j < i));
+    }
+  }
+  ASSERT_GT(orient2d({0.0, 0.0}, {1.0, 0.0}, {0.0, 1.0}), 0.0);
+  ASSERT_EQ(orient2d({1.0, 1.0}, {1.0, 1.0}, {3.0, 2.0}), 0.0);
+}
+
+TEST(PredicatesTest, Orient2dTest)
+{
+  std::mt19937_64 gen{3};
+  std::uniform_int_distribution<std::int64_t> big{-(1 << 28), 1 << 28};
+  std::uniform_int_distribution<std::int64_t> dir{-(1 << 12), 1 << 12};
+  std::uniform_int_distribution<std::int64_t> t{-(1 << 14), 1 << 14};
+  std::uniform_int_distribution<std::int64_t> jitter{-1, 1};
+  std::vector<Vector2d> a, b, c;
+  for (int n = 0; n < 2000; ++n)
+  {
+    auto const px = big(gen), py = big(gen), dx = dir(gen), dy = dir(gen);
+    auto const point = [&]() {
+      auto const s = t(gen);
+      return Vector2d{double(px + s * dx + jitter(gen)), double(py + s * dy + jitter(gen))};
+    };
+    a.push_back(point());
+    b.push_back(point());
+    c.push_back(point());
+  }
+  std::vector<double> out(a.size());
+  batch::orient2d(a.data(), b.data(), c.data(), out.data(), a.size());
+  for (std::size_t i = 0; i < a.size(); ++i)
+  {
+    auto const expected = sign(orient2dInt(a[i], b[i], c[i]));
+    ASSERT_EQ(sign(orient2d(a[i], b[i], c[i])), expected);
+    ASSERT_EQ(sign(out[i]), expected);
+  }
+}
+
+TEST(PredicatesTest, Orient3dTest)
+{
+  std::mt19937_64 gen{5};
+  std::uniform_int_distribution<std::int64_t> big{-(1 << 19), 1 << 19};
+  std::uniform_int_distribution<std::int64_t> dir{-(1 << 8), 1 << 8};
+  std::uniform_int_distribution<std::int64_t> t{-(1 << 9), 1 << 9};
+  std::uniform_int_distribution<std::int64_t> jitter{-1, 1};
+  std::vector<Vector3d> a, b, c, d;
+  for (int n = 0; n < 2000; ++n)
+  {
+    std::int64_t p[3], u[3], v[3];
+    for (int k = 0; k < 3; ++k)
+    {
+      p[k] = big(gen);
+      u[k] = dir(gen);
+      v[k] = dir(gen);
+    }
+    auto const point = [&]() {
+      auto const s = t(gen), r = t(gen);
+      return Vector3d{double(p[0] + s * u[0] + r * v[0] + jitter(gen)), double(p[1] + s * u[1] + r * v[1]),
+                      double(p[2] + s * u[2] + r * v[2])};
+    };
+    a.push_back(point());
+    b.push_back(point());
+    c.push_back(point());
+    d.push_back(point());
+  }
+  std::vector<double> out(a.size());
+  batch::orient3d(a.data(), b.data(), c.data(), d.data(), out.data(), a.size());
+  for (std::size_t i = 0; i < a.size(); ++i)
+  {
+    auto const expected = sign(orient3dInt(a[i], b[i], c[i], d[i]));
+    ASSERT_EQ(sign(orient3d(a[i], b[i], c[i], d[i])), expected);
+    ASSERT_EQ(sign(out[i]), expected);
+  }
+  ASSERT_GT(orient3d({0.0, 0.0, 0.0}, {1.0, 0.0, 0.0}, {0.0, 1.0, 0.0}, {0.0, 0.0, -1.0}), 0.0);
+}
+
+TEST(PredicatesTest, InCircleTest)
+{
+  // cocircular points on a circle of radius 5 * 2^16 around a large center
+  auto const scale = std::ldexp(1.0, 16);
+  Vector2d const center{12345678.0, -8765432.0};
+  Vector2d const offsets[] = {{5.0, 0.0}, {3.0, 4.0}, {0.0, 5.0}, {-4.0, 3.0}, {-5.0, 0.0}, {-3.0, -4.0}, {4.0, -3.0}};
+  std::vector<Vector2d> a, b, c, d;
+  for (int i = 0; i < 7; ++i)
+  {
+    for (int j = -1; j <= 1; ++j)
+    {
+      a.push_back(center + offsets[i] * scale);
+      b.push_back(center + offsets[(i + 1) % 7] * scale);
+      c.push_back(center + offsets[(i + 2) % 7] * scale);
+      d.push_back(center + offsets[(i + 4) % 7] * scale + Vector2d{double(j), 0.0});
+    }
+  }
+  std::vector<double> out(a.size());
+  batch::inCircle(a.data(), b.data(), c.data(), d.data(), out.data(), a.size());
+  for (std::size_t i = 0; i < a.size(); ++i)
+  {
+    auto const expected = sign(inCircleInt(a[i], b[i], c[i], d[i]));
+    ASSERT_EQ(sign(inCircle(a[i], b[i], c[i], d[i])), expected);
+    ASSERT_EQ(sign(out[i]), expected);
+  }
+  ASSERT_EQ(inCircle(a[1], b[1], c[1], d[1]), 0.0);
+  ASSERT_GT(inCircle({1.0, 0.0}, {0.0, 1.0}, {-1.0, 0.0}, {0.0, 0.0}), 0.0);
+}
+
+TEST(PredicatesTest, InSphereTest)
+{
+  // cospherical points on a sphere of radius 7 * 2^14 around a large center
+  auto const scale = std::ldexp(1.0, 14);
+  Vector3d const center{123456.0, -654321.0, 777777.0};
+  Vector3d const offsets[] = {{2.0, 3.0, 6.0},  {6.0, -2.0, 3.0}, {-3.0, 6.0, 2.0}, {7.0, 0.0, 0.0},
+                              {0.0, 0.0, -7.0}, {-2.0, -3.0, -6.0}, {-6.0, 2.0, -3.0}};
+  std::vector<Vector3d> a, b, c, d, e;
+  for (int i = 0; i < 7; ++i)
+  {
+    for (int j = -1; j <= 1; ++j)
+    {
+      auto const pa = center + offsets[i] * scale;
+      auto pb = center + offsets[(i + 1) % 7] * scale;
+      auto pc = center + offsets[(i + 2) % 7] * scale;
+      auto const pd = center + offsets[(i + 3) % 7] * scale;
+      if (orient3d(pa, pb, pc, pd) < 0.0)
+      {
+        std::swap(pb, pc);
+      }
+      a.push_back(pa);
+      b.push_back(pb);
+      c.push_back(pc);
+      d.push_back(pd);
+      e.push_back(center + offsets[(i + 5) % 7] * scale + Vector3d{double(j), 0.0, 0.0});
+    }
+  }
+  std::vector<double> out(a.size());
+  batch::inSphere(a.data(), b.data(), c.data(), d.data(), e.data(), out.data(), a.size());
+  for (std::size_t i = 0; i < a.size(); ++i)
+  {
+    auto const expected = sign(inSphereInt(a[i], b[i], c[i], d[i], e[i]));
+    ASSERT_EQ(sign(inSphere(a[i], b[i], c[i], d[i], e[i])), expected);
+    ASSERT_EQ(sign(out[i]), expected);
+  }
+  ASSERT_EQ(inSphere(a[1], b[1], c[1], d[1], e[1]), 0.0);
+  ASSERT_GT(inSphere({1.0, 0.0, 0.0}, {0.0, 1.0, 0.0}, {-1.0, 0.0, 0.0}, {0.0, 0.0, -1.0}, {0.0, 0.0, 0.0}), 0.0);
+}
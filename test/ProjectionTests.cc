@@ -0,0 +1,112 @@
+#include "gtest/gtest.h"
+#include <cagey-math/MatrixFunc.hh>
+#include <cagey-math/Projection.hh>
+#include <cmath>
+#include <limits>
+
+using namespace cagey::math;
+
+namespace
+{
+  auto project(Matrix44d const &m, Vector3d const &p) -> Vector3d
+  {
+    auto const clip = m * Vector4d{p[0], p[1], p[2], 1.0};
+    return {clip[0] / clip[3], clip[1] / clip[3], clip[2] / clip[3]};
+  }
+
+  auto isInverse(InvertibleTransform<double> const &t, double const epsilon) -> bool
+  {
+    auto const p = t.matrix * t.inverse;
+    auto const identity = Matrix44d::identity();
+    for (std::size_t c = 0; c < 4; ++c)
+    {
+      if (!fuzzyEquals(p[c], identity[c], epsilon))
+      {
+        return false;
+      }
+    }
+    return true;
+  }
+
+  // a matrix from element builders must be usable in constant expressions
+  constexpr auto ConstantFrustum = frustum(-1.0f, 1.0f, -1.0f, 1.0f, 1.0f, 10.0f);
+  static_assert(ConstantFrustum.matrix[2][3] == -1.0f, "frustum should be constexpr");
+  static_assert(orthographic(0.0, 2.0, 0.0, 2.0, 0.0, 1.0).inverse[0][0] == 1.0, "orthographic should be constexpr");
+} // namespace
+
+TEST(ProjectionTest, PerspectiveDepthTest)
+{
+  auto const fov = std::acos(-1.0) / 3.0;
+  struct Case
+  {
+    DepthOrder order;
+    ClipDepth depth;
+    double near;
+    double far;
+  };
+  for (auto const c : {Case{DepthOrder::Forward, ClipDepth::ZeroToOne, 0.0, 1.0},
+                       Case{DepthOrder::Reversed, ClipDepth::ZeroToOne, 1.0, 0.0},
+                       Case{DepthOrder::Forward, ClipDepth::NegativeOneToOne, -1.0, 1.0},
+                       Case{DepthOrder::Reversed, ClipDepth::NegativeOneToOne, 1.0, -1.0}})
+  {
+    auto const p = perspective(fov, 16.0 / 9.0, 0.1, 100.0, c.order, c.depth);
+    ASSERT_NEAR(project(p.matrix, {0, 0, -0.1})[2], c.near, 1e-12);
+    ASSERT_NEAR(project(p.matrix, {0, 0, -100.0})[2], c.far, 1e-12);
+    ASSERT_TRUE(isInverse(p, 1e-12));
+
+    auto const infinite = perspectiveInfinite(fov, 16.0 / 9.0, 0.1, c.order, c.depth);
+    ASSERT_NEAR(project(infinite.matrix, {0, 0, -0.1})[2], c.near, 1e-12);
+    ASSERT_NEAR(project(infinite.matrix, {0, 0, -1e12})[2], c.far, 1e-12);
+    ASSERT_TRUE(isInverse(infinite, 1e-12));
+  }
+
+  // the top edge of the field of view maps to y = 1
+  auto const p = perspective(fov, 2.0, 1.0, 10.0);
+  auto const edge = project(p.matrix, {0, std::tan(fov / 2) * 5.0, -5.0});
+  ASSERT_NEAR(edge[1], 1.0, 1e-12);
+  ASSERT_NEAR(project(p.matrix, {std::tan(fov / 2) * 10.0, 0, -5.0})[0], 1.0, 1e-12);
+}
+
+TEST(ProjectionTest, ReversedInfiniteUnprojectTest)
+{
+  auto const p = perspectiveInfinite(1.2, 1.5, 0.01, DepthOrder::Reversed);
+  for (double z : {-0.01, -1.0, -1000.0, -1e6})
+  {
+    Vector3d const point{0.25 * z, -0.1 * z, z};
+    auto const ndc = project(p.matrix, point);
+    ASSERT_GT(ndc[2], 0.0);
+    ASSERT_TRUE(fuzzyEquals(project(p.inverse, ndc), point, 1e-9 * std::abs(z)));
+  }
+}
+
+TEST(ProjectionTest, OffCenterFrustumTest)
+{
+  auto const f = frustum(-1.0, 3.0, -2.0, 1.0, 1.0, 50.0);
+  ASSERT_TRUE(fuzzyEquals(project(f.matrix, {-1.0, -2.0, -1.0}), Vector3d{-1, -1, 0}, 1e-12));
+  ASSERT_TRUE(fuzzyEquals(project(f.matrix, {150.0, 50.0, -50.0}), Vector3d{1, 1, 1}, 1e-12));
+  ASSERT_TRUE(isInverse(f, 1e-12));
+}
+
+TEST(ProjectionTest, OrthographicTest)
+{
+  for (auto order : {DepthOrder::Forward, DepthOrder::Reversed})
+  {
+    auto const o = orthographic(-4.0, 2.0, -1.0, 3.0, 0.5, 20.0, order, ClipDepth::NegativeOneToOne);
+    auto const expectedNear = order == DepthOrder::Forward ? -1.0 : 1.0;
+    ASSERT_TRUE(fuzzyEquals(project(o.matrix, {-4.0, -1.0, -0.5}), Vector3d{-1, -1, expectedNear}, 1e-12));
+    ASSERT_TRUE(fuzzyEquals(project(o.matrix, {2.0, 3.0, -20.0}), Vector3d{1, 1, -expectedNear}, 1e-12));
+    ASSERT_TRUE(isInverse(o, 1e-12));
+  }
+}
+
+TEST(ProjectionTest, LookAtTest)
+{
+  Vector3d const eye{1, 2, 3};
+  Vector3d const target{4, 2, -1};
+  auto const view = lookAt(eye, target, Vector3d::yAxis());
+  ASSERT_TRUE(fuzzyEquals(project(view.matrix, eye), Vector3d::zero(), 1e-12));
+  ASSERT_TRUE(fuzzyEquals(project(view.matrix, target), Vector3d{0, 0, -5}, 1e-12));
+  ASSERT_TRUE(fuzzyEquals(project(view.matrix, eye + Vector3d::yAxis()), Vector3d{0, 1, 0}, 1e-12));
+  ASSERT_TRUE(isInverse(view, 1e-12));
+  ASSERT_NEAR(determinant(view.matrix), 1.0, 1e-12);
+}
@@ -0,0 +1,162 @@
+#include "gtest/gtest.h"
+#include <cagey-math/Svd.hh>
+#include <random>
+#include <vector>
+
+using namespace cagey::math;
+
+namespace
+{
+  template <typename T>
+  auto randomMatrix(std::mt19937 &gen) -> Matrix<T, 3, 3>
+  {
+    std::uniform_real_distribution<T> dist{T{-2}, T{2}};
+    Matrix<T, 3, 3> m;
+    for (std::size_t c = 0; c < 3; ++c)
+    {
+      m[c] = {dist(gen), dist(gen), dist(gen)};
+    }
+    return m;
+  }
+
+  template <typename T>
+  auto maxDifference(Matrix<T, 3, 3> const &lhs, Matrix<T, 3, 3> const &rhs) -> T
+  {
+    T result{0};
+    for (std::size_t c = 0; c < 3; ++c)
+    {
+      for (std::size_t r = 0; r < 3; ++r)
+      {
+        result = std::max(result, std::abs(lhs[c][r] - rhs[c][r]));
+      }
+    }
+    return result;
+  }
+
+  template <typename T>
+  auto checkRotation(Matrix<T, 3, 3> const &m, T tolerance) -> void
+  {
+    ASSERT_LT(maxDifference(transpose(m) * m, Matrix<T, 3, 3>::identity()), tolerance);
+    ASSERT_NEAR(determinant(m), T{1}, tolerance);
+  }
+
+  template <typename T>
+  auto checkSvd(Matrix<T, 3, 3> const &a, Svd<T> const &d, T tolerance) -> void
+  {
+    checkRotation(d.u, tolerance);
+    checkRotation(d.v, tolerance);
+    ASSERT_GE(std::abs(d.sigma[0]) + tolerance, std::abs(d.sigma[1]));
+    ASSERT_GE(std::abs(d.sigma[1]) + tolerance, std::abs(d.sigma[2]));
+    ASSERT_GE(d.sigma[1], -tolerance);
+    Matrix<T, 3, 3> const scaled{d.u[0] * d.sigma[0], d.u[1] * d.sigma[1], d.u[2] * d.sigma[2]};
+    ASSERT_LT(maxDifference(scaled * transpose(d.v), a), tolerance);
+  }
+} // namespace
+
+TEST(SvdTest, Matrix33Test)
+{
+  Matrix33d const m{2.0, 0.0, 1.0, 1.0, 3.0, 0.0, 0.0, 1.0, 4.0};
+  ASSERT_DOUBLE_EQ(determinant(m), 25.0);
+  ASSERT_LT(maxDifference(inverse(m) * m, Matrix33d::identity()), 1e-15);
+  ASSERT_EQ(transpose(m)[0], (Vector3d{2.0, 1.0, 0.0}));
+  ASSERT_EQ(m * Vector3d::xAxis(), (Vector3d{2.0, 0.0, 1.0}));
+}
+
+TEST(SvdTest, RandomTest)
+{
+  std::mt19937 gen{23};
+  for (int i = 0; i < 1000; ++i)
+  {
+    auto const f = randomMatrix<float>(gen);
+    checkSvd(f, svd(f), 1e-5f);
+    auto const d = randomMatrix<double>(gen);
+    checkSvd(d, svd(d), 1e-12);
+  }
+}
+
+TEST(SvdTest, DegenerateTest)
+{
+  checkSvd(Matrix33d::zero(), svd(Matrix33d::zero()), 1e-12);
+  checkSvd(Matrix33d::identity(), svd(Matrix33d::identity()), 1e-12);
+
+  // rank one and rank two
+  Matrix33d const rank1{1.0, 2.0, 3.0, 2.0, 4.0, 6.0, -1.0, -2.0, -3.0};
+  auto const d1 = svd(rank1);
+  checkSvd(rank1, d1, 1e-12);
+  ASSERT_NEAR(d1.sigma[1], 0.0, 1e-12);
+  Matrix33d const rank2{1.0, 0.0, 0.0, 0.0, 2.0, 0.0, 1.0, 2.0, 0.0};
+  checkSvd(rank2, svd(rank2), 1e-12);
+
+  // reflection
+  Matrix33d const mirror{-1.0, 0.0, 0.0, 0.0, 2.0, 0.0, 0.0, 0.0, 3.0};
+  auto const d = svd(mirror);
+  checkSvd(mirror, d, 1e-12);
+  ASSERT_NEAR(d.sigma[2], -1.0, 1e-12);
+}
+
+TEST(SvdTest, PolarTest)
+{
+  std::mt19937 gen{29};
+  for (int i = 0; i < 100; ++i)
+  {
+    auto const a = randomMatrix<double>(gen);
+    auto const p = polar(a);
+    checkRotation(p.rotation, 1e-12);
+    ASSERT_LT(maxDifference(p.stretch, transpose(p.stretch)), 1e-12);
+    ASSERT_LT(maxDifference(p.rotation * p.stretch, a), 1e-12);
+  }
+}
+
+TEST(SvdTest, BatchTest)
+{
+  constexpr std::size_t count = 29;
+  std::mt19937 gen{31};
+  std::vector<Matrix33f> matrices;
+  std::array<std::vector<float>, 9> in, u, v, r, s;
+  std::array<std::vector<float>, 3> sigma;
+  for (std::size_t i = 0; i < count; ++i)
+  {
+    matrices.push_back(randomMatrix<float>(gen));
+  }
+  batch::Matrices33SoA<float> soa;
+  batch::Matrices33SoAOut<float> uOut, vOut, rOut, sOut;
+  for (std::size_t e = 0; e < 9; ++e)
+  {
+    for (auto const &m : matrices)
+    {
+      in[e].push_back(m[e / 3][e % 3]);
+    }
+    for (auto *out : {&u, &v, &r, &s})
+    {
+      (*out)[e].resize(count);
+    }
+    soa.elements[e] = in[e].data();
+    uOut.elements[e] = u[e].data();
+    vOut.elements[e] = v[e].data();
+    rOut.elements[e] = r[e].data();
+    sOut.elements[e] = s[e].data();
+  }
+  for (auto &values : sigma)
+  {
+    values.resize(count);
+  }
+  batch::svd(soa, uOut, {sigma[0].data(), sigma[1].data(), sigma[2].data()}, vOut, count);
+  batch::polar(soa, rOut, sOut, count);
+
+  for (std::size_t i = 0; i < count; ++i)
+  {
+    auto const expected = svd(matrices[i]);
+    auto const expectedPolar = polar(matrices[i]);
+    for (std::size_t e = 0; e < 9; ++e)
+    {
+      ASSERT_NEAR(u[e][i], expected.u[e / 3][e % 3], 1e-6f);
+      ASSERT_NEAR(v[e][i], expected.v[e / 3][e % 3], 1e-6f);
+      ASSERT_NEAR(r[e][i], expectedPolar.rotation[e / 3][e % 3], 1e-5f);
+      ASSERT_NEAR(s[e][i], expectedPolar.stretch[e / 3][e % 3], 1e-5f);
+    }
+    for (std::size_t k = 0; k < 3; ++k)
+    {
+      ASSERT_NEAR(sigma[k][i], expected.sigma[k], 1e-6f);
+    }
+  }
+}
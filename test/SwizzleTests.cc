@@ -0,0 +1,69 @@
+#include "gtest/gtest.h"
+#include <cagey-math/Swizzle.hh>
+
+using namespace cagey::math;
+
+TEST(SwizzleTest, ReverseTest)
+{
+  constexpr Vector3f v{1.0f, 2.0f, 3.0f};
+  constexpr auto zyx = swizzle<2, 1, 0>(v);
+  static_assert(std::is_same<decltype(zyx), Vector3f const>::value);
+  static_assert(zyx[0] == 3.0f);
+  ASSERT_EQ(zyx, (Vector3f{3.0f, 2.0f, 1.0f}));
+
+  Vector4d w{1.0, 2.0, 3.0, 4.0};
+  ASSERT_EQ((swizzle<3, 2, 1, 0>(w)), (Vector4d{4.0, 3.0, 2.0, 1.0}));
+}
+
+TEST(SwizzleTest, RepeatTest)
+{
+  constexpr Vector2i v{1, 2};
+  ASSERT_EQ((swizzle<0, 0, 1, 1>(v)), (Vector4i{1, 1, 2, 2}));
+  ASSERT_EQ((swizzle<1, 1, 1>(v)), (Vector3i{2, 2, 2}));
+}
+
+TEST(SwizzleTest, ResizeTest)
+{
+  constexpr Vector4f v{1.0f, 2.0f, 3.0f, 4.0f};
+  ASSERT_EQ((swizzle<0, 1>(v)), v.xy());
+  ASSERT_EQ((swizzle<0, 1, 2>(v)), v.xyz());
+  ASSERT_EQ((swizzle<3, 0, 1, 2, 3, 0>(v)), (Vector<float, 6>{4.0f, 1.0f, 2.0f, 3.0f, 4.0f, 1.0f}));
+}
+
+TEST(SwizzleTest, WriteTest)
+{
+  Vector3f v{1.0f, 2.0f, 3.0f};
+  swizzleRef<2, 1, 0>(v) = Vector3f{4.0f, 5.0f, 6.0f};
+  ASSERT_EQ(v, (Vector3f{6.0f, 5.0f, 4.0f}));
+
+  Vector4f w{1.0f, 2.0f, 3.0f, 4.0f};
+  swizzleRef<3, 0>(w) = Vector2f{8.0f, 9.0f};
+  ASSERT_EQ(w, (Vector4f{9.0f, 2.0f, 3.0f, 8.0f}));
+}
+
+TEST(SwizzleTest, SelfAssignTest)
+{
+  Vector3f v{1.0f, 2.0f, 3.0f};
+  swizzleRef<0, 1, 2>(v) = swizzle<2, 1, 0>(v);
+  ASSERT_EQ(v, (Vector3f{3.0f, 2.0f, 1.0f}));
+}
+
+TEST(SwizzleTest, CompoundAssignTest)
+{
+  Vector4i v{1, 2, 3, 4};
+  swizzleRef<1, 3>(v) += Vector2i{10, 20};
+  ASSERT_EQ(v, (Vector4i{1, 12, 3, 24}));
+  swizzleRef<0, 2>(v) -= Vector2i{1, 1};
+  ASSERT_EQ(v, (Vector4i{0, 12, 2, 24}));
+  swizzleRef<2, 0>(v) *= Vector2i{3, 5};
+  ASSERT_EQ(v, (Vector4i{0, 12, 6, 24}));
+  swizzleRef<3, 1>(v) /= Vector2i{4, 6};
+  ASSERT_EQ(v, (Vector4i{0, 2, 6, 6}));
+}
+
+TEST(SwizzleTest, ReadProxyTest)
+{
+  Vector3f v{1.0f, 2.0f, 3.0f};
+  Vector2f zx = swizzleRef<2, 0>(v);
+  ASSERT_EQ(zx, (Vector2f{3.0f, 1.0f}));
+}
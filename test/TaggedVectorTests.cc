@@ -0,0 +1,116 @@
+#include "gtest/gtest.h"
+#include <cagey-math/Vector2.hh>
+#include <cagey-math/Vector3.hh>
+#include <cagey-math/Vector4.hh>
+#include <cagey-math/Swizzle.hh>
+#include <cagey-math/VectorFunc.hh>
+#include <type_traits>
+#include <utility>
+
+using namespace cagey::math;
+
+namespace
+{
+  struct World;
+  struct Local;
+
+  using WorldVector = Vector<float, 3, World>;
+  using LocalVector = Vector<float, 3, Local>;
+
+  template <typename L, typename R, typename = void>
+  struct CanAdd : std::false_type
+  {
+  };
+
+  template <typename L, typename R>
+  struct CanAdd<L, R, std::void_t<decltype(std::declval<L>() + std::declval<R>())>> : std::true_type
+  {
+  };
+
+  template <typename L, typename R, typename = void>
+  struct CanDot : std::false_type
+  {
+  };
+
+  template <typename L, typename R>
+  struct CanDot<L, R, std::void_t<decltype(dot(std::declval<L>(), std::declval<R>()))>> : std::true_type
+  {
+  };
+
+  template <typename L, typename R, typename = void>
+  struct CanAddAssign : std::false_type
+  {
+  };
+
+  template <typename L, typename R>
+  struct CanAddAssign<L, R, std::void_t<decltype(std::declval<L &>() += std::declval<R>())>> : std::true_type
+  {
+  };
+
+  // mixing spaces does not compile
+  static_assert(CanAdd<WorldVector, WorldVector>::value, "same space vectors add");
+  static_assert(!CanAdd<WorldVector, LocalVector>::value, "vectors in different spaces must not add");
+  static_assert(!CanAdd<WorldVector, Vector3f>::value, "tagged and untagged vectors must not add");
+  static_assert(CanDot<LocalVector, LocalVector>::value, "same space vectors dot");
+  static_assert(!CanDot<WorldVector, LocalVector>::value, "vectors in different spaces must not dot");
+  static_assert(!CanAddAssign<WorldVector, LocalVector>::value, "vectors in different spaces must not add");
+  static_assert(!std::is_convertible<WorldVector, LocalVector>::value, "spaces must not convert implicitly");
+
+  // the tag costs nothing
+  static_assert(sizeof(WorldVector) == sizeof(Vector3f), "tagged vectors have the same size");
+  static_assert(alignof(WorldVector) == alignof(Vector3f), "tagged vectors have the same alignment");
+  static_assert(std::is_trivially_copyable<WorldVector>::value == std::is_trivially_copyable<Vector3f>::value,
+                "tagged vectors copy like untagged vectors");
+  static_assert(std::is_same<Vector<float, 3, void>, Vector3f>::value, "untagged vectors are tagged void");
+} // namespace
+
+TEST(TaggedVectorTest, OperatorsKeepSpaceTest)
+{
+  WorldVector const a{1.0f, 2.0f, 3.0f};
+  WorldVector const b{4.0f, 5.0f, 6.0f};
+  ASSERT_TRUE((std::is_same<decltype(a + b), WorldVector>::value));
+  ASSERT_TRUE((std::is_same<decltype(a * 2.0f), WorldVector>::value));
+  ASSERT_TRUE((std::is_same<decltype(-a), WorldVector>::value));
+  ASSERT_TRUE((std::is_same<decltype(cross(a, b)), WorldVector>::value));
+  ASSERT_TRUE((std::is_same<decltype(normalize(a)), WorldVector>::value));
+  ASSERT_TRUE((std::is_same<decltype(min(a, b)), WorldVector>::value));
+
+  ASSERT_TRUE(a + b == (WorldVector{5.0f, 7.0f, 9.0f}));
+  ASSERT_TRUE(fuzzyEquals(cross(a, b), WorldVector{-3.0f, 6.0f, -3.0f}));
+  ASSERT_FLOAT_EQ(dot(a, b), 32.0f);
+  ASSERT_FLOAT_EQ(length(normalize(b)), 1.0f);
+
+  auto c = a;
+  c += b;
+  c *= 2.0f;
+  ASSERT_TRUE(c == (WorldVector{10.0f, 14.0f, 18.0f}));
+  ASSERT_TRUE(WorldVector::xAxis() == (WorldVector{1.0f, 0.0f, 0.0f}));
+}
+
+TEST(TaggedVectorTest, SpaceCastTest)
+{
+  Vector<double, 2, World> const a{1.0, -2.0};
+  auto const b = spaceCast<Local>(a);
+  ASSERT_TRUE((std::is_same<decltype(b), Vector<double, 2, Local> const>::value));
+  ASSERT_DOUBLE_EQ(b[0], 1.0);
+  ASSERT_DOUBLE_EQ(b[1], -2.0);
+
+  Vector<int, 4, Local> const c{1, 2, 3, 4};
+  Vector4i const untagged = spaceCast<void>(c);
+  ASSERT_EQ(untagged[3], 4);
+}
+
+TEST(TaggedVectorTest, SwizzleKeepsSpaceTest)
+{
+  WorldVector const a{1.0f, 2.0f, 3.0f};
+  auto const b = swizzle<2, 1, 0>(a);
+  ASSERT_TRUE((std::is_same<decltype(b), WorldVector const>::value));
+  ASSERT_TRUE(b == (WorldVector{3.0f, 2.0f, 1.0f}));
+  ASSERT_TRUE((std::is_same<decltype(swizzle<0, 1>(a)), Vector<float, 2, World>>::value));
+
+  auto c = a;
+  swizzleRef<0, 2>(c) = Vector<float, 2, World>{7.0f, 9.0f};
+  ASSERT_TRUE(c == (WorldVector{7.0f, 2.0f, 9.0f}));
+  swizzleRef<1>(c) += Vector<float, 1, World>{1.0f};
+  ASSERT_FLOAT_EQ(c[1], 3.0f);
+}
@@ -0,0 +1,111 @@
+#include "gtest/gtest.h"
+#include <cagey-math/Units.hh>
+#include <cagey-math/Vector3.hh>
+#include <cagey-math/VectorFunc.hh>
+#include <type_traits>
+#include <utility>
+
+using namespace cagey::math;
+
+namespace
+{
+  using Position = Vector<Length<float>, 3>;
+  using Speed = Vector<Velocity<float>, 3>;
+
+  template <typename L, typename R, typename = void>
+  struct CanAdd : std::false_type
+  {
+  };
+
+  template <typename L, typename R>
+  struct CanAdd<L, R, std::void_t<decltype(std::declval<L>() + std::declval<R>())>> : std::true_type
+  {
+  };
+
+  // mixing dimensions does not compile
+  static_assert(CanAdd<Length<float>, Length<float>>::value, "lengths add");
+  static_assert(!CanAdd<Length<float>, Time<float>>::value, "lengths and times must not add");
+  static_assert(!CanAdd<Length<float>, float>::value, "lengths and numbers must not add");
+  static_assert(CanAdd<Position, Position>::value, "positions add");
+  static_assert(!CanAdd<Position, Speed>::value, "positions and velocities must not add");
+  static_assert(!std::is_convertible<float, Length<float>>::value, "numbers must not convert implicitly");
+  static_assert(!std::is_convertible<Length<float>, float>::value, "lengths must not convert implicitly");
+
+  // dimensions compose
+  static_assert(std::is_same<decltype(Length<float>{} / Time<float>{}), Velocity<float>>::value, "m / s");
+  static_assert(std::is_same<decltype(Velocity<float>{} / Time<float>{}), Acceleration<float>>::value, "m / s^2");
+  static_assert(std::is_same<decltype(Mass<float>{} * Acceleration<float>{}), Force<float>>::value, "kg m / s^2");
+  static_assert(std::is_same<decltype(Force<float>{} * Length<float>{}), Energy<float>>::value, "N m");
+  static_assert(std::is_same<decltype(Length<float>{} / Length<float>{}), float>::value, "ratios are numbers");
+
+  // units cost nothing
+  static_assert(sizeof(Position) == sizeof(Vector3f), "unit vectors have the same size");
+  static_assert(alignof(Position) == alignof(Vector3f), "unit vectors have the same alignment");
+  static_assert(std::is_trivial<Length<float>>::value, "quantities are trivial");
+} // namespace
+
+TEST(UnitsTest, QuantityArithmeticTest)
+{
+  Length<float> const distance{10.0f};
+  Time<float> const duration{4.0f};
+  Velocity<float> const speed = distance / duration;
+  ASSERT_FLOAT_EQ(static_cast<float>(speed), 2.5f);
+  ASSERT_FLOAT_EQ(static_cast<float>(speed * duration), 10.0f);
+  ASSERT_FLOAT_EQ(static_cast<float>(distance * 2.0f - distance), 10.0f);
+  ASSERT_FLOAT_EQ(static_cast<float>(-distance), -10.0f);
+  ASSERT_FLOAT_EQ(static_cast<float>(1.0f / duration * distance), 2.5f);
+  ASSERT_FLOAT_EQ(distance / Length<float>{2.0f}, 5.0f);
+  ASSERT_FLOAT_EQ(static_cast<float>(sqrt(distance * distance)), 10.0f);
+  ASSERT_TRUE(duration < Time<float>{5.0f});
+  ASSERT_TRUE(distance == Length<float>{10.0f});
+}
+
+TEST(UnitsTest, VectorOperatorsTest)
+{
+  Position position{Length<float>{1.0f}, Length<float>{2.0f}, Length<float>{3.0f}};
+  Speed const speed{Velocity<float>{2.0f}, Velocity<float>{0.0f}, Velocity<float>{-4.0f}};
+  Time<float> const dt{0.5f};
+
+  ASSERT_TRUE((std::is_same<decltype(speed * dt), Position>::value));
+  ASSERT_TRUE((std::is_same<decltype(position / dt), Speed>::value));
+  position += speed * dt;
+  ASSERT_TRUE(position == (Position{Length<float>{2.0f}, Length<float>{2.0f}, Length<float>{1.0f}}));
+  position = dt * speed + position * 2.0f;
+  ASSERT_TRUE(position == (Position{Length<float>{5.0f}, Length<float>{4.0f}, Length<float>{0.0f}}));
+  ASSERT_TRUE(-position == (Position{Length<float>{-5.0f}, Length<float>{-4.0f}, Length<float>{-0.0f}}));
+}
+
+TEST(UnitsTest, DotCrossLengthTest)
+{
+  Position const a{Length<float>{1.0f}, Length<float>{2.0f}, Length<float>{3.0f}};
+  Position const b{Length<float>{4.0f}, Length<float>{5.0f}, Length<float>{6.0f}};
+  using Area = decltype(Length<float>{} * Length<float>{});
+
+  ASSERT_TRUE((std::is_same<decltype(dot(a, b)), Area>::value));
+  ASSERT_FLOAT_EQ(static_cast<float>(dot(a, b)), 32.0f);
+
+  auto const c = cross(a, b);
+  ASSERT_TRUE((std::is_same<decltype(c), Vector<Area, 3> const>::value));
+  ASSERT_FLOAT_EQ(static_cast<float>(c.x), -3.0f);
+  ASSERT_FLOAT_EQ(static_cast<float>(c.y), 6.0f);
+  ASSERT_FLOAT_EQ(static_cast<float>(c.z), -3.0f);
+
+  ASSERT_TRUE((std::is_same<decltype(length(a)), Length<float>>::value));
+  ASSERT_FLOAT_EQ(static_cast<float>(length(Position{Length<float>{3.0f}, Length<float>{4.0f}, Length<float>{0.0f}})),
+                  5.0f);
+  ASSERT_TRUE(fuzzyEquals(a, a, Length<float>{1e-6f}));
+
+  // torque is a force crossed with a lever arm
+  Vector<Force<float>, 3> const force{Force<float>{0.0f}, Force<float>{10.0f}, Force<float>{0.0f}};
+  auto const torque = cross(a, force);
+  ASSERT_FLOAT_EQ(static_cast<float>(torque.x), -30.0f);
+  ASSERT_FLOAT_EQ(static_cast<float>(torque.z), 10.0f);
+}
+
+TEST(UnitsTest, PlainVectorsUnchangedTest)
+{
+  Vector3f const a{1.0f, 2.0f, 3.0f};
+  ASSERT_TRUE((std::is_same<decltype(a * 2.0f), Vector3f>::value));
+  ASSERT_TRUE((std::is_same<decltype(dot(a, a)), float>::value));
+  ASSERT_TRUE((std::is_same<decltype(dot(Vector<std::int8_t, 3>{}, Vector<std::int8_t, 3>{})), std::int8_t>::value));
+}
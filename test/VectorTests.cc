@@ -1,5 +1,6 @@
 #include "gtest/gtest.h"
 #include <cagey-math/detail/Vector.hh>
+#include <cagey-math/VectorFunc.hh>
 #include <cstdint>
 
 using namespace cagey::math;
@@ -18,3 +19,141 @@ TEST(VectorTest, VectorTypeTest)
   ASSERT_EQ(is_vec_type<std::uint32_t>::value, true);
   ASSERT_EQ(is_vec_type<std::uint64_t>::value, true);
 }
+
+TEST(VectorTest, VectorSizeTest)
+{
+  ASSERT_EQ(sizeof(Vector<float, 6>), sizeof(float[6]));
+  ASSERT_EQ(sizeof(Vector<double, 9>), sizeof(double[9]));
+  ASSERT_EQ((Vector<float, 12>::Size), 12u);
+}
+
+TEST(VectorTest, ScalarConstructorTest)
+{
+  constexpr Vector<double, 9> v{4.8};
+  for (auto e : v)
+  {
+    ASSERT_DOUBLE_EQ(e, 4.8);
+  }
+}
+
+TEST(VectorTest, ComponentConstructorTest)
+{
+  constexpr Vector<double, 6> v{1.0, 2.0, 3.0, 4.0, 5.0, 6.0};
+  static_assert(v[5] == 6.0);
+  for (std::size_t i = 0; i < v.Size; ++i)
+  {
+    ASSERT_DOUBLE_EQ(v[i], static_cast<double>(i + 1));
+  }
+}
+
+TEST(VectorTest, ExplicitConversionConstructorTest)
+{
+  Vector<int, 6> vi{1, 2, 3, 4, 5, 6};
+  Vector<double, 6> vd{vi};
+  ASSERT_DOUBLE_EQ(vd[0], 1.0);
+  ASSERT_DOUBLE_EQ(vd[5], 6.0);
+}
+
+TEST(VectorTest, ZeroTest)
+{
+  constexpr auto v = Vector<float, 12>::zero();
+  ASSERT_EQ(v, (Vector<float, 12>{0.0f}));
+}
+
+TEST(VectorTest, AdditionAssignmentOperatorTest)
+{
+  Vector<double, 9> v{1.0, 2.0, 3.0, 4.0, 5.0, 6.0, 7.0, 8.0, 9.0};
+  ASSERT_EQ(&(v += Vector<double, 9>{1.5}), &v);
+  for (std::size_t i = 0; i < v.Size; ++i)
+  {
+    ASSERT_DOUBLE_EQ(v[i], i + 2.5);
+  }
+  ASSERT_EQ(&(v += 1), &v);
+  ASSERT_DOUBLE_EQ(v[8], 11.5);
+}
+
+TEST(VectorTest, SubtractionAssignmentOperatorTest)
+{
+  Vector<double, 6> v{1.0, 2.0, 3.0, 4.0, 5.0, 6.0};
+  ASSERT_EQ(&(v -= Vector<int, 6>{1, 1, 1, 1, 1, 1}), &v);
+  ASSERT_DOUBLE_EQ(v[0], 0.0);
+  ASSERT_DOUBLE_EQ(v[5], 5.0);
+  ASSERT_EQ(&(v -= 2), &v);
+  ASSERT_DOUBLE_EQ(v[5], 3.0);
+}
+
+TEST(VectorTest, MultiplicationAssignmentOperatorTest)
+{
+  Vector<float, 12> v{2.0f};
+  ASSERT_EQ(&(v *= 3), &v);
+  ASSERT_EQ(v, (Vector<float, 12>{6.0f}));
+  ASSERT_EQ(&(v *= Vector<float, 12>{0.5f}), &v);
+  ASSERT_EQ(v, (Vector<float, 12>{3.0f}));
+}
+
+TEST(VectorTest, DivisionAssignmentOperatorTest)
+{
+  Vector<double, 9> v{9.0};
+  ASSERT_EQ(&(v /= 3), &v);
+  ASSERT_EQ(v, (Vector<double, 9>{3.0}));
+  ASSERT_EQ(&(v /= Vector<double, 9>{2.0}), &v);
+  ASSERT_EQ(v, (Vector<double, 9>{1.5}));
+}
+
+TEST(VectorTest, IncrementDecrementOperatorTest)
+{
+  Vector<int, 6> v{1, 2, 3, 4, 5, 6};
+  ASSERT_EQ(v++, (Vector<int, 6>{1, 2, 3, 4, 5, 6}));
+  ASSERT_EQ(v, (Vector<int, 6>{2, 3, 4, 5, 6, 7}));
+  ASSERT_EQ(--v, (Vector<int, 6>{1, 2, 3, 4, 5, 6}));
+}
+
+TEST(VectorTest, BinaryOperatorTest)
+{
+  constexpr Vector<double, 6> a{1.0, 2.0, 3.0, 4.0, 5.0, 6.0};
+  constexpr Vector<double, 6> b{2.0};
+  ASSERT_EQ(a + b, (Vector<double, 6>{3.0, 4.0, 5.0, 6.0, 7.0, 8.0}));
+  ASSERT_EQ(a - b, (Vector<double, 6>{-1.0, 0.0, 1.0, 2.0, 3.0, 4.0}));
+  ASSERT_EQ(a * b, (Vector<double, 6>{2.0, 4.0, 6.0, 8.0, 10.0, 12.0}));
+  ASSERT_EQ(a / b, (Vector<double, 6>{0.5, 1.0, 1.5, 2.0, 2.5, 3.0}));
+  ASSERT_EQ(a * 2.0, 2.0 * a);
+  ASSERT_EQ(a / 2.0, (Vector<double, 6>{0.5, 1.0, 1.5, 2.0, 2.5, 3.0}));
+  ASSERT_EQ(12.0 / a, (Vector<double, 6>{12.0, 6.0, 4.0, 3.0, 2.4, 2.0}));
+  ASSERT_EQ(-a, (Vector<double, 6>{-1.0, -2.0, -3.0, -4.0, -5.0, -6.0}));
+}
+
+TEST(VectorTest, ChunkedOperatorTest)
+{
+  // 9 and 12 elements cross the chunking threshold, 9 also has a tail
+  Vector<int, 9> v9{1, 2, 3, 4, 5, 6, 7, 8, 9};
+  auto r9 = v9 + v9;
+  for (std::size_t i = 0; i < r9.Size; ++i)
+  {
+    ASSERT_EQ(r9[i], 2 * static_cast<int>(i + 1));
+  }
+
+  Vector<int, 12> v12{1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12};
+  auto r12 = v12 * 3;
+  for (std::size_t i = 0; i < r12.Size; ++i)
+  {
+    ASSERT_EQ(r12[i], 3 * static_cast<int>(i + 1));
+  }
+}
+
+TEST(VectorTest, EqualityTest)
+{
+  Vector<float, 6> v1{1.0f};
+  Vector<float, 6> v2{1.0f};
+  v2[3] = 2.0f;
+  ASSERT_TRUE((v1 == Vector<float, 6>{1.0f}));
+  ASSERT_TRUE(v1 != v2);
+}
+
+TEST(VectorTest, VectorFuncTest)
+{
+  constexpr Vector<double, 9> v{1.0, 2.0, 2.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0};
+  constexpr auto x = dot(v, Vector<double, 9>{2.0});
+  ASSERT_DOUBLE_EQ(x, 10.0);
+  ASSERT_DOUBLE_EQ(length(v), 3.0);
+  ASSERT_DOUBLE_EQ(length(normalize(v)), 1.0);
+}
@@ -0,0 +1,132 @@
+#include "gtest/gtest.h"
+#include <cagey-math/Viewport.hh>
+#include <random>
+#include <vector>
+
+using namespace cagey::math;
+
+namespace
+{
+  struct Projected
+  {
+    std::vector<float> x;
+    std::vector<float> y;
+    std::vector<float> z;
+    std::vector<std::uint8_t> flags;
+  };
+
+  auto run(Matrix44f const &viewProjection, std::vector<Vector3f> const &points, Viewport<float> const &viewport,
+           ClipDepth depth) -> Projected
+  {
+    std::vector<float> x, y, z;
+    for (auto const &p : points)
+    {
+      x.push_back(p[0]);
+      y.push_back(p[1]);
+      z.push_back(p[2]);
+    }
+    auto const n = points.size();
+    Projected result{std::vector<float>(n), std::vector<float>(n), std::vector<float>(n),
+                     std::vector<std::uint8_t>(n)};
+    batch::projectToViewport(viewProjection, batch::Points3SoA<float>{{x.data(), y.data(), z.data()}}, n, viewport,
+                             depth, batch::Points3SoAOut<float>{{result.x.data(), result.y.data(), result.z.data()}},
+                             result.flags.data());
+    return result;
+  }
+} // namespace
+
+TEST(ViewportTest, CornersTest)
+{
+  auto const projection = frustum(-1.0f, 1.0f, -1.0f, 1.0f, 1.0f, 10.0f);
+  Viewport<float> const viewport{10.0f, 20.0f, 640.0f, 480.0f, 0.0f, 1.0f};
+  std::vector<Vector3f> const points{{-1, -1, -1}, {10, 10, -10}, {0, 0, -5}, {-2, 0, -1}, {0, 0, -11}};
+  auto const out = run(projection.matrix, points, viewport, ClipDepth::ZeroToOne);
+
+  ASSERT_NEAR(out.x[0], 10.0f, 1e-3f);
+  ASSERT_NEAR(out.y[0], 20.0f, 1e-3f);
+  ASSERT_NEAR(out.z[0], 0.0f, 1e-5f);
+  ASSERT_EQ(out.flags[0], 0);
+  ASSERT_NEAR(out.x[1], 650.0f, 1e-3f);
+  ASSERT_NEAR(out.y[1], 500.0f, 1e-3f);
+  ASSERT_NEAR(out.z[1], 1.0f, 1e-5f);
+  ASSERT_EQ(out.flags[1], 0);
+  ASSERT_NEAR(out.x[2], 330.0f, 1e-3f);
+  ASSERT_NEAR(out.y[2], 260.0f, 1e-3f);
+  ASSERT_EQ(out.flags[3], ClipLeft);
+  ASSERT_EQ(out.flags[4], ClipMaxZ);
+}
+
+TEST(ViewportTest, MatchesScalarReferenceTest)
+{
+  auto const view = lookAt(Vector3f{2, 3, 5}, Vector3f{0, 0, 0}, Vector3f::yAxis());
+  for (auto depth : {ClipDepth::ZeroToOne, ClipDepth::NegativeOneToOne})
+  {
+    auto const projection = perspective(1.0f, 1.5f, 0.5f, 20.0f, DepthOrder::Reversed, depth);
+    auto const viewProjection = projection.matrix * view.matrix;
+    Viewport<float> const viewport{0.0f, 1080.0f, 1920.0f, -1080.0f, 0.0f, 1.0f};
+
+    std::mt19937 gen{13};
+    std::uniform_real_distribution<float> dist{-8.0f, 8.0f};
+    // odd count to exercise the scalar tail
+    std::vector<Vector3f> points(1023);
+    for (auto &p : points)
+    {
+      p = {dist(gen), dist(gen), dist(gen)};
+    }
+    auto const out = run(viewProjection, points, viewport, depth);
+
+    auto const low = depth == ClipDepth::ZeroToOne ? 0.0 : -1.0;
+    for (std::size_t i = 0; i < points.size(); ++i)
+    {
+      auto const &m = viewProjection;
+      double clip[4];
+      for (std::size_t r = 0; r < 4; ++r)
+      {
+        clip[r] = double(m[0][r]) * points[i][0] + double(m[1][r]) * points[i][1] + double(m[2][r]) * points[i][2] +
+                  double(m[3][r]);
+      }
+      auto const w = clip[3];
+      // points on a plane may legitimately land on either side in float
+      auto const margin = 1e-4 * std::abs(w);
+      auto const check = [&](double value, double bound, std::uint8_t flag, bool below) {
+        if (std::abs(value - bound) > margin)
+        {
+          ASSERT_EQ((out.flags[i] & flag) != 0, below ? value < bound : value > bound) << i;
+        }
+      };
+      check(clip[0], -w, ClipLeft, true);
+      check(clip[0], w, ClipRight, false);
+      check(clip[1], -w, ClipBottom, true);
+      check(clip[1], w, ClipTop, false);
+      check(clip[2], low * w, ClipMinZ, true);
+      check(clip[2], w, ClipMaxZ, false);
+
+      if (out.flags[i] == 0)
+      {
+        auto const ndcX = clip[0] / w;
+        auto const ndcY = clip[1] / w;
+        auto const ndcZ = (clip[2] / w - low) / (1.0 - low);
+        ASSERT_NEAR(out.x[i], (ndcX + 1.0) * 960.0, 2e-3) << i;
+        ASSERT_NEAR(out.y[i], 1080.0 - (ndcY + 1.0) * 540.0, 2e-3) << i;
+        ASSERT_NEAR(out.z[i], ndcZ, 1e-5) << i;
+      }
+    }
+  }
+}
+
+TEST(ViewportTest, DoubleTest)
+{
+  auto const projection = orthographic(0.0, 4.0, 0.0, 2.0, 0.0, 1.0);
+  double const x[] = {1.0, 5.0};
+  double const y[] = {1.0, 1.0};
+  double const z[] = {-0.5, 0.5};
+  double ox[2], oy[2], oz[2];
+  std::uint8_t flags[2];
+  batch::projectToViewport(projection.matrix, batch::Points3SoA<double>{{x, y, z}}, 2, Viewport<double>{0, 0, 8, 4},
+                           ClipDepth::ZeroToOne, batch::Points3SoAOut<double>{{ox, oy, oz}}, flags);
+  ASSERT_DOUBLE_EQ(ox[0], 2.0);
+  ASSERT_DOUBLE_EQ(oy[0], 2.0);
+  ASSERT_DOUBLE_EQ(oz[0], 0.5);
+  ASSERT_EQ(flags[0], 0);
+  ASSERT_EQ(flags[1], ClipRight | ClipMinZ);
+}
@@ -0,0 +1,131 @@
+#include "gtest/gtest.h"
+#include <cagey-math/VoxelGrid.hh>
+#include <vector>
+
+using namespace cagey::math;
+
+TEST(VoxelGridTest, SetTestTest)
+{
+  VoxelGrid grid;
+  ASSERT_FALSE(grid.test({1, 2, 3}));
+  grid.set({1, 2, 3});
+  grid.set({-1, -9, 100});
+  ASSERT_TRUE(grid.test({1, 2, 3}));
+  ASSERT_TRUE(grid.test({-1, -9, 100}));
+  ASSERT_FALSE(grid.test({1, 2, 4}));
+  ASSERT_FALSE(grid.test({-2, -9, 100}));
+  ASSERT_EQ(grid.brickCount(), 2u);
+}
+
+TEST(VoxelGridTest, BrickTest)
+{
+  VoxelGrid grid;
+  grid.set({0, 0, 0});
+  grid.set({7, 7, 7});
+  ASSERT_EQ(grid.brickCount(), 1u);
+  grid.set({8, 0, 0});
+  ASSERT_EQ(grid.brickCount(), 2u);
+  ASSERT_EQ(VoxelGrid::brickCoord({-1, 8, 15}), (Vector3i{-1, 1, 1}));
+
+  grid.set({8, 0, 0}, false);
+  ASSERT_EQ(grid.brickCount(), 1u);
+  grid.set({0, 0, 0}, false);
+  ASSERT_EQ(grid.brickCount(), 1u);
+  grid.set({7, 7, 7}, false);
+  ASSERT_EQ(grid.brickCount(), 0u);
+  ASSERT_FALSE(grid.test({7, 7, 7}));
+}
+
+TEST(VoxelGridTest, CastRayTest)
+{
+  VoxelGrid grid;
+  grid.set({10, 0, 0});
+  auto const hit = castRay(grid, {{0.5f, 0.5f, 0.5f}, {1.0f, 0.0f, 0.0f}, 100.0f});
+  ASSERT_TRUE(hit.hit);
+  ASSERT_EQ(hit.voxel, (Vector3i{10, 0, 0}));
+  ASSERT_FLOAT_EQ(hit.distance, 9.5f);
+
+  auto const shortRay = castRay(grid, {{0.5f, 0.5f, 0.5f}, {1.0f, 0.0f, 0.0f}, 5.0f});
+  ASSERT_FALSE(shortRay.hit);
+
+  auto const backwards = castRay(grid, {{20.5f, 0.5f, 0.5f}, {-2.0f, 0.0f, 0.0f}, 100.0f});
+  ASSERT_TRUE(backwards.hit);
+  ASSERT_EQ(backwards.voxel, (Vector3i{10, 0, 0}));
+  ASSERT_FLOAT_EQ(backwards.distance, 4.75f);
+}
+
+TEST(VoxelGridTest, CastRayDiagonalTest)
+{
+  VoxelGrid grid;
+  grid.set({-5, -5, -5});
+  auto const hit = castRay(grid, {{0.5f, 0.5f, 0.5f}, {-1.0f, -1.0f, -1.0f}, 100.0f});
+  ASSERT_TRUE(hit.hit);
+  ASSERT_EQ(hit.voxel, (Vector3i{-5, -5, -5}));
+
+  auto const inside = castRay(grid, {{-4.5f, -4.5f, -4.5f}, {0.0f, 1.0f, 0.0f}, 100.0f});
+  ASSERT_TRUE(inside.hit);
+  ASSERT_FLOAT_EQ(inside.distance, 0.0f);
+
+  auto const still = castRay(grid, {{0.5f, 0.5f, 0.5f}, {0.0f, 0.0f, 0.0f}, 100.0f});
+  ASSERT_FALSE(still.hit);
+}
+
+namespace
+{
+  auto makeGrid() -> VoxelGrid
+  {
+    VoxelGrid grid;
+    for (int i = 0; i < 400; ++i)
+    {
+      grid.set({(i * 7919) % 41 - 20, (i * 104729) % 37 - 18, (i * 1299709) % 43 - 21});
+    }
+    return grid;
+  }
+
+  auto makeRays(std::size_t count) -> std::vector<VoxelRay>
+  {
+    std::vector<VoxelRay> rays(count);
+    for (std::size_t i = 0; i < count; ++i)
+    {
+      auto const f = static_cast<float>(i);
+      rays[i] = {{std::sin(f) * 3.0f, std::cos(f * 1.3f) * 3.0f, std::sin(f * 0.7f) * 3.0f},
+                 {std::cos(f * 2.1f), std::sin(f * 0.3f), std::cos(f * 1.7f) + 0.1f},
+                 30.0f};
+    }
+    return rays;
+  }
+} // namespace
+
+TEST(VoxelGridTest, PacketMatchesScalarTest)
+{
+  auto const grid = makeGrid();
+  auto const rays = makeRays(VoxelPacketSize);
+  std::array<VoxelRay, VoxelPacketSize> packet;
+  std::copy(rays.begin(), rays.end(), packet.begin());
+  auto const hits = castRays(grid, packet);
+  for (std::size_t i = 0; i < VoxelPacketSize; ++i)
+  {
+    auto const expected = castRay(grid, rays[i]);
+    ASSERT_EQ(hits[i].hit, expected.hit);
+    ASSERT_EQ(hits[i].voxel, expected.voxel);
+    ASSERT_FLOAT_EQ(hits[i].distance, expected.distance);
+  }
+}
+
+TEST(VoxelGridTest, BatchMatchesScalarTest)
+{
+  auto const grid = makeGrid();
+  auto const rays = makeRays(1003);
+  std::vector<VoxelHit> hits(rays.size());
+  castRays(grid, rays.data(), hits.data(), rays.size(), 4);
+  std::size_t hitCount = 0;
+  for (std::size_t i = 0; i < rays.size(); ++i)
+  {
+    auto const expected = castRay(grid, rays[i]);
+    ASSERT_EQ(hits[i].hit, expected.hit);
+    ASSERT_EQ(hits[i].voxel, expected.voxel);
+    hitCount += expected.hit;
+  }
+  ASSERT_GT(hitCount, 0u);
+  ASSERT_LT(hitCount, rays.size());
+}